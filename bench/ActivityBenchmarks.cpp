@@ -0,0 +1,88 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include "Benchmark.h"
+
+#include <random>
+
+#include <mindset/EventSequence.h>
+#include <mindset/TimeGrid.h>
+
+using namespace mindset;
+using namespace mindset::bench;
+using namespace std::chrono_literals;
+
+MINDSET_BENCHMARK("event-sequence/range/1M")
+{
+    constexpr size_t EVENTS = 1'000'000;
+    std::mt19937 random(5);
+    std::uniform_int_distribution<int64_t> time(0, 1'000'000'000);
+    std::uniform_int_distribution<UID> neuron(0, 999);
+
+    EventSequence<float> sequence;
+    for (size_t i = 0; i < EVENTS; ++i) {
+        sequence.addEvent(neuron(random), std::chrono::microseconds(time(random)), 1.0f);
+    }
+
+    std::vector<std::chrono::microseconds> starts;
+    for (size_t i = 0; i < 256; ++i) {
+        starts.emplace_back(time(random));
+    }
+
+    state.setItemsPerIteration(starts.size());
+    state.run([&] {
+        size_t total = 0;
+        for (auto start : starts) {
+            total += std::ranges::distance(sequence.getRange(start, start + 10ms));
+        }
+        doNotOptimize(total);
+    });
+}
+
+MINDSET_BENCHMARK("time-grid/timeline/1k-10k")
+{
+    constexpr UID NEURONS = 1'000;
+    constexpr size_t TIMESTEPS = 10'000;
+
+    std::vector<UID> uids(NEURONS);
+    for (UID uid = 0; uid < NEURONS; ++uid) {
+        uids[uid] = uid;
+    }
+
+    TimeGrid<float> grid(1ms);
+    grid.defineUIDs(uids);
+    std::vector<float> timestep(NEURONS);
+    for (size_t i = 0; i < TIMESTEPS; ++i) {
+        for (UID uid = 0; uid < NEURONS; ++uid) {
+            timestep[uid] = static_cast<float>((i + uid) % 100);
+        }
+        grid.addTimestep(timestep);
+    }
+
+    state.setItemsPerIteration(TIMESTEPS);
+    UID next = 0;
+    state.run([&] {
+        float total = 0.0f;
+        for (float value : std::as_const(grid).getTimeline(next)) {
+            total += value;
+        }
+        next = (next + 7) % NEURONS;
+        doNotOptimize(total);
+    });
+}
@@ -0,0 +1,127 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include "Benchmark.h"
+
+#include <filesystem>
+
+#include <mindset/DefaultProperties.h>
+#include <mindset/analysis/CircuitGraph.h>
+#include <mindset/analysis/Connectivity.h>
+#include <mindset/analysis/Motifs.h>
+#include <mindset/export/AdjacencyExport.h>
+#include <mindset/generator/DatasetGenerator.h>
+
+using namespace mindset;
+using namespace mindset::bench;
+
+namespace
+{
+    void generateDataset(Dataset& dataset, size_t neurons, size_t synapses)
+    {
+        DatasetGeneratorSettings settings;
+        settings.neurons = neurons;
+        settings.synapses.amount = synapses;
+        settings.synapses.positions = false;
+        settings.activity.spikes = false;
+
+        DatasetGenerator(settings).generate(dataset);
+    }
+} // namespace
+
+MINDSET_BENCHMARK("analysis/connectivity/by-layer/1M-synapses")
+{
+    Dataset dataset;
+    generateDataset(dataset, 1'000, 1'000'000);
+    auto grouping = NeuronGrouping::byHierarchy(dataset, "mindset:layer");
+
+    state.setItemsPerIteration(1'000'000);
+    state.run([&] {
+        auto connectivity = GroupConnectivity::compute(dataset, grouping);
+        doNotOptimize(connectivity.getSynapses(0, 0));
+    });
+}
+
+MINDSET_BENCHMARK("analysis/graph/build/1M-synapses")
+{
+    Dataset dataset;
+    generateDataset(dataset, 1'000, 1'000'000);
+
+    state.setItemsPerIteration(1'000'000);
+    state.run([&] {
+        CircuitGraph graph(dataset);
+        doNotOptimize(graph.getEdgesAmount());
+    });
+}
+
+MINDSET_BENCHMARK("analysis/graph/3-hop-neighborhood/1M-synapses")
+{
+    Dataset dataset;
+    generateDataset(dataset, 1'000, 1'000'000);
+    CircuitGraph graph(dataset);
+    std::vector<UID> sources = {graph.getUIDs().front()};
+
+    state.setItemsPerIteration(1);
+    state.run([&] { doNotOptimize(graph.getNeighborhood(sources, 3, TraversalDirection::OUTGOING).size()); });
+}
+
+MINDSET_BENCHMARK("analysis/graph/weakly-connected-components/1M-synapses")
+{
+    Dataset dataset;
+    generateDataset(dataset, 1'000, 1'000'000);
+    CircuitGraph graph(dataset);
+
+    state.setItemsPerIteration(graph.getEdgesAmount());
+    state.run([&] { doNotOptimize(graph.getWeaklyConnectedComponents().getComponentsAmount()); });
+}
+
+MINDSET_BENCHMARK("analysis/motifs/census-and-clustering/200k-synapses")
+{
+    Dataset dataset;
+    generateDataset(dataset, 10'000, 200'000);
+    CircuitGraph graph(dataset);
+
+    state.setItemsPerIteration(graph.getEdgesAmount());
+    state.run([&] { doNotOptimize(computeMotifs(graph).census.counts[0]); });
+}
+
+MINDSET_BENCHMARK("export/adjacency/raw-csr/1M-synapses")
+{
+    Dataset dataset;
+    generateDataset(dataset, 1'000, 1'000'000);
+    auto path = std::filesystem::temp_directory_path() / "mindset-adjacency-bench.bin";
+
+    AdjacencyExportSettings settings;
+    state.setItemsPerIteration(1'000'000);
+    state.run([&] { doNotOptimize(exportAdjacency(dataset, path, settings).isOk()); });
+    std::filesystem::remove(path);
+}
+
+MINDSET_BENCHMARK("export/adjacency/matrix-market/1M-synapses")
+{
+    Dataset dataset;
+    generateDataset(dataset, 1'000, 1'000'000);
+    auto path = std::filesystem::temp_directory_path() / "mindset-adjacency-bench.mtx";
+
+    AdjacencyExportSettings settings;
+    settings.format = AdjacencyFormat::MATRIX_MARKET;
+    state.setItemsPerIteration(1'000'000);
+    state.run([&] { doNotOptimize(exportAdjacency(dataset, path, settings).isOk()); });
+    std::filesystem::remove(path);
+}
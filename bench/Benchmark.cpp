@@ -0,0 +1,235 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <optional>
+#include <sstream>
+
+#include <mindset/version.h>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double measure(const std::function<void()>& iteration, size_t iterations)
+    {
+        auto start = Clock::now();
+        for (size_t i = 0; i < iterations; ++i) {
+            iteration();
+        }
+        return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+    }
+
+    std::string escape(const std::string& string)
+    {
+        std::string result;
+        result.reserve(string.size());
+        for (char c : string) {
+            if (c == '"' || c == '\\') {
+                result += '\\';
+            }
+            result += c;
+        }
+        return result;
+    }
+
+    /**
+     * Finds the value of the given key after the given position. Only supports the flat objects written by writeJSON().
+     */
+    std::optional<std::string> findValue(const std::string& json, const std::string& key, size_t from, size_t to)
+    {
+        auto keyPosition = json.find("\"" + key + "\"", from);
+        if (keyPosition == std::string::npos || keyPosition >= to) {
+            return {};
+        }
+        auto colon = json.find(':', keyPosition);
+        auto begin = json.find_first_not_of(" \t\r\n", colon + 1);
+        if (begin == std::string::npos) {
+            return {};
+        }
+        if (json[begin] == '"') {
+            std::string value;
+            for (size_t i = begin + 1; i < json.size() && json[i] != '"'; ++i) {
+                if (json[i] == '\\' && i + 1 < json.size()) {
+                    ++i;
+                }
+                value += json[i];
+            }
+            return value;
+        }
+        auto end = json.find_first_of(",}\r\n", begin);
+        return json.substr(begin, end - begin);
+    }
+} // namespace
+
+namespace mindset::bench
+{
+    State::State(const BenchmarkSettings& settings, BenchmarkResult& result) :
+        _settings(settings),
+        _result(result),
+        _items(0),
+        _ran(false)
+    {
+    }
+
+    void State::setItemsPerIteration(size_t items)
+    {
+        _items = items;
+    }
+
+    void State::run(const std::function<void()>& iteration)
+    {
+        _ran = true;
+
+        // Calibration: doubles the iterations until a sample lasts long enough.
+        // This also warms up caches and lazy initializations.
+        double target = static_cast<double>(_settings.minSampleTime.count());
+        size_t iterations = 1;
+        double elapsed = measure(iteration, iterations);
+        while (elapsed < target && iterations < (size_t(1) << 30)) {
+            double factor = elapsed <= 0.0 ? 10.0 : std::clamp(target / elapsed * 1.2, 1.5, 10.0);
+            iterations = static_cast<size_t>(std::ceil(static_cast<double>(iterations) * factor));
+            elapsed = measure(iteration, iterations);
+        }
+
+        std::vector<double> samples;
+        samples.reserve(_settings.samples);
+        for (size_t i = 0; i < std::max<size_t>(1, _settings.samples); ++i) {
+            samples.push_back(measure(iteration, iterations) / static_cast<double>(iterations));
+        }
+        std::ranges::sort(samples);
+
+        double mean = 0.0;
+        for (double sample : samples) {
+            mean += sample;
+        }
+        mean /= static_cast<double>(samples.size());
+
+        double variance = 0.0;
+        for (double sample : samples) {
+            variance += (sample - mean) * (sample - mean);
+        }
+        variance /= static_cast<double>(samples.size());
+
+        size_t middle = samples.size() / 2;
+        _result.iterations = iterations;
+        _result.samples = samples.size();
+        _result.minNs = samples.front();
+        _result.medianNs = samples.size() % 2 == 0 ? (samples[middle - 1] + samples[middle]) / 2.0 : samples[middle];
+        _result.meanNs = mean;
+        _result.stddevNs = std::sqrt(variance);
+        _result.itemsPerSecond = _items == 0 ? 0.0 : static_cast<double>(_items) * 1e9 / _result.medianNs;
+    }
+
+    bool State::hasRun() const
+    {
+        return _ran;
+    }
+
+    std::vector<BenchmarkEntry>& getBenchmarks()
+    {
+        static std::vector<BenchmarkEntry> benchmarks;
+        return benchmarks;
+    }
+
+    BenchmarkRegistrar::BenchmarkRegistrar(std::string name, BenchmarkFunction function)
+    {
+        getBenchmarks().push_back({std::move(name), function});
+    }
+
+    bool writeJSON(const std::string& path, const std::vector<BenchmarkResult>& results)
+    {
+        std::ofstream out(path);
+        if (!out) {
+            return false;
+        }
+
+        out << std::setprecision(10);
+        out << "{\n";
+        out << "  \"version\": \"" << MINDSET_VERSION << "\",\n";
+        out << "  \"commit\": \"" << MINDSET_GIT_COMMIT << "\",\n";
+        out << "  \"benchmarks\": [\n";
+        for (size_t i = 0; i < results.size(); ++i) {
+            auto& result = results[i];
+            out << "    {";
+            out << "\"name\": \"" << escape(result.name) << "\", ";
+            out << "\"iterations\": " << result.iterations << ", ";
+            out << "\"samples\": " << result.samples << ", ";
+            out << "\"min_ns\": " << result.minNs << ", ";
+            out << "\"median_ns\": " << result.medianNs << ", ";
+            out << "\"mean_ns\": " << result.meanNs << ", ";
+            out << "\"stddev_ns\": " << result.stddevNs << ", ";
+            out << "\"items_per_second\": " << result.itemsPerSecond;
+            out << (i + 1 < results.size() ? "},\n" : "}\n");
+        }
+        out << "  ]\n";
+        out << "}\n";
+        return static_cast<bool>(out);
+    }
+
+    bool readJSON(const std::string& path, std::vector<BenchmarkResult>& results)
+    {
+        std::ifstream in(path);
+        if (!in) {
+            return false;
+        }
+        std::stringstream buffer;
+        buffer << in.rdbuf();
+        std::string json = buffer.str();
+
+        auto array = json.find("\"benchmarks\"");
+        if (array == std::string::npos) {
+            return false;
+        }
+
+        size_t position = json.find('{', array);
+        while (position != std::string::npos) {
+            size_t end = json.find('}', position);
+            if (end == std::string::npos) {
+                return false;
+            }
+
+            auto number = [&](const std::string& key) {
+                auto value = findValue(json, key, position, end);
+                return value ? std::strtod(value->c_str(), nullptr) : 0.0;
+            };
+
+            BenchmarkResult result;
+            result.name = findValue(json, "name", position, end).value_or("");
+            result.iterations = static_cast<size_t>(number("iterations"));
+            result.samples = static_cast<size_t>(number("samples"));
+            result.minNs = number("min_ns");
+            result.medianNs = number("median_ns");
+            result.meanNs = number("mean_ns");
+            result.stddevNs = number("stddev_ns");
+            result.itemsPerSecond = number("items_per_second");
+            results.push_back(std::move(result));
+
+            position = json.find('{', end);
+        }
+
+        return true;
+    }
+} // namespace mindset::bench
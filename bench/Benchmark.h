@@ -0,0 +1,143 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#ifndef MINDSET_BENCHMARK_H
+#define MINDSET_BENCHMARK_H
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace mindset::bench
+{
+    /**
+     * The measurements of a benchmark.
+     * Times are expressed in nanoseconds per iteration.
+     */
+    struct BenchmarkResult
+    {
+        std::string name;
+        size_t iterations = 0;
+        size_t samples = 0;
+        double minNs = 0.0;
+        double medianNs = 0.0;
+        double meanNs = 0.0;
+        double stddevNs = 0.0;
+        /// Items processed per second, or zero if the benchmark doesn't define items per iteration.
+        double itemsPerSecond = 0.0;
+    };
+
+    struct BenchmarkSettings
+    {
+        /// The amount of measured samples.
+        size_t samples = 10;
+        /// The minimum duration of each sample. Iterations are calibrated to reach it.
+        std::chrono::nanoseconds minSampleTime = std::chrono::milliseconds(20);
+    };
+
+    /**
+     * Handed to each benchmark. The benchmark prepares its data and then calls run() with the measured code.
+     */
+    class State
+    {
+        const BenchmarkSettings& _settings;
+        BenchmarkResult& _result;
+        size_t _items;
+        bool _ran;
+
+      public:
+        State(const BenchmarkSettings& settings, BenchmarkResult& result);
+
+        /**
+         * Sets the amount of items processed by each iteration, used to report the throughput.
+         */
+        void setItemsPerIteration(size_t items);
+
+        /**
+         * Measures the given function. It must be called exactly once per benchmark.
+         */
+        void run(const std::function<void()>& iteration);
+
+        [[nodiscard]] bool hasRun() const;
+    };
+
+    using BenchmarkFunction = void (*)(State&);
+
+    struct BenchmarkEntry
+    {
+        std::string name;
+        BenchmarkFunction function;
+    };
+
+    /**
+     * Returns all the benchmarks registered using MINDSET_BENCHMARK.
+     */
+    std::vector<BenchmarkEntry>& getBenchmarks();
+
+    struct BenchmarkRegistrar
+    {
+        BenchmarkRegistrar(std::string name, BenchmarkFunction function);
+    };
+
+    /**
+     * Prevents the compiler from optimizing away the computation of the given value.
+     */
+    template<typename T>
+    void doNotOptimize(const T& value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const void* sink;
+        sink = &value;
+#endif
+    }
+
+    /**
+     * Writes the results as JSON.
+     */
+    bool writeJSON(const std::string& path, const std::vector<BenchmarkResult>& results);
+
+    /**
+     * Reads the results written by writeJSON().
+     */
+    bool readJSON(const std::string& path, std::vector<BenchmarkResult>& results);
+} // namespace mindset::bench
+
+#define MINDSET_BENCHMARK_CONCAT_IMPL(a, b) a##b
+#define MINDSET_BENCHMARK_CONCAT(a, b)      MINDSET_BENCHMARK_CONCAT_IMPL(a, b)
+
+/**
+ * Defines and registers a benchmark:
+ *
+ * MINDSET_BENCHMARK("group/name")
+ * {
+ *     auto data = prepare();
+ *     state.run([&] { mindset::bench::doNotOptimize(process(data)); });
+ * }
+ */
+#define MINDSET_BENCHMARK(name)                                                                                        \
+    static void MINDSET_BENCHMARK_CONCAT(mindsetBenchmark, __LINE__)(mindset::bench::State & state);                   \
+    static mindset::bench::BenchmarkRegistrar MINDSET_BENCHMARK_CONCAT(mindsetBenchmarkRegistrar, __LINE__)(           \
+        name, MINDSET_BENCHMARK_CONCAT(mindsetBenchmark, __LINE__));                                                   \
+    static void MINDSET_BENCHMARK_CONCAT(mindsetBenchmark, __LINE__)(mindset::bench::State & state)
+
+#endif //MINDSET_BENCHMARK_H
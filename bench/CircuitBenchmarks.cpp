@@ -0,0 +1,113 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include "Benchmark.h"
+
+#include <random>
+
+#include <mindset/Circuit.h>
+#include <mindset/DatasetView.h>
+
+using namespace mindset;
+using namespace mindset::bench;
+
+namespace
+{
+    constexpr UID NEURONS = 1'000;
+    constexpr UID SYNAPSES_PER_NEURON = 100;
+
+    std::vector<Synapse> randomSynapses()
+    {
+        std::mt19937 random(3);
+        std::uniform_int_distribution<UID> neuron(0, NEURONS - 1);
+        std::vector<Synapse> synapses;
+        synapses.reserve(NEURONS * SYNAPSES_PER_NEURON);
+        for (UID uid = 0; uid < NEURONS * SYNAPSES_PER_NEURON; ++uid) {
+            synapses.emplace_back(uid, neuron(random), neuron(random));
+        }
+        return synapses;
+    }
+} // namespace
+
+MINDSET_BENCHMARK("circuit/add-synapses/100k")
+{
+    auto synapses = randomSynapses();
+    state.setItemsPerIteration(synapses.size());
+    state.run([&] {
+        Circuit circuit;
+        circuit.addSynapses(synapses);
+        doNotOptimize(circuit);
+    });
+}
+
+MINDSET_BENCHMARK("circuit/pre-synapses/100k")
+{
+    Circuit circuit;
+    circuit.addSynapses(randomSynapses());
+    state.setItemsPerIteration(NEURONS);
+    state.run([&] {
+        size_t total = 0;
+        for (UID uid = 0; uid < NEURONS; ++uid) {
+            for (auto& synapse : circuit.getPreSynapses(uid)) {
+                total += synapse.getPostSynapticNeuron();
+            }
+        }
+        doNotOptimize(total);
+    });
+}
+
+MINDSET_BENCHMARK("circuit/post-synapses/100k")
+{
+    Circuit circuit;
+    circuit.addSynapses(randomSynapses());
+    state.setItemsPerIteration(NEURONS);
+    state.run([&] {
+        size_t total = 0;
+        for (UID uid = 0; uid < NEURONS; ++uid) {
+            for (auto* synapse : circuit.getPostSynapses(uid)) {
+                total += synapse->getPreSynapticNeuron();
+            }
+        }
+        doNotOptimize(total);
+    });
+}
+
+MINDSET_BENCHMARK("circuit/view-induced-subcircuit/100-of-1k")
+{
+    Dataset dataset;
+    for (UID uid = 0; uid < NEURONS; ++uid) {
+        dataset.addNeuron(Neuron(uid));
+    }
+    dataset.getCircuit().addSynapses(randomSynapses());
+
+    std::vector<UID> selection;
+    for (UID uid = 0; uid < NEURONS; uid += 10) {
+        selection.push_back(uid);
+    }
+
+    state.setItemsPerIteration(selection.size());
+    state.run([&] {
+        DatasetView view(dataset, UIDSet::fromSorted(selection));
+        size_t total = 0;
+        for (auto synapse : view.getSynapses()) {
+            total += synapse->getUID();
+        }
+        doNotOptimize(total);
+    });
+}
@@ -0,0 +1,61 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include "Benchmark.h"
+
+#include <mindset/generator/DatasetGenerator.h>
+
+using namespace mindset;
+using namespace mindset::bench;
+
+namespace
+{
+    void generate(State& state, size_t neurons, size_t synapses, bool positions,
+                  DatasetMemory memory = DatasetMemory::HEAP)
+    {
+        DatasetGeneratorSettings settings;
+        settings.neurons = neurons;
+        settings.synapses.amount = synapses;
+        settings.synapses.positions = positions;
+        settings.activity.spikes = false;
+
+        state.setItemsPerIteration(synapses);
+        state.run([&] {
+            // The dataset is destroyed inside the measured iteration, so the teardown cost is included.
+            Dataset dataset(memory);
+            DatasetGenerator(settings).generate(dataset);
+            doNotOptimize(dataset.getNeuronsAmount());
+        });
+    }
+} // namespace
+
+MINDSET_BENCHMARK("generator/1k-neurons/1M-connections")
+{
+    generate(state, 1'000, 1'000'000, false);
+}
+
+MINDSET_BENCHMARK("generator/1k-neurons/1M-synapses")
+{
+    generate(state, 1'000, 1'000'000, true);
+}
+
+MINDSET_BENCHMARK("generator/1k-neurons/1M-synapses/arena")
+{
+    generate(state, 1'000, 1'000'000, true, DatasetMemory::ARENA);
+}
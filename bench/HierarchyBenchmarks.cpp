@@ -0,0 +1,78 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include "Benchmark.h"
+
+#include <mindset/Dataset.h>
+#include <mindset/util/Result.h>
+
+using namespace mindset;
+using namespace mindset::bench;
+
+namespace
+{
+    constexpr UID NEURONS = 100'000;
+    constexpr UID NEURONS_PER_MINI_COLUMN = 100;
+    constexpr UID MINI_COLUMNS_PER_COLUMN = 10;
+
+    Result<UID, std::string> parseDigit(char c)
+    {
+        if (c < '0' || c > '9') {
+            return std::string("Not a digit.");
+        }
+        return static_cast<UID>(c - '0');
+    }
+} // namespace
+
+// Mirrors the hierarchy building done by the XML and BlueConfig loaders: two lookups per neuron.
+MINDSET_BENCHMARK("hierarchy/get-or-create-node/100k-neurons")
+{
+    state.setItemsPerIteration(NEURONS);
+    state.run([&] {
+        Dataset dataset;
+        auto* root = dataset.createHierarchy(0, "mindset:root");
+        for (UID neuron = 0; neuron < NEURONS; ++neuron) {
+            UID miniColumn = neuron / NEURONS_PER_MINI_COLUMN;
+            UID column = miniColumn / MINI_COLUMNS_PER_COLUMN;
+            if (auto columnResult = root->getOrCreateNode(column, "mindset:column"); columnResult.isOk()) {
+                if (auto miniColumnResult = columnResult.getResult()->getOrCreateNode(miniColumn, "mindset:mini_column");
+                    miniColumnResult.isOk()) {
+                    miniColumnResult.getResult()->addNeuron(neuron);
+                }
+            }
+        }
+        doNotOptimize(root);
+    });
+}
+
+MINDSET_BENCHMARK("result/map-and-then")
+{
+    std::string digits = "0123456789x";
+    state.setItemsPerIteration(digits.size());
+    state.run([&] {
+        UID total = 0;
+        for (char c : digits) {
+            total += parseDigit(c)
+                         .map([](UID value) { return value * 2; })
+                         .andThen([](UID value) -> Result<UID, std::string> { return value + 1; })
+                         .orElseGet([] { return UID(0); });
+        }
+        doNotOptimize(total);
+    });
+}
@@ -0,0 +1,150 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include "Benchmark.h"
+#include "Synthetic.h"
+
+#include <mindset/loader/SWCLoader.h>
+#include <mindset/loader/XMLLoader.h>
+
+using namespace mindset;
+using namespace mindset::bench;
+
+namespace
+{
+    void parseLines(State& state, size_t points)
+    {
+        auto lines = generateSWC(points);
+        state.setItemsPerIteration(lines.size());
+        state.run([&] {
+            Dataset dataset;
+            SWCLoader loader(LoaderCreateInfo(), lines);
+            loader.load(dataset);
+            doNotOptimize(dataset.getNeuronsAmount());
+        });
+    }
+
+    /**
+     * Parses the lines into a morphology without committing it to a dataset,
+     * isolating the per-line cost of the parser.
+     */
+    void parseMorphology(State& state, size_t points)
+    {
+        auto lines = generateSWC(points);
+        Dataset dataset;
+        auto properties = SWCLoader::initProperties(dataset);
+        state.setItemsPerIteration(lines.size());
+        state.run([&] {
+            SWCLoader loader(LoaderCreateInfo(), lines);
+            auto morphology = loader.loadMorphology(properties);
+            doNotOptimize(morphology.isOk());
+        });
+    }
+
+    void parseFile(State& state, const std::filesystem::path& path, size_t lines)
+    {
+        state.setItemsPerIteration(lines);
+        state.run([&] {
+            Dataset dataset;
+            SWCLoader loader(LoaderCreateInfo(), path);
+            loader.load(dataset);
+            doNotOptimize(dataset.getNeuronsAmount());
+        });
+    }
+
+    /**
+     * Creates a scene with one minicolumn whose neurons share the given amount of morphologies.
+     * Each morphology is referenced by two entries.
+     */
+    std::string generateScene(size_t neurons, size_t morphologies)
+    {
+        std::string xml = "<scene><morphology><columns><column id=\"0\"><minicolumn id=\"0\">";
+        for (size_t i = 0; i < neurons; ++i) {
+            xml += "<neuron gid=\"" + std::to_string(i) + "\" layer=\"1\"><transform>"
+                   "1.0, 0.0, 0.0, " + std::to_string(i) + ".5, 0.0, 1.0, 0.0, 0.0, "
+                   "0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 1.0</transform></neuron>";
+        }
+        xml += "</minicolumn></column></columns><neuronmorphologies>";
+        for (size_t entry = 0; entry < morphologies * 2; ++entry) {
+            std::string neuronsList;
+            for (size_t i = entry; i < neurons; i += morphologies * 2) {
+                neuronsList += (neuronsList.empty() ? "" : ",") + std::to_string(i);
+            }
+            xml += "<neuronmorphology neurons=\"" + neuronsList + "\" swc=\"morphology-" +
+                   std::to_string(entry % morphologies) + ".swc\"/>";
+        }
+        xml += "</neuronmorphologies></morphology></scene>";
+        return xml;
+    }
+
+    void loadScene(State& state, size_t neurons, size_t morphologies)
+    {
+        auto xml = generateScene(neurons, morphologies);
+        auto swc = generateSWC(500);
+
+        LoaderCreateInfo info;
+        info.fileProvider = [&swc](const std::filesystem::path&) { return std::optional(swc); };
+
+        state.setItemsPerIteration(neurons);
+        state.run([&] {
+            Dataset dataset;
+            XMLLoader loader(info, xml.data(), xml.size());
+            loader.load(dataset);
+            doNotOptimize(dataset.getNeuronsAmount());
+        });
+    }
+} // namespace
+
+MINDSET_BENCHMARK("xml/scene/10k-neurons/1k-morphologies")
+{
+    loadScene(state, 10'000, 1'000);
+}
+
+MINDSET_BENCHMARK("swc/file/test.swc")
+{
+    parseFile(state, getDataPath("test.swc"), 2989);
+}
+
+MINDSET_BENCHMARK("swc/file/synthetic-100k")
+{
+    auto lines = generateSWC(100'000);
+    auto path = writeTemporaryFile("mindset-bench-100k.swc", lines);
+    parseFile(state, path, lines.size());
+    std::filesystem::remove(path);
+}
+
+MINDSET_BENCHMARK("swc/lines/synthetic-1k")
+{
+    parseLines(state, 1'000);
+}
+
+MINDSET_BENCHMARK("swc/lines/synthetic-10k")
+{
+    parseLines(state, 10'000);
+}
+
+MINDSET_BENCHMARK("swc/lines/synthetic-100k")
+{
+    parseLines(state, 100'000);
+}
+
+MINDSET_BENCHMARK("swc/parse/synthetic-100k")
+{
+    parseMorphology(state, 100'000);
+}
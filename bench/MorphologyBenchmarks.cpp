@@ -0,0 +1,114 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include "Benchmark.h"
+#include "Synthetic.h"
+
+#include <fstream>
+#include <random>
+
+#include <mindset/MorphologyTree.h>
+#include <mindset/loader/SWCLoader.h>
+#include <mindset/util/MorphologyUtils.h>
+
+using namespace mindset;
+using namespace mindset::bench;
+
+namespace
+{
+    std::vector<std::string> readLines(const std::filesystem::path& path)
+    {
+        std::vector<std::string> lines;
+        std::ifstream in(path);
+        std::string line;
+        while (std::getline(in, line)) {
+            lines.push_back(line);
+        }
+        return lines;
+    }
+
+    std::vector<rush::Vec3f> randomPoints(size_t amount)
+    {
+        std::mt19937 random(7);
+        std::uniform_real_distribution<float> coordinate(-100.0f, 100.0f);
+        std::vector<rush::Vec3f> points;
+        points.reserve(amount);
+        for (size_t i = 0; i < amount; ++i) {
+            points.emplace_back(coordinate(random), coordinate(random), coordinate(random));
+        }
+        return points;
+    }
+
+    void closestNeurite(State& state, const std::vector<std::string>& lines, size_t amount)
+    {
+        auto dataset = loadSWC(lines);
+        auto morphology = getMorphology(*dataset, 0);
+        if (!morphology) {
+            return;
+        }
+
+        auto points = randomPoints(amount);
+        state.setItemsPerIteration(points.size());
+        if (amount == 1) {
+            state.run([&] { doNotOptimize(closestNeuriteToPosition(*dataset, *morphology.value(), points[0])); });
+        } else {
+            state.run([&] { doNotOptimize(closestNeuriteToPosition(*dataset, *morphology.value(), points)); });
+        }
+    }
+
+    void buildTree(State& state, const std::vector<std::string>& lines)
+    {
+        auto dataset = loadSWC(lines);
+        auto morphology = getMorphology(*dataset, 0);
+        if (!morphology) {
+            return;
+        }
+
+        state.setItemsPerIteration(morphology.value()->getNeuritesAmount());
+        state.run([&] {
+            MorphologyTree tree(morphology.value(), *dataset);
+            doNotOptimize(tree);
+        });
+    }
+} // namespace
+
+MINDSET_BENCHMARK("morphology/closest-neurite/test.swc/1")
+{
+    closestNeurite(state, readLines(getDataPath("test.swc")), 1);
+}
+
+MINDSET_BENCHMARK("morphology/closest-neurite/test.swc/1k")
+{
+    closestNeurite(state, readLines(getDataPath("test.swc")), 1'000);
+}
+
+MINDSET_BENCHMARK("morphology/closest-neurite/synthetic-10k/1k")
+{
+    closestNeurite(state, generateSWC(10'000), 1'000);
+}
+
+MINDSET_BENCHMARK("morphology/tree/test.swc")
+{
+    buildTree(state, readLines(getDataPath("test.swc")));
+}
+
+MINDSET_BENCHMARK("morphology/tree/synthetic-100k")
+{
+    buildTree(state, generateSWC(100'000));
+}
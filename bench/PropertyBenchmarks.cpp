@@ -0,0 +1,144 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include "Benchmark.h"
+
+#include <mindset/Dataset.h>
+#include <mindset/Neurite.h>
+#include <mindset/Properties.h>
+
+using namespace mindset;
+using namespace mindset::bench;
+
+namespace
+{
+    constexpr UID PROPERTIES = 16;
+
+    Neurite createNeurite()
+    {
+        Neurite neurite(0);
+        for (UID uid = 0; uid < PROPERTIES; ++uid) {
+            neurite.setProperty(uid, static_cast<float>(uid));
+        }
+        return neurite;
+    }
+
+    std::vector<Neurite> createContextualizedNeurites(Dataset& dataset, size_t amount)
+    {
+        std::vector<Neurite> neurites;
+        neurites.reserve(amount);
+        for (size_t i = 0; i < amount; ++i) {
+            auto& neurite = neurites.emplace_back(static_cast<UID>(i));
+            auto contextualized = neurite | dataset;
+            (void) contextualized.setProperty(PROPERTY_KEY_RADIUS, static_cast<float>(i));
+            (void) contextualized.setProperty(PROPERTY_KEY_POSITION, rush::Vec3f(static_cast<float>(i)));
+            (void) contextualized.setProperty(PROPERTY_KEY_NEURITE_TYPE, NeuriteType::BASAL_DENDRITE);
+        }
+        return neurites;
+    }
+} // namespace
+
+MINDSET_BENCHMARK("properties/get")
+{
+    auto neurite = createNeurite();
+    state.setItemsPerIteration(PROPERTIES);
+    state.run([&] {
+        float total = 0.0f;
+        for (UID uid = 0; uid < PROPERTIES; ++uid) {
+            total += neurite.getProperty<float>(uid).value_or(0.0f);
+        }
+        doNotOptimize(total);
+    });
+}
+
+MINDSET_BENCHMARK("properties/get-ptr")
+{
+    auto neurite = createNeurite();
+    state.setItemsPerIteration(PROPERTIES);
+    state.run([&] {
+        float total = 0.0f;
+        for (UID uid = 0; uid < PROPERTIES; ++uid) {
+            if (auto value = neurite.getPropertyPtr<float>(uid)) {
+                total += *value.value();
+            }
+        }
+        doNotOptimize(total);
+    });
+}
+
+MINDSET_BENCHMARK("properties/set")
+{
+    auto neurite = createNeurite();
+    state.setItemsPerIteration(PROPERTIES);
+    state.run([&] {
+        for (UID uid = 0; uid < PROPERTIES; ++uid) {
+            neurite.setProperty(uid, static_cast<float>(uid) * 2.0f);
+        }
+        doNotOptimize(neurite);
+    });
+}
+
+MINDSET_BENCHMARK("properties/define")
+{
+    std::vector<std::string> names;
+    for (UID uid = 0; uid < PROPERTIES; ++uid) {
+        names.push_back("bench:property-" + std::to_string(uid));
+    }
+    Properties properties;
+    state.setItemsPerIteration(PROPERTIES);
+    state.run([&] {
+        UID total = 0;
+        for (auto& name : names) {
+            total += properties.defineProperty(name);
+        }
+        doNotOptimize(total);
+    });
+}
+
+MINDSET_BENCHMARK("properties/contextualized/by-name")
+{
+    Dataset dataset;
+    auto neurites = createContextualizedNeurites(dataset, 1'000);
+    state.setItemsPerIteration(neurites.size());
+    state.run([&] {
+        float total = 0.0f;
+        for (auto& neurite : neurites) {
+            auto contextualized = neurite | dataset;
+            total += contextualized.getProperty<float>(PROPERTY_RADIUS).value_or(0.0f);
+            total += contextualized.getProperty<rush::Vec3f>(PROPERTY_POSITION).value_or(rush::Vec3f()).x();
+        }
+        doNotOptimize(total);
+    });
+}
+
+MINDSET_BENCHMARK("properties/contextualized/by-key")
+{
+    Dataset dataset;
+    auto neurites = createContextualizedNeurites(dataset, 1'000);
+    state.setItemsPerIteration(neurites.size());
+    state.run([&] {
+        float total = 0.0f;
+        for (auto& neurite : neurites) {
+            auto contextualized = neurite | dataset;
+            total += contextualized.getRadius().value_or(0.0f);
+            total += contextualized.getPosition().value_or(rush::Vec3f()).x();
+        }
+        doNotOptimize(total);
+    });
+}
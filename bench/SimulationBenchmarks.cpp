@@ -0,0 +1,142 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include "Benchmark.h"
+
+#include <random>
+
+#include <mindset/generator/DatasetGenerator.h>
+#include <mindset/simulation/LIFSimulator.h>
+#include <mindset/simulation/SpikePropagation.h>
+
+using namespace mindset;
+using namespace mindset::bench;
+using namespace std::chrono_literals;
+
+namespace
+{
+    void generateDataset(Dataset& dataset, size_t neurons, size_t synapses)
+    {
+        DatasetGeneratorSettings settings;
+        settings.neurons = neurons;
+        settings.morphologies = false;
+        settings.synapses.amount = synapses;
+        settings.synapses.positions = false;
+        settings.activity.spikes = false;
+
+        DatasetGenerator(settings).generate(dataset);
+    }
+
+    EventSequence<std::monostate> generateSpikes(size_t neurons, size_t amount, std::chrono::nanoseconds duration)
+    {
+        std::mt19937 random(42);
+        std::uniform_int_distribution<UID> neuron(0, static_cast<UID>(neurons - 1));
+        std::uniform_int_distribution<int64_t> time(0, duration.count());
+        EventSequence<std::monostate> spikes;
+        for (size_t i = 0; i < amount; ++i) {
+            spikes.addEvent(neuron(random), std::chrono::nanoseconds(time(random)), std::monostate());
+        }
+        return spikes;
+    }
+
+    void runLIFScaling(State& state, size_t threads)
+    {
+        Dataset dataset;
+        generateDataset(dataset, 50'000, 1'000'000);
+
+        LIFSimulationSettings settings;
+        settings.defaultWeight = 0.5f;
+        settings.backgroundRate = 1'000.0;
+        settings.backgroundWeight = 4.0f;
+        settings.threads = threads;
+        LIFSimulator simulator(dataset, settings);
+
+        // One item per neuron and timestep. Runs are short, so thread startup costs show up here.
+        state.setItemsPerIteration(50'000 * 200);
+        state.run([&] {
+            simulator.run(20ms);
+            doNotOptimize(simulator.getSpikesAmount());
+        });
+    }
+} // namespace
+
+MINDSET_BENCHMARK("simulation/propagation/5k-spikes-1M-synapses")
+{
+    Dataset dataset;
+    generateDataset(dataset, 1'000, 1'000'000);
+    SpikePropagator propagator(dataset, {.defaultDelay = 2ms, .window = 5ms});
+    auto spikes = generateSpikes(1'000, 5'000, 1s);
+
+    state.setItemsPerIteration(5'000'000);
+    state.run([&] {
+        size_t arrivals = 0;
+        propagator.propagate(spikes, [&](std::span<const SpikeArrival> window) { arrivals += window.size(); });
+        doNotOptimize(arrivals);
+    });
+}
+
+MINDSET_BENCHMARK("simulation/propagation/input-grid/5k-spikes-1M-synapses")
+{
+    Dataset dataset;
+    generateDataset(dataset, 1'000, 1'000'000);
+    SpikePropagator propagator(dataset, {.defaultDelay = 2ms, .window = 5ms});
+    auto spikes = generateSpikes(1'000, 5'000, 1s);
+
+    state.setItemsPerIteration(5'000'000);
+    state.run([&] { doNotOptimize(propagator.computeInput(spikes, 1ms).getTimestepsAmount()); });
+}
+
+MINDSET_BENCHMARK("simulation/lif/100ms-10k-neurons-1M-synapses")
+{
+    Dataset dataset;
+    generateDataset(dataset, 10'000, 1'000'000);
+
+    LIFSimulationSettings settings;
+    settings.defaultWeight = 0.5f;
+    settings.backgroundRate = 1'000.0;
+    settings.backgroundWeight = 4.0f;
+    LIFSimulator simulator(dataset, settings);
+
+    // One item per neuron and timestep.
+    state.setItemsPerIteration(10'000 * 1'000);
+    state.run([&] {
+        simulator.run(100ms);
+        doNotOptimize(simulator.getSpikesAmount());
+    });
+}
+
+MINDSET_BENCHMARK("simulation/lif/scaling/20ms-50k-neurons/1-thread")
+{
+    runLIFScaling(state, 1);
+}
+
+MINDSET_BENCHMARK("simulation/lif/scaling/20ms-50k-neurons/2-threads")
+{
+    runLIFScaling(state, 2);
+}
+
+MINDSET_BENCHMARK("simulation/lif/scaling/20ms-50k-neurons/4-threads")
+{
+    runLIFScaling(state, 4);
+}
+
+MINDSET_BENCHMARK("simulation/lif/scaling/20ms-50k-neurons/8-threads")
+{
+    runLIFScaling(state, 8);
+}
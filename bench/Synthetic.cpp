@@ -0,0 +1,96 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include "Synthetic.h"
+
+#include <algorithm>
+#include <fstream>
+#include <random>
+#include <sstream>
+
+#include <mindset/loader/SWCLoader.h>
+
+namespace mindset::bench
+{
+    std::filesystem::path getDataPath(const std::string& name)
+    {
+        return std::filesystem::current_path() / "data" / name;
+    }
+
+    std::vector<std::string> generateSWC(size_t points, uint32_t seed)
+    {
+        std::mt19937 random(seed);
+        std::uniform_real_distribution<float> step(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> chance(0.0f, 1.0f);
+
+        struct Point
+        {
+            float x, y, z, radius;
+        };
+
+        std::vector<Point> generated;
+        generated.reserve(points + 1);
+        generated.push_back({0.0f, 0.0f, 0.0f, 8.0f});
+
+        std::vector<std::string> lines;
+        lines.reserve(points + 1);
+        lines.emplace_back("1 1 0 0 0 8 -1");
+
+        // Each point continues the last one, starting a new branch from a random point from time to time.
+        size_t parent = 0;
+        for (size_t i = 1; i <= points; ++i) {
+            if (i == 1 || chance(random) < 0.02f) {
+                parent = std::uniform_int_distribution<size_t>(0, generated.size() - 1)(random);
+            }
+            auto& from = generated[parent];
+            Point point = {from.x + step(random) * 2.0f, from.y + step(random) * 2.0f + 1.0f,
+                           from.z + step(random) * 2.0f, std::max(0.1f, from.radius * 0.995f)};
+            if (parent == 0) {
+                point.radius = 1.5f;
+            }
+            generated.push_back(point);
+
+            std::ostringstream line;
+            line << i + 1 << ' ' << (i % 2 == 0 ? 3 : 2) << ' ' << point.x << ' ' << point.y << ' ' << point.z << ' '
+                 << point.radius << ' ' << parent + 1;
+            lines.push_back(line.str());
+            parent = i;
+        }
+
+        return lines;
+    }
+
+    std::filesystem::path writeTemporaryFile(const std::string& name, const std::vector<std::string>& lines)
+    {
+        auto path = std::filesystem::temp_directory_path() / name;
+        std::ofstream out(path);
+        for (auto& line : lines) {
+            out << line << '\n';
+        }
+        return path;
+    }
+
+    std::unique_ptr<Dataset> loadSWC(const std::vector<std::string>& lines)
+    {
+        auto dataset = std::make_unique<Dataset>();
+        SWCLoader loader(LoaderCreateInfo(), lines);
+        loader.load(*dataset);
+        return dataset;
+    }
+} // namespace mindset::bench
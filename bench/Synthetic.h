@@ -0,0 +1,55 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#ifndef MINDSET_BENCH_SYNTHETIC_H
+#define MINDSET_BENCH_SYNTHETIC_H
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <mindset/Dataset.h>
+
+namespace mindset::bench
+{
+    /**
+     * Returns the path of a file inside the data folder copied next to the executable.
+     */
+    std::filesystem::path getDataPath(const std::string& name);
+
+    /**
+     * Generates the lines of an SWC file with a soma and a random branching tree of the given amount of points.
+     * The same seed always generates the same file.
+     */
+    std::vector<std::string> generateSWC(size_t points, uint32_t seed = 42);
+
+    /**
+     * Writes the given lines into a temporary file and returns its path.
+     */
+    std::filesystem::path writeTemporaryFile(const std::string& name, const std::vector<std::string>& lines);
+
+    /**
+     * Loads the given SWC lines into a new dataset. The neuron has the UID 0.
+     */
+    std::unique_ptr<Dataset> loadSWC(const std::vector<std::string>& lines);
+} // namespace mindset::bench
+
+#endif //MINDSET_BENCH_SYNTHETIC_H
@@ -0,0 +1,168 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <unordered_map>
+
+#include "Benchmark.h"
+
+using namespace mindset::bench;
+
+namespace
+{
+    void printUsage()
+    {
+        std::cout << "Usage: mindset-bench [options]\n"
+                  << "  --filter <text>       Only runs the benchmarks whose name contains the text.\n"
+                  << "  --list                Lists the benchmarks and exits.\n"
+                  << "  --samples <n>         Amount of measured samples per benchmark (default 10).\n"
+                  << "  --min-time <ms>       Minimum duration of each sample in milliseconds (default 20).\n"
+                  << "  --json <path>         Writes the results as JSON.\n"
+                  << "  --baseline <path>     Compares the results against a JSON file written by --json.\n"
+                  << "  --threshold <pct>     Slowdown percentage reported as a regression (default 10).\n"
+                  << "  --fail-on-regression  Exits with an error code if any regression is found.\n";
+    }
+
+    std::string formatTime(double ns)
+    {
+        std::ostringstream out;
+        out << std::fixed << std::setprecision(2);
+        if (ns >= 1e9) {
+            out << ns / 1e9 << " s";
+        } else if (ns >= 1e6) {
+            out << ns / 1e6 << " ms";
+        } else if (ns >= 1e3) {
+            out << ns / 1e3 << " us";
+        } else {
+            out << ns << " ns";
+        }
+        return out.str();
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    BenchmarkSettings settings;
+    std::string filter;
+    std::string jsonPath;
+    std::string baselinePath;
+    double threshold = 10.0;
+    bool list = false;
+    bool failOnRegression = false;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--filter" && hasValue) {
+            filter = argv[++i];
+        } else if (arg == "--list") {
+            list = true;
+        } else if (arg == "--samples" && hasValue) {
+            settings.samples = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--min-time" && hasValue) {
+            settings.minSampleTime = std::chrono::milliseconds(std::strtoll(argv[++i], nullptr, 10));
+        } else if (arg == "--json" && hasValue) {
+            jsonPath = argv[++i];
+        } else if (arg == "--baseline" && hasValue) {
+            baselinePath = argv[++i];
+        } else if (arg == "--threshold" && hasValue) {
+            threshold = std::strtod(argv[++i], nullptr);
+        } else if (arg == "--fail-on-regression") {
+            failOnRegression = true;
+        } else {
+            printUsage();
+            return arg == "--help" || arg == "-h" ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+
+    std::unordered_map<std::string, BenchmarkResult> baseline;
+    if (!baselinePath.empty()) {
+        std::vector<BenchmarkResult> results;
+        if (!readJSON(baselinePath, results)) {
+            std::cerr << "Couldn't read baseline " << baselinePath << std::endl;
+            return EXIT_FAILURE;
+        }
+        for (auto& result : results) {
+            baseline[result.name] = result;
+        }
+    }
+
+    // Registration order depends on the linker. Sorting keeps the output stable between builds.
+    auto benchmarks = getBenchmarks();
+    std::ranges::sort(benchmarks, {}, &BenchmarkEntry::name);
+
+    std::vector<BenchmarkResult> results;
+    size_t regressions = 0;
+
+    for (auto& [name, function] : benchmarks) {
+        if (!filter.empty() && name.find(filter) == std::string::npos) {
+            continue;
+        }
+        if (list) {
+            std::cout << name << std::endl;
+            continue;
+        }
+
+        BenchmarkResult result;
+        result.name = name;
+        State state(settings, result);
+        function(state);
+        if (!state.hasRun()) {
+            std::cerr << name << ": skipped" << std::endl;
+            continue;
+        }
+
+        std::cout << std::left << std::setw(48) << name << std::right << std::setw(12) << formatTime(result.medianNs)
+                  << "  +- " << std::setw(10) << formatTime(result.stddevNs);
+        if (result.itemsPerSecond > 0.0) {
+            std::cout << std::setw(14) << std::fixed << std::setprecision(0) << result.itemsPerSecond << " items/s";
+        }
+
+        if (auto it = baseline.find(name); it != baseline.end() && it->second.medianNs > 0.0) {
+            double change = (result.medianNs / it->second.medianNs - 1.0) * 100.0;
+            std::cout << "  " << std::showpos << std::fixed << std::setprecision(1) << change << "%" << std::noshowpos;
+            if (change > threshold) {
+                std::cout << " REGRESSION";
+                ++regressions;
+            }
+        }
+        std::cout << std::endl;
+
+        results.push_back(std::move(result));
+    }
+
+    if (list) {
+        return EXIT_SUCCESS;
+    }
+
+    if (!jsonPath.empty() && !writeJSON(jsonPath, results)) {
+        std::cerr << "Couldn't write " << jsonPath << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (!baseline.empty()) {
+        std::cout << regressions << " regression(s) over " << threshold << "%" << std::endl;
+    }
+
+    return failOnRegression && regressions > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -34,6 +34,23 @@ namespace mindset
     {
       public:
         explicit Activity(UID uid);
+
+        /**
+         * Constructs an activity whose properties are allocated using the given allocator.
+         */
+        Activity(UID uid, const allocator_type& allocator);
+
+        Activity(const Activity& other) = default;
+
+        Activity(Activity&& other) = default;
+
+        Activity(const Activity& other, const allocator_type& allocator);
+
+        Activity(Activity&& other, const allocator_type& allocator);
+
+        Activity& operator=(const Activity& other) = default;
+
+        Activity& operator=(Activity&& other) = default;
     };
 
 } // namespace mindset
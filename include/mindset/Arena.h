@@ -0,0 +1,118 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+#include <mutex>
+
+namespace mindset
+{
+    /**
+     * A thread-safe monotonic memory resource.
+     *
+     * Memory is requested to the upstream resource in big blocks and handed out sequentially.
+     * Deallocations are no-ops: the memory is only returned to the upstream resource
+     * when the arena is released or destroyed.
+     * This makes the destruction of millions of small objects (hash nodes, properties, neurites...)
+     * almost free and avoids fragmenting the heap.
+     *
+     * Allocations can be done concurrently from several threads, allowing loaders to build
+     * their elements in parallel directly inside the arena.
+     * Allocations bump the offset of the current block with a compare-and-swap:
+     * the mutex is only taken when the current block is exhausted and a new one must be requested.
+     */
+    class Arena : public std::pmr::memory_resource
+    {
+        struct Block
+        {
+            Block* next;
+            /// The size of the allocation holding the block, including this header.
+            size_t size;
+            /// The amount of bytes available after the header.
+            size_t capacity;
+            std::atomic<size_t> used;
+        };
+
+        static constexpr size_t HEADER_SIZE =
+            (sizeof(Block) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+
+        std::pmr::memory_resource* _upstream;
+        size_t _initialSize;
+
+        std::mutex _mutex;
+        Block* _blocks;
+        size_t _nextSize;
+
+        std::atomic<Block*> _current;
+        std::atomic<size_t> _allocatedBytes;
+
+        static void* tryAllocate(Block* block, size_t bytes, size_t alignment);
+
+        void refill(Block* exhausted, size_t bytes, size_t alignment);
+
+      protected:
+        void* do_allocate(size_t bytes, size_t alignment) override;
+
+        void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+      public:
+        /// The size of the first block requested to the upstream resource.
+        static constexpr size_t DEFAULT_INITIAL_SIZE = 1 << 20;
+
+        /// The size at which blocks stop growing, unless the initial size is bigger.
+        /// Bigger allocations still get a block of their own.
+        static constexpr size_t MAX_BLOCK_SIZE = 64 << 20;
+
+        /**
+         * Creates an arena.
+         * @param initialSize The size of the first block.
+         * Following blocks grow geometrically up to MAX_BLOCK_SIZE.
+         * @param upstream The resource providing the blocks.
+         */
+        explicit Arena(size_t initialSize = DEFAULT_INITIAL_SIZE,
+                       std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+
+        ~Arena() override;
+
+        Arena(const Arena&) = delete;
+
+        Arena& operator=(const Arena&) = delete;
+
+        /**
+         * Returns all blocks to the upstream resource.
+         * All memory allocated by this arena becomes invalid:
+         * the objects using it must have been destroyed or must never be accessed again.
+         * This method must not be called while other threads are allocating.
+         */
+        void release();
+
+        /**
+         * Returns the amount of bytes allocated since the creation or the last release of the arena.
+         */
+        [[nodiscard]] size_t getAllocatedBytes() const;
+    };
+} // namespace mindset
+
+#endif //ARENA_H
@@ -20,6 +20,7 @@
 #ifndef CIRCUIT_H
 #define CIRCUIT_H
 
+#include <memory_resource>
 #include <ranges>
 #include <unordered_map>
 
@@ -38,20 +39,32 @@ namespace mindset
      */
     class Circuit : public Versioned, public MutexHolder
     {
-        std::unordered_map<UID, Synapse> _synapses;
-        std::unordered_multimap<UID, UID> _preSynapses;
-        std::unordered_multimap<UID, UID> _postSynapses;
+        std::pmr::unordered_map<UID, Synapse> _synapses;
+        std::pmr::unordered_multimap<UID, UID> _preSynapses;
+        std::pmr::unordered_multimap<UID, UID> _postSynapses;
 
         hey::Observable<Synapse*> _synapseAddedEvent;
         hey::Observable<UID> _synapseRemovedEvent;
         hey::Observable<void*> _clearEvent;
 
       public:
+        using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
         /**
          * Constructs an empty Circuit.
          */
         Circuit();
 
+        /**
+         * Constructs an empty Circuit whose synapses and lookup tables are allocated using the given allocator.
+         */
+        explicit Circuit(const allocator_type& allocator);
+
+        /**
+         * Returns the allocator used by the synapses and the lookup tables.
+         */
+        [[nodiscard]] allocator_type getAllocator() const;
+
         /**
          * Adds a single synapse to the circuit.
          * @param synapse The synapse to add.
@@ -138,7 +151,8 @@ namespace mindset
         {
             auto [begin, end] = _preSynapses.equal_range(uid);
             auto range = std::ranges::subrange(begin, end);
-            return range | std::views::transform([&](const auto& pair) -> Synapse& { return _synapses[pair.second]; });
+            return range |
+                   std::views::transform([&](const auto& pair) -> Synapse& { return _synapses.at(pair.second); });
         }
 
         /**
@@ -151,7 +165,7 @@ namespace mindset
             auto [begin, end] = _preSynapses.equal_range(uid);
             auto range = std::ranges::subrange(begin, end);
             return range |
-                   std::views::transform([&](const auto& pair) -> const Synapse& { return _synapses[pair.second]; });
+                   std::views::transform([&](const auto& pair) -> const Synapse& { return _synapses.at(pair.second); });
         }
 
         /**
@@ -163,7 +177,8 @@ namespace mindset
         {
             auto [begin, end] = _postSynapses.equal_range(uid);
             auto range = std::ranges::subrange(begin, end);
-            return range | std::views::transform([&](const auto& pair) -> Synapse* { return &_synapses[pair.second]; });
+            return range |
+                   std::views::transform([&](const auto& pair) -> Synapse* { return &_synapses.at(pair.second); });
         }
 
         /**
@@ -175,8 +190,8 @@ namespace mindset
         {
             auto [begin, end] = _postSynapses.equal_range(uid);
             auto range = std::ranges::subrange(begin, end);
-            return range |
-                   std::views::transform([&](const auto& pair) -> const Synapse* { return &_synapses[pair.second]; });
+            return range | std::views::transform(
+                               [&](const auto& pair) -> const Synapse* { return &_synapses.at(pair.second); });
         }
     };
 } // namespace mindset
@@ -21,6 +21,8 @@
 #ifndef CONTEXT_H
 #define CONTEXT_H
 
+#include <mindset/Properties.h>
+
 namespace mindset
 {
 
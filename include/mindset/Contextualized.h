@@ -59,6 +59,29 @@ namespace mindset
             return _context->getProperties().defineProperty(name);
         }
 
+        template<typename T>
+        std::optional<UID> fetchPropertyId(const PropertyKey<T>& key, bool defineIfNotFound) const
+        {
+            if (std::is_const_v<C> || !defineIfNotFound) {
+                return _context->getProperties().getPropertyUID(key);
+            }
+            return _context->getProperties().defineProperty(key);
+        }
+
+        /**
+         * Uses the typed key if the requested type matches the key's type.
+         * Otherwise, falls back to the name lookup.
+         */
+        template<typename T, typename K>
+        std::optional<T> getDefaultProperty(const PropertyKey<K>& key, const std::string& name) const
+        {
+            if constexpr (std::is_same_v<T, K>) {
+                return getProperty(key);
+            } else {
+                return getProperty<T>(name);
+            }
+        }
+
       public:
         Contextualized(Holder* holder, C* context) :
             _holder(holder),
@@ -110,6 +133,56 @@ namespace mindset
             return std::optional<T>(*v);
         }
 
+        /**
+         * Sets the value of the property of the given key.
+         * The property is defined in the context if needed.
+         * @param key Key of the property.
+         * @param value Value of the property.
+         */
+        template<typename T>
+        [[nodiscard]] std::optional<ContextualizedError> setProperty(const PropertyKey<T>& key,
+                                                                     std::type_identity_t<T> value) const
+        {
+            if constexpr (std::is_const_v<Holder>) {
+                return ContextualizedError::HOLDER_IS_CONST;
+            } else {
+                if (auto propId = fetchPropertyId(key, true); propId.has_value()) {
+                    _holder->setProperty(propId.value(), std::move(value));
+                    return {};
+                }
+                return ContextualizedError::CONTEXT_IS_CONST;
+            }
+        }
+
+        /**
+         * Returns a pointer to the value of the property of the given key, without copying it.
+         * The result is empty if the property is not defined, not present or has another type.
+         * @param key Key of the property.
+         */
+        template<typename T>
+        [[nodiscard]] auto getPropertyPtr(const PropertyKey<T>& key) const
+        {
+            using Pointer = decltype(_holder->template getPropertyPtr<T>(UID()));
+            if (auto propId = fetchPropertyId(key, false); propId.has_value()) {
+                return _holder->template getPropertyPtr<T>(propId.value());
+            }
+            return Pointer();
+        }
+
+        /**
+         * Returns a copy of the value of the property of the given key.
+         * The result is empty if the property is not defined, not present or has another type.
+         * @param key Key of the property.
+         */
+        template<typename T>
+        [[nodiscard]] std::optional<T> getProperty(const PropertyKey<T>& key) const
+        {
+            if (auto ptr = getPropertyPtr(key); ptr.has_value()) {
+                return *ptr.value();
+            }
+            return {};
+        }
+
         Holder* operator->() const
         {
             return _holder;
@@ -120,55 +193,55 @@ namespace mindset
         template<typename T = UID>
         std::optional<T> getParent()
         {
-            return getProperty<T>(PROPERTY_PARENT);
+            return getDefaultProperty<T>(PROPERTY_KEY_PARENT, PROPERTY_PARENT);
         }
 
         template<typename T = float>
         std::optional<T> getRadius()
         {
-            return getProperty<T>(PROPERTY_RADIUS);
+            return getDefaultProperty<T>(PROPERTY_KEY_RADIUS, PROPERTY_RADIUS);
         }
 
         template<typename T = rush::Vec3f>
         std::optional<T> getPosition()
         {
-            return getProperty<T>(PROPERTY_POSITION);
+            return getDefaultProperty<T>(PROPERTY_KEY_POSITION, PROPERTY_POSITION);
         }
 
         template<typename T = NeuriteType>
         std::optional<T> getNeuriteType()
         {
-            return getProperty<T>(PROPERTY_NEURITE_TYPE);
+            return getDefaultProperty<T>(PROPERTY_KEY_NEURITE_TYPE, PROPERTY_NEURITE_TYPE);
         }
 
         template<typename T = NeuronTransform>
         std::optional<T> getTransform()
         {
-            return getProperty<T>(PROPERTY_TRANSFORM);
+            return getDefaultProperty<T>(PROPERTY_KEY_TRANSFORM, PROPERTY_TRANSFORM);
         }
 
         template<typename T = UID>
         std::optional<T> getColumn()
         {
-            return getProperty<T>(PROPERTY_COLUMN);
+            return getDefaultProperty<T>(PROPERTY_KEY_COLUMN, PROPERTY_COLUMN);
         }
 
         template<typename T = UID>
         std::optional<T> getMiniColumn()
         {
-            return getProperty<T>(PROPERTY_MINI_COLUMN);
+            return getDefaultProperty<T>(PROPERTY_KEY_MINI_COLUMN, PROPERTY_MINI_COLUMN);
         }
 
         template<typename T = UID>
         std::optional<T> getLayer()
         {
-            return getProperty<T>(PROPERTY_LAYER);
+            return getDefaultProperty<T>(PROPERTY_KEY_LAYER, PROPERTY_LAYER);
         }
 
         template<typename T = std::string>
         std::optional<T> getName()
         {
-            return getProperty<T>(PROPERTY_NAME);
+            return getDefaultProperty<T>(PROPERTY_KEY_NAME, PROPERTY_NAME);
         }
     };
 
@@ -20,14 +20,19 @@
 #ifndef DATASET_H
 #define DATASET_H
 
+#include <memory>
+#include <memory_resource>
+#include <mutex>
 #include <optional>
 #include <unordered_map>
 #include <hey/Observable.h>
 
+#include <mindset/Arena.h>
 #include <mindset/Contextualized.h>
 #include <mindset/Versioned.h>
 #include <mindset/Neuron.h>
 #include <mindset/Node.h>
+#include <mindset/HierarchyIndex.h>
 #include <mindset/UID.h>
 #include <mindset/Properties.h>
 #include <mindset/Circuit.h>
@@ -37,6 +42,18 @@
 
 namespace mindset
 {
+    /**
+     * Defines where the contents of a Dataset are allocated.
+     */
+    enum class DatasetMemory
+    {
+        /// Contents are allocated using the default memory resource.
+        HEAP,
+        /// Contents are allocated from an Arena owned by the dataset.
+        /// Removed elements are only reclaimed when the dataset is cleared or destroyed.
+        ARENA
+    };
+
     /**
      * The Dataset class serves as the primary container for scene data within the Mindset library.
      *
@@ -45,12 +62,20 @@ namespace mindset
      */
     class Dataset final : public Versioned, public Context, public MutexHolder
     {
-        std::unordered_map<UID, Neuron> _neurons;
+        // Declared first: the arena must outlive all the containers using it.
+        std::unique_ptr<Arena> _arena;
+
+        std::pmr::unordered_map<UID, Neuron> _neurons;
         Properties _properties;
         Circuit _circuit;
         std::optional<Node> _hierarchy;
+        uint64_t _hierarchyGeneration;
+
+        std::unique_ptr<std::mutex> _hierarchyIndexMutex;
+        mutable std::shared_ptr<const HierarchyIndex> _hierarchyIndex;
+        mutable uint64_t _hierarchyIndexGeneration;
 
-        std::unordered_map<UID, Activity> _activities;
+        std::pmr::unordered_map<UID, Activity> _activities;
 
         hey::Observable<Neuron*> _neuronAddedEvent;
         hey::Observable<UID> _neuronRemovedEvent;
@@ -59,11 +84,41 @@ namespace mindset
         hey::Observable<void*> _clearEvent;
 
     public:
+        using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
         /**
          * Constructs an empty Dataset object.
          */
         Dataset();
 
+        /**
+         * Constructs an empty Dataset whose contents are allocated as defined by the given mode.
+         *
+         * When using DatasetMemory::ARENA, the neurons, synapses, activities and neurites inserted into the dataset
+         * are allocated from an arena owned by the dataset. Clearing or destroying the dataset releases
+         * all that memory at once.
+         */
+        explicit Dataset(DatasetMemory memory);
+
+        /**
+         * Constructs an empty Dataset whose contents are allocated from the given memory resource.
+         * The resource must outlive the dataset and must be thread-safe if loaders use it concurrently.
+         */
+        explicit Dataset(std::pmr::memory_resource* resource);
+
+        /**
+         * Returns the allocator used by the contents of this dataset.
+         *
+         * Elements built with this allocator (see Neuron, Synapse and Activity) are moved into the dataset
+         * without copying their properties.
+         */
+        [[nodiscard]] allocator_type getAllocator() const;
+
+        /**
+         * Returns the arena owned by this dataset, if it has one.
+         */
+        [[nodiscard]] std::optional<const Arena*> getArena() const;
+
         /**
          * Reserves space for a specified number of neurons to optimize insertion performance.
          * @param amount The number of neurons to reserve space for.
@@ -82,6 +137,14 @@ namespace mindset
          */
         std::pair<Neuron*, bool> addNeuron(Neuron neuron);
 
+        /**
+         * Adds multiple neurons to the dataset.
+         * Neurons whose UID is already present in the dataset are discarded.
+         * @param neurons A vector containing the neurons to add.
+         * @return The amount of neurons that were inserted.
+         */
+        size_t addNeurons(std::vector<Neuron> neurons);
+
         /**
          * Removes a neuron identified by its UID from the dataset.
          * @param uid The unique identifier of the neuron.
@@ -148,6 +211,20 @@ namespace mindset
          */
         Node* createHierarchy(UID uid, std::string type);
 
+        /**
+         * Returns a flattened index of the hierarchy.
+         *
+         * The index is built lazily and cached. It is rebuilt the next time this method is called
+         * after the hierarchy is modified or replaced.
+         * The returned index is immutable: it can be kept and used after the hierarchy changes,
+         * although it will not reflect those changes.
+         *
+         * This method can be called concurrently by several readers holding a read lock.
+         *
+         * @return The index, or nullptr if this dataset has no hierarchy.
+         */
+        [[nodiscard]] std::shared_ptr<const HierarchyIndex> getHierarchyIndex() const;
+
         /**
          * Returns the amount of activities inside this dataset.
          */
@@ -184,6 +261,9 @@ namespace mindset
         /**
          * Clears this dataset. This includes all neurons, synapses and hierarchy.
          * This method does not clear properties.
+         *
+         * If the dataset owns an arena, the arena is released: elements built with the allocator
+         * of this dataset that haven't been inserted into it become invalid.
          */
         void clear();
 
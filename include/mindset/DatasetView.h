@@ -0,0 +1,213 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#ifndef DATASETVIEW_H
+#define DATASETVIEW_H
+
+#include <concepts>
+#include <ranges>
+#include <vector>
+
+#include <mindset/Context.h>
+#include <mindset/Contextualized.h>
+#include <mindset/Dataset.h>
+#include <mindset/query/UIDSet.h>
+
+namespace mindset
+{
+    /**
+     * Types exposing neurons inside a property context, such as Dataset and DatasetView.
+     */
+    template<typename T>
+    concept DatasetLike = std::derived_from<T, Context> && requires(const T& t, UID uid) {
+        { t.getNeuronsAmount() } -> std::convertible_to<size_t>;
+        { t.getNeuron(uid) } -> std::convertible_to<std::optional<const Neuron*>>;
+        t.getNeurons();
+    };
+
+    /**
+     * A non-owning view of a subset of the neurons of a dataset and the synapses between them.
+     *
+     * Views don't copy neurons, synapses or properties: they store the selected UIDs and pointers to the neurons,
+     * and share the properties of the dataset, so Contextualized and the functions in Getters.h work with them.
+     * Synapses are gathered lazily from the circuit of the dataset.
+     *
+     * The view holds pointers to the dataset's neurons: it must not be used after the dataset removes neurons
+     * or is destroyed. The caller must hold a read lock on the dataset while using the view.
+     */
+    class DatasetView final : public Context
+    {
+        Dataset* _dataset;
+        UIDSet _uids;
+        std::vector<Neuron*> _neurons;
+
+      public:
+        /**
+         * Creates a view of the given neurons. UIDs not present in the dataset are ignored.
+         * @param dataset The dataset to view.
+         * @param neurons The UIDs of the selected neurons.
+         */
+        DatasetView(Dataset& dataset, UIDSet neurons);
+
+        /**
+         * Creates a view of all the neurons of the given dataset.
+         */
+        explicit DatasetView(Dataset& dataset);
+
+        [[nodiscard]] Dataset& getDataset();
+
+        [[nodiscard]] const Dataset& getDataset() const;
+
+        [[nodiscard]] Properties& getProperties() override;
+
+        [[nodiscard]] const Properties& getProperties() const override;
+
+        /**
+         * Returns the UIDs of the selected neurons, sorted.
+         */
+        [[nodiscard]] const UIDSet& getNeuronsUIDs() const;
+
+        /**
+         * Returns the number of selected neurons.
+         */
+        [[nodiscard]] size_t getNeuronsAmount() const;
+
+        /**
+         * Checks whether the given neuron is selected.
+         */
+        [[nodiscard]] bool contains(UID uid) const;
+
+        /**
+         * Returns the selected neuron with the given UID.
+         * Neurons present in the dataset but not selected are not returned.
+         */
+        [[nodiscard]] std::optional<Neuron*> getNeuron(UID uid);
+
+        /**
+         * Returns the selected neuron with the given UID.
+         * Neurons present in the dataset but not selected are not returned.
+         */
+        [[nodiscard]] std::optional<const Neuron*> getNeuron(UID uid) const;
+
+        /**
+         * Creates a view of the selected neurons that are also present in the given set.
+         */
+        [[nodiscard]] DatasetView subview(const UIDSet& neurons) const;
+
+        /**
+         * Returns a view to iterate over the selected neurons in a mutable context.
+         * The context of the neurons is this view.
+         */
+        [[nodiscard]] decltype(auto) getNeurons()
+        {
+            return _neurons | std::views::transform([this](Neuron* neuron) { return Contextualized(neuron, this); });
+        }
+
+        /**
+         * Returns a view to iterate over the selected neurons in a read-only context.
+         * The context of the neurons is this view.
+         */
+        [[nodiscard]] decltype(auto) getNeurons() const
+        {
+            return _neurons | std::views::transform([this](const Neuron* neuron) {
+                       return Contextualized(neuron, this);
+                   });
+        }
+
+        /**
+         * Returns a view to iterate over the selected neurons without context.
+         */
+        [[nodiscard]] decltype(auto) getNonContextualizedNeurons()
+        {
+            return _neurons | std::views::all;
+        }
+
+        /**
+         * Returns a view to iterate over the selected neurons without context.
+         */
+        [[nodiscard]] decltype(auto) getNonContextualizedNeurons() const
+        {
+            return _neurons | std::views::transform([](const Neuron* neuron) { return neuron; });
+        }
+
+        /**
+         * Returns a view to iterate over the synapses whose pre-synaptic neuron is selected.
+         */
+        [[nodiscard]] decltype(auto) getOutgoingSynapses()
+        {
+            Circuit& circuit = _dataset->getCircuit();
+            return _uids | std::views::transform([&circuit](UID uid) { return circuit.getPreSynapses(uid); }) |
+                   std::views::join | std::views::transform([](Synapse& synapse) { return &synapse; });
+        }
+
+        /**
+         * Returns a view to iterate over the synapses whose pre-synaptic neuron is selected.
+         */
+        [[nodiscard]] decltype(auto) getOutgoingSynapses() const
+        {
+            const Circuit& circuit = _dataset->getCircuit();
+            return _uids | std::views::transform([&circuit](UID uid) { return circuit.getPreSynapses(uid); }) |
+                   std::views::join | std::views::transform([](const Synapse& synapse) { return &synapse; });
+        }
+
+        /**
+         * Returns a view to iterate over the synapses whose post-synaptic neuron is selected.
+         */
+        [[nodiscard]] decltype(auto) getIncomingSynapses()
+        {
+            Circuit& circuit = _dataset->getCircuit();
+            return _uids | std::views::transform([&circuit](UID uid) { return circuit.getPostSynapses(uid); }) |
+                   std::views::join;
+        }
+
+        /**
+         * Returns a view to iterate over the synapses whose post-synaptic neuron is selected.
+         */
+        [[nodiscard]] decltype(auto) getIncomingSynapses() const
+        {
+            const Circuit& circuit = _dataset->getCircuit();
+            return _uids | std::views::transform([&circuit](UID uid) { return circuit.getPostSynapses(uid); }) |
+                   std::views::join;
+        }
+
+        /**
+         * Returns a view to iterate over the induced subcircuit:
+         * the synapses whose pre-synaptic and post-synaptic neurons are both selected.
+         */
+        [[nodiscard]] decltype(auto) getSynapses()
+        {
+            return getOutgoingSynapses() | std::views::filter([this](const Synapse* synapse) {
+                       return _uids.contains(synapse->getPostSynapticNeuron());
+                   });
+        }
+
+        /**
+         * Returns a view to iterate over the induced subcircuit:
+         * the synapses whose pre-synaptic and post-synaptic neurons are both selected.
+         */
+        [[nodiscard]] decltype(auto) getSynapses() const
+        {
+            return getOutgoingSynapses() | std::views::filter([this](const Synapse* synapse) {
+                       return _uids.contains(synapse->getPostSynapticNeuron());
+                   });
+        }
+    };
+} // namespace mindset
+
+#endif // DATASETVIEW_H
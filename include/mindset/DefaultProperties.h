@@ -23,6 +23,12 @@
 #include <string>
 #include <cstdint>
 
+#include <mindset/PropertyKey.h>
+#include <mindset/UID.h>
+#include <mindset/util/NeuronTransform.h>
+
+#include <rush/rush.h>
+
 namespace mindset
 {
 
@@ -66,6 +72,34 @@ namespace mindset
         UNSPECIFIED_NEURITE = 6,
         GLIA_PROCESSES = 7
     };
+
+    // Typed keys of the default properties whose value type is fixed.
+    // They share their names with the string constants above.
+
+    inline constexpr PropertyKey<UID> PROPERTY_KEY_PARENT("mindset:parent");
+    inline constexpr PropertyKey<float> PROPERTY_KEY_RADIUS("mindset:radius");
+    inline constexpr PropertyKey<rush::Vec3f> PROPERTY_KEY_POSITION("mindset:position");
+    inline constexpr PropertyKey<NeuriteType> PROPERTY_KEY_NEURITE_TYPE("mindset:neurite_type");
+    inline constexpr PropertyKey<NeuronTransform> PROPERTY_KEY_TRANSFORM("mindset:transform");
+    inline constexpr PropertyKey<UID> PROPERTY_KEY_COLUMN("mindset:column");
+    inline constexpr PropertyKey<UID> PROPERTY_KEY_MINI_COLUMN("mindset:mini_column");
+    inline constexpr PropertyKey<UID> PROPERTY_KEY_LAYER("mindset:layer");
+    inline constexpr PropertyKey<std::string> PROPERTY_KEY_NAME("mindset:name");
+    inline constexpr PropertyKey<std::string> PROPERTY_KEY_PATH("mindset:path");
+
+    inline constexpr PropertyKey<UID> PROPERTY_KEY_SYNAPSE_PRE_NEURITE("mindset:synapse_pre_neurite");
+    inline constexpr PropertyKey<UID> PROPERTY_KEY_SYNAPSE_POST_NEURITE("mindset:synapse_post_neurite");
+
+    inline constexpr PropertyKey<rush::Vec3f> PROPERTY_KEY_SYNAPSE_PRE_POSITION("mindset:synapse_pre_position");
+    inline constexpr PropertyKey<rush::Vec3f> PROPERTY_KEY_SYNAPSE_POST_POSITION("mindset:synapse_post_position");
+
+    inline constexpr PropertyKey<float> PROPERTY_KEY_SYNAPSE_DELAY("mindset:synapse_delay");
+    inline constexpr PropertyKey<float> PROPERTY_KEY_SYNAPSE_CONDUCTANCE("mindset:synapse_conductance");
+    inline constexpr PropertyKey<float> PROPERTY_KEY_SYNAPSE_UTILIZATION("mindset:synapse_utilization");
+    inline constexpr PropertyKey<float> PROPERTY_KEY_SYNAPSE_DEPRESSION("mindset:synapse_depression");
+    inline constexpr PropertyKey<float> PROPERTY_KEY_SYNAPSE_FACILITATION("mindset:synapse_facilitation");
+    inline constexpr PropertyKey<float> PROPERTY_KEY_SYNAPSE_DECAY("mindset:synapse_decay");
+    inline constexpr PropertyKey<float> PROPERTY_KEY_SYNAPSE_EFFICACY("mindset:synapse_efficacy");
 } // namespace mindset
 
 #endif // MINDSET_DEFAULTPARAMETERS_H
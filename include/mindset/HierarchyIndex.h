@@ -0,0 +1,167 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#ifndef HIERARCHYINDEX_H
+#define HIERARCHYINDEX_H
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <mindset/UID.h>
+
+namespace mindset
+{
+    class Node;
+
+    /**
+     * A node of a HierarchyIndex.
+     *
+     * All ranges are half-open and refer to the arrays of the index.
+     */
+    struct HierarchyIndexNode
+    {
+        /// The UID of the node.
+        UID uid;
+        /// The type of the node.
+        std::string type;
+        /// The depth of the node. The root has depth zero.
+        uint32_t depth;
+        /// The index of the parent node, or HierarchyIndex::NONE if this node is the root.
+        size_t parent;
+        /// The end of the subtree of this node. Nodes in [index, subtreeEnd) are this node and its descendants.
+        size_t subtreeEnd;
+        /// The first neuron of this node. Neurons of the node and its descendants are contiguous.
+        size_t neuronsBegin;
+        /// The end of the neurons directly associated with this node.
+        size_t ownNeuronsEnd;
+        /// The end of the neurons associated with this node or any of its descendants.
+        size_t neuronsEnd;
+    };
+
+    /**
+     * A compiled, read-only view of a Node hierarchy.
+     *
+     * Nodes are stored in depth-first order, so the subtree of a node is a contiguous range of nodes
+     * and the neurons of a subtree are a contiguous range of neurons.
+     * Children are visited in UID order and the neurons of each node are sorted,
+     * so the layout doesn't depend on hash map ordering.
+     *
+     * The index doesn't track the hierarchy it was built from.
+     * Use Dataset::getHierarchyIndex() to get an index that is rebuilt when the hierarchy changes.
+     */
+    class HierarchyIndex
+    {
+        std::vector<HierarchyIndexNode> _nodes;
+        std::vector<UID> _neurons;
+        std::unordered_map<UID, size_t> _neuronToNode;
+        uint64_t _version;
+
+      public:
+        static constexpr size_t NONE = std::numeric_limits<size_t>::max();
+
+        /**
+         * Builds the index of the hierarchy with the given root.
+         */
+        explicit HierarchyIndex(const Node& root);
+
+        /**
+         * Returns the version of the root node when this index was built.
+         */
+        [[nodiscard]] uint64_t getVersion() const;
+
+        /**
+         * Returns the amount of nodes of the hierarchy.
+         */
+        [[nodiscard]] size_t getNodesAmount() const;
+
+        /**
+         * Returns all nodes in depth-first order. The root is the first node.
+         */
+        [[nodiscard]] std::span<const HierarchyIndexNode> getNodes() const;
+
+        /**
+         * Returns the node at the given index.
+         */
+        [[nodiscard]] const HierarchyIndexNode& getNode(size_t index) const;
+
+        /**
+         * Returns the node at the given index and all its descendants.
+         */
+        [[nodiscard]] std::span<const HierarchyIndexNode> getSubtree(size_t index) const;
+
+        /**
+         * Returns the neurons of all nodes in depth-first order.
+         * A neuron present in several nodes appears once per node.
+         */
+        [[nodiscard]] std::span<const UID> getNeurons() const;
+
+        /**
+         * Returns the neurons associated with the given node or any of its descendants.
+         */
+        [[nodiscard]] std::span<const UID> getNeurons(size_t index) const;
+
+        /**
+         * Returns the neurons directly associated with the given node.
+         */
+        [[nodiscard]] std::span<const UID> getOwnNeurons(size_t index) const;
+
+        /**
+         * Returns the index of the node holding the given neuron.
+         * If the neuron is present in several nodes, the deepest one is returned.
+         */
+        [[nodiscard]] std::optional<size_t> getNodeOfNeuron(UID neuron) const;
+
+        /**
+         * Returns the index of the given node, if it was present when the index was built.
+         * The node is matched by the UIDs of the path from the root to it, so nodes that replaced
+         * a removed node with the same path are found too.
+         */
+        [[nodiscard]] std::optional<size_t> findNode(const Node* node) const;
+
+        /**
+         * Returns the index of the child of the given node that has the given UID.
+         */
+        [[nodiscard]] std::optional<size_t> findChild(size_t parent, UID uid) const;
+
+        /**
+         * Returns the indices of all the nodes with the given type, in depth-first order.
+         */
+        [[nodiscard]] std::vector<size_t> getNodesOfType(std::string_view type) const;
+
+        /**
+         * Returns the closest node with the given type, starting at the given node and walking to the root.
+         * This allows grouping neurons by layer, column or mini-column:
+         * getAncestorOfType(getNodeOfNeuron(neuron), "mindset:column").
+         */
+        [[nodiscard]] std::optional<size_t> getAncestorOfType(size_t index, std::string_view type) const;
+
+        /**
+         * Returns whether the node at the given index is the ancestor node or one of its descendants.
+         */
+        [[nodiscard]] bool isInSubtree(size_t index, size_t ancestor) const;
+    };
+} // namespace mindset
+
+#endif //HIERARCHYINDEX_H
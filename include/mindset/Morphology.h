@@ -37,7 +37,7 @@ namespace mindset
     class Morphology : public PropertyHolder, public MutexHolder
     {
         std::optional<Soma> _soma;
-        std::unordered_map<UID, Neurite> _neurites;
+        std::pmr::unordered_map<UID, Neurite> _neurites;
         std::optional<MorphologyTree> _tree;
 
       public:
@@ -46,6 +46,26 @@ namespace mindset
          */
         Morphology();
 
+        /**
+         * Constructs an empty Morphology whose properties and neurites are allocated using the given allocator.
+         *
+         * Morphologies are shared between neurons and may outlive the dataset that loaded them.
+         * Only use the allocator of a dataset if the morphology won't be used after the dataset is cleared.
+         */
+        explicit Morphology(const allocator_type& allocator);
+
+        Morphology(const Morphology& other) = default;
+
+        Morphology(Morphology&& other) = default;
+
+        Morphology(const Morphology& other, const allocator_type& allocator);
+
+        Morphology(Morphology&& other, const allocator_type& allocator);
+
+        Morphology& operator=(const Morphology& other) = default;
+
+        Morphology& operator=(Morphology&& other) = default;
+
         /**
          * Returns a mutable pointer to the soma if it exists.
          */
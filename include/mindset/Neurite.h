@@ -37,6 +37,23 @@ namespace mindset
          * @param uid Unique identifier for the neurite.
          */
         explicit Neurite(UID uid);
+
+        /**
+         * Constructs a Neurite whose properties are allocated using the given allocator.
+         */
+        Neurite(UID uid, const allocator_type& allocator);
+
+        Neurite(const Neurite& other) = default;
+
+        Neurite(Neurite&& other) = default;
+
+        Neurite(const Neurite& other, const allocator_type& allocator);
+
+        Neurite(Neurite&& other, const allocator_type& allocator);
+
+        Neurite& operator=(const Neurite& other) = default;
+
+        Neurite& operator=(Neurite&& other) = default;
     };
 } // namespace mindset
 
@@ -46,6 +46,27 @@ namespace mindset
          */
         explicit Neuron(UID uid, std::shared_ptr<Morphology> morphology = nullptr);
 
+        /**
+         * Constructs a Neuron whose properties are allocated using the given allocator.
+         * Use Dataset::getAllocator() to build the neuron directly inside the memory of a dataset.
+         * @param uid Unique identifier for the neuron.
+         * @param morphology Shared pointer to the morphology. It may be null.
+         * @param allocator The allocator of the properties.
+         */
+        Neuron(UID uid, std::shared_ptr<Morphology> morphology, const allocator_type& allocator);
+
+        Neuron(const Neuron& other) = default;
+
+        Neuron(Neuron&& other) = default;
+
+        Neuron(const Neuron& other, const allocator_type& allocator);
+
+        Neuron(Neuron&& other, const allocator_type& allocator);
+
+        Neuron& operator=(const Neuron& other) = default;
+
+        Neuron& operator=(Neuron&& other) = default;
+
         /**
          * Retrieves a mutable pointer to the neuron's morphology, if available.
          */
@@ -56,6 +77,12 @@ namespace mindset
          */
         [[nodiscard]] std::optional<const Morphology*> getMorphology() const;
 
+        /**
+         * Retrieves the shared pointer holding the neuron's morphology.
+         * The pointer is null if the neuron has no morphology.
+         */
+        [[nodiscard]] const std::shared_ptr<Morphology>& getMorphologyPtr() const;
+
         /**
          * Sets or updates the neuron's morphology.
          * @param morphology Shared pointer to the new morphology.
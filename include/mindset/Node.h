@@ -22,11 +22,13 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 #include <optional>
 #include <ranges>
 #include <unordered_set>
 
 #include <mindset/Identifiable.h>
+#include <mindset/Versioned.h>
 #include <mindset/util/Result.h>
 
 #include <mindset/Neuron.h>
@@ -43,13 +45,19 @@ namespace mindset
 
     /**
      * Represents a hierarchical node structure containing child nodes and associated neurons.
+     *
+     * Modifying a node increments its version and the version of all its ancestors.
+     * Because of this, the version of the root node changes every time the hierarchy changes.
      */
-    class Node : public Identifiable
+    class Node : public Identifiable, public Versioned
     {
         std::string _type;
+        Node* _parent;
         std::unordered_map<UID, std::unique_ptr<Node>> _children;
         std::unordered_set<UID> _neurons;
 
+        void markModified();
+
       public:
         Node(const Node& other) = delete;
 
@@ -69,14 +77,39 @@ namespace mindset
          * @param uid UID for the new child node.
          * @param type Type of the child node.
          */
-        [[nodiscard]] Result<Node*, NodeCreateError> createNode(UID uid, std::string type);
+        [[nodiscard]] Result<Node*, NodeCreateError> createNode(UID uid, std::string_view type);
+
+        /**
+         * Returns the type of this node.
+         */
+        [[nodiscard]] const std::string& getType() const;
+
+        /**
+         * Returns the parent of this node, or nullptr if this node is a root.
+         */
+        [[nodiscard]] Node* getParent();
+
+        /**
+         * Returns the parent of this node, or nullptr if this node is a root.
+         */
+        [[nodiscard]] const Node* getParent() const;
+
+        /**
+         * Returns the amount of child nodes.
+         */
+        [[nodiscard]] size_t getNodesAmount() const;
+
+        /**
+         * Returns the amount of neurons directly associated with this node.
+         */
+        [[nodiscard]] size_t getNeuronsAmount() const;
 
         /**
          * Retrieves or creates a child node.
          * @param uid UID for the node.
-         * @param type Type of the node.
+         * @param type Type of the node. It is only copied if the node has to be created.
          */
-        [[nodiscard]] Result<Node*, NodeCreateError> getOrCreateNode(UID uid, std::string type);
+        [[nodiscard]] Result<Node*, NodeCreateError> getOrCreateNode(UID uid, std::string_view type);
 
         /**
          * Retrieves a mutable child node, if it exists.
@@ -95,12 +128,19 @@ namespace mindset
          */
         bool addNeuron(UID neuron);
 
+        /**
+         * Removes a neuron from this node.
+         * @param neuron UID of the neuron.
+         * @return True if the neuron was removed; false if it wasn't associated with this node.
+         */
+        bool removeNeuron(UID neuron);
+
         /**
          * Returns a mutable range view of child nodes.
          */
         [[nodiscard]] auto getNodes()
         {
-            return _children | std::views::transform([](auto& pair) -> Node* { return pair.second; });
+            return _children | std::views::transform([](auto& pair) -> Node* { return pair.second.get(); });
         }
 
         /**
@@ -108,7 +148,8 @@ namespace mindset
          */
         [[nodiscard]] auto getNodes() const
         {
-            return _children | std::views::transform([](const auto& pair) -> const Node* { return pair.second; });
+            return _children |
+                   std::views::transform([](const auto& pair) -> const Node* { return pair.second.get(); });
         }
 
         /**
@@ -20,11 +20,17 @@
 #ifndef PROPERTIES_H
 #define PROPERTIES_H
 
+#include <array>
+#include <atomic>
 #include <map>
 #include <string>
+#include <string_view>
 #include <optional>
+#include <unordered_map>
+#include <utility>
 
 #include <mindset/UID.h>
+#include <mindset/PropertyKey.h>
 
 namespace mindset
 {
@@ -33,8 +39,62 @@ namespace mindset
      */
     class Properties
     {
+        /**
+         * Remembers how a key was resolved. Keys are identified by the address of their name,
+         * so hits don't compare strings.
+         * Entries are written as a sequence lock: readers that see a write in progress just miss.
+         */
+        struct KeyCacheEntry
+        {
+            static constexpr uint64_t FOUND = uint64_t(1) << 32;
+
+            std::atomic_uint32_t sequence = 0;
+            std::atomic<const char*> name = nullptr;
+            std::atomic_size_t size = 0;
+            std::atomic_uint64_t version = 0;
+            /// The UID in the lower bits, and FOUND if the key was defined.
+            std::atomic_uint64_t result = 0;
+
+            bool find(std::string_view key, uint64_t currentVersion, std::optional<UID>& uid) const
+            {
+                uint32_t before = sequence.load(std::memory_order_acquire);
+                if (before & 1) {
+                    return false;
+                }
+                const char* cachedName = name.load(std::memory_order_relaxed);
+                size_t cachedSize = size.load(std::memory_order_relaxed);
+                uint64_t cachedVersion = version.load(std::memory_order_relaxed);
+                uint64_t cachedResult = result.load(std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (sequence.load(std::memory_order_relaxed) != before || cachedName != key.data() ||
+                    cachedSize != key.size() || cachedVersion != currentVersion) {
+                    return false;
+                }
+                uid = cachedResult & FOUND ? std::optional<UID>(static_cast<UID>(cachedResult)) : std::nullopt;
+                return true;
+            }
+
+            void store(std::string_view key, uint64_t currentVersion, std::optional<UID> uid);
+        };
+
+        static constexpr size_t KEY_CACHE_SIZE = 64;
+
         std::map<std::string, UID> _properties;
         std::map<UID, std::string> _propertiesNames;
+        /// Maps name hashes to the first property defined with that hash, along its name.
+        std::unordered_map<uint64_t, std::pair<UID, std::string>> _propertiesHashes;
+
+        /// Changes whenever a property is defined or removed, invalidating the key cache.
+        std::atomic_uint64_t _version;
+        mutable std::array<KeyCacheEntry, KEY_CACHE_SIZE> _keyCache;
+
+        void indexHash(const std::string& name, UID id);
+
+        void unindexHash(const std::string& name, UID id);
+
+        void invalidateKeys();
+
+        std::optional<UID> resolveKey(uint64_t hash, std::string_view name) const;
 
       public:
         /**
@@ -42,6 +102,14 @@ namespace mindset
          */
         Properties();
 
+        Properties(const Properties& other);
+
+        Properties(Properties&& other) noexcept;
+
+        Properties& operator=(const Properties& other);
+
+        Properties& operator=(Properties&& other) noexcept;
+
         /**
          * Defines a new property by name, auto-generating a unique UID.
          * @param name Name of the property.
@@ -56,6 +124,20 @@ namespace mindset
          */
         void defineProperty(std::string name, UID id);
 
+        /**
+         * Defines the property of the given key, auto-generating a unique UID if it wasn't defined.
+         * @param key Key of the property.
+         * @return UID assigned to the property.
+         */
+        template<typename T>
+        UID defineProperty(const PropertyKey<T>& key)
+        {
+            if (auto found = getPropertyUID(key); found.has_value()) {
+                return found.value();
+            }
+            return defineProperty(std::string(key.getName()));
+        }
+
         /**
          * Checks whether a property is defined.
          * @param name Name of the property.
@@ -74,6 +156,40 @@ namespace mindset
          */
         [[nodiscard]] std::optional<UID> getPropertyUID(const std::string& name) const;
 
+        /**
+         * Retrieves the UID of a property by the hash of its name, if defined.
+         * This lookup doesn't compare strings.
+         * @param hash Hash of the name, as computed by hashPropertyName().
+         */
+        [[nodiscard]] std::optional<UID> getPropertyUIDByHash(uint64_t hash) const;
+
+        /**
+         * Retrieves the UID of a property by the hash of its name, if defined.
+         * The name of the property found is checked against the given one: if another property
+         * owns the hash, the property is looked up by name instead.
+         * @param hash Hash of the name, as computed by hashPropertyName().
+         * @param name Name of the property.
+         */
+        [[nodiscard]] std::optional<UID> getPropertyUIDByHash(uint64_t hash, std::string_view name) const;
+
+        /**
+         * Retrieves the UID of the property of the given key, if defined.
+         * The first lookup of a key resolves it by its precomputed hash, checking the name of the property found.
+         * The result is cached until a property is defined or removed, so later lookups compare no strings.
+         * This method can be called concurrently, as long as no thread modifies these properties.
+         * @param key Key of the property.
+         */
+        template<typename T>
+        [[nodiscard]] std::optional<UID> getPropertyUID(const PropertyKey<T>& key) const
+        {
+            auto& entry = _keyCache[key.getHash() % KEY_CACHE_SIZE];
+            std::optional<UID> cached;
+            if (entry.find(key.getName(), _version.load(std::memory_order_relaxed), cached)) {
+                return cached;
+            }
+            return resolveKey(key.getHash(), key.getName());
+        }
+
         /**
          * Retrieves the name of a property by UID, if defined.
          * @param uid UID of the property.
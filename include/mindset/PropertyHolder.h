@@ -21,6 +21,7 @@
 #define PROPERTYHOLDER_H
 
 #include <any>
+#include <memory_resource>
 #include <optional>
 #include <string>
 #include <unordered_map>
@@ -35,21 +36,55 @@ namespace mindset
 
     /**
      * Holds a set of properties, each associated with a UID and stored as any type.
+     *
+     * The property map can be allocated from a memory resource, such as the arena of a Dataset.
+     * The values stored inside the std::any objects still use the global heap when they don't fit inside them.
      */
     class PropertyHolder : public Versioned
     {
-        std::unordered_map<UID, std::any> _properties;
+        std::pmr::unordered_map<UID, std::any> _properties;
 
       public:
+        using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
         /**
          * Creates a new property holder.
          */
         PropertyHolder();
 
+        /**
+         * Creates a new property holder whose map is allocated using the given allocator.
+         */
+        explicit PropertyHolder(const allocator_type& allocator);
+
+        PropertyHolder(const PropertyHolder& other) = default;
+
+        PropertyHolder(PropertyHolder&& other) = default;
+
+        /**
+         * Copies the given holder, allocating the copy using the given allocator.
+         */
+        PropertyHolder(const PropertyHolder& other, const allocator_type& allocator);
+
+        /**
+         * Moves the given holder, allocating the result using the given allocator.
+         * The properties are moved one by one if the allocators are not equal.
+         */
+        PropertyHolder(PropertyHolder&& other, const allocator_type& allocator);
+
+        PropertyHolder& operator=(const PropertyHolder& other) = default;
+
+        PropertyHolder& operator=(PropertyHolder&& other) = default;
+
+        /**
+         * Returns the allocator used by the property map.
+         */
+        [[nodiscard]] allocator_type getAllocator() const;
+
         /**
          * Returns a reference to the property map.
          */
-        const std::unordered_map<UID, std::any>& getProperties() const;
+        const std::pmr::unordered_map<UID, std::any>& getProperties() const;
 
         /**
          * Returns a new vector holding all the properties of this holder with their respective names.
@@ -95,11 +130,12 @@ namespace mindset
         template<typename T>
         [[nodiscard]] std::optional<T> getProperty(UID uid) const
         {
-            auto optional = getPropertyAsAny(uid);
+            // Casts the stored value in place: copying the std::any first may allocate.
+            auto optional = getPropertyAsAnyPtr(uid);
             if (!optional.has_value()) {
                 return {};
             }
-            T* v = std::any_cast<T>(&optional.value());
+            const T* v = std::any_cast<T>(optional.value());
             if (v == nullptr) {
                 return {};
             }
@@ -0,0 +1,89 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#ifndef PROPERTYKEY_H
+#define PROPERTYKEY_H
+
+#include <cstdint>
+#include <string_view>
+
+namespace mindset
+{
+    /**
+     * Hashes a property name using 64-bit FNV-1a.
+     * It can be evaluated at compile time.
+     * @param name Name of the property.
+     */
+    constexpr uint64_t hashPropertyName(std::string_view name)
+    {
+        uint64_t hash = 14695981039346656037ull;
+        for (char c : name) {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    /**
+     * A strongly typed handle to a property.
+     *
+     * Keys store the property name along its hash, computed at compile time for constant keys.
+     * Contexts resolve keys by hash, only comparing the name of the property found to detect collisions,
+     * and cache the result by the address of the key's name, so later lookups compare no strings.
+     * Contextualized accessors use the key's type to access the value without copying it.
+     *
+     * The name must outlive the key, and its storage must not be reused for another name while a context
+     * may still hold it. Keys are meant to be constants, such as the ones in DefaultProperties.h.
+     *
+     * @tparam T Type of the property's value.
+     */
+    template<typename T>
+    class PropertyKey
+    {
+        std::string_view _name;
+        uint64_t _hash;
+
+      public:
+        using ValueType = T;
+
+        constexpr explicit PropertyKey(std::string_view name) :
+            _name(name),
+            _hash(hashPropertyName(name))
+        {
+        }
+
+        /**
+         * Returns the name of the property.
+         */
+        [[nodiscard]] constexpr std::string_view getName() const
+        {
+            return _name;
+        }
+
+        /**
+         * Returns the hash of the property name.
+         */
+        [[nodiscard]] constexpr uint64_t getHash() const
+        {
+            return _hash;
+        }
+    };
+} // namespace mindset
+
+#endif // PROPERTYKEY_H
@@ -44,6 +44,24 @@ namespace mindset
          */
         Synapse(UID uid, UID preSynapticNeuron, UID postSynapticNeuron);
 
+        /**
+         * Constructs a synapse whose properties are allocated using the given allocator.
+         * Use Dataset::getAllocator() to build the synapse directly inside the memory of a dataset.
+         */
+        Synapse(UID uid, UID preSynapticNeuron, UID postSynapticNeuron, const allocator_type& allocator);
+
+        Synapse(const Synapse& other) = default;
+
+        Synapse(Synapse&& other) = default;
+
+        Synapse(const Synapse& other, const allocator_type& allocator);
+
+        Synapse(Synapse&& other, const allocator_type& allocator);
+
+        Synapse& operator=(const Synapse& other) = default;
+
+        Synapse& operator=(Synapse&& other) = default;
+
         /**
          * Retrieves the UID of the pre-synaptic neuron.
          */
@@ -21,7 +21,11 @@
 #define TIMEGRID_H
 
 #include <chrono>
+#include <optional>
 #include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
 
 #include <mindset/UID.h>
 #include <mindset/Versioned.h>
@@ -238,13 +242,7 @@ namespace mindset
          */
         auto getTimeline(UID uid)
         {
-            auto index = findUIDIndex(uid);
-            if (!index.has_value()) {
-                return std::span<const std::vector<Value>>{} |
-                       std::views::transform([](const std::vector<Value>& step) -> const Value& { return step[0]; });
-            }
-            return _data | std::views::transform(
-                               [i = *index](const std::vector<Value>& step) -> const Value& { return step[i]; });
+            return std::as_const(*this).getTimeline(uid);
         }
 
         /**
@@ -256,13 +254,15 @@ namespace mindset
          */
         auto getTimeline(UID uid) const
         {
+            // Both branches must return the same view type: an unknown UID yields an empty span.
             auto index = findUIDIndex(uid);
-            if (!index.has_value()) {
-                return std::span<const std::vector<Value>>{} |
-                       std::views::transform([](const std::vector<Value>& step) -> const Value& { return step[0]; });
+            std::span<const std::vector<Value>> steps;
+            if (index.has_value()) {
+                steps = _data;
             }
-            return _data | std::views::transform(
-                               [i = *index](const std::vector<Value>& step) -> const Value& { return step[i]; });
+            size_t i = index.value_or(0);
+            return steps |
+                   std::views::transform([i](const std::vector<Value>& step) -> const Value& { return step[i]; });
         }
 
         // Modifications
@@ -0,0 +1,222 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#ifndef CIRCUITGRAPH_H
+#define CIRCUITGRAPH_H
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <mindset/Dataset.h>
+#include <mindset/UID.h>
+
+namespace mindset
+{
+    /**
+     * The edges followed by a traversal.
+     */
+    enum class TraversalDirection
+    {
+        /// From pre-synaptic to post-synaptic neurons (downstream).
+        OUTGOING,
+        /// From post-synaptic to pre-synaptic neurons (upstream).
+        INCOMING,
+        /// Both ways, ignoring the direction of the synapses.
+        BOTH
+    };
+
+    struct CircuitGraphSettings
+    {
+        /// The numeric synapse property used as the weight of the edges, such as PROPERTY_SYNAPSE_DELAY.
+        /// If empty, the graph is unweighted and every edge weights one.
+        /// Synapses without the property or with a non-numeric value weight zero.
+        std::optional<std::string> weightProperty;
+        /// The maximum amount of threads to use. Zero uses defaultThreadCount().
+        size_t threads = 0;
+    };
+
+    /**
+     * The connected components of a CircuitGraph.
+     */
+    struct GraphComponents
+    {
+        /// The component of each neuron, by neuron index.
+        /// Components are numbered by the lowest index of their neurons.
+        std::vector<uint32_t> labels;
+        /// The amount of neurons of each component.
+        std::vector<uint32_t> sizes;
+
+        [[nodiscard]] size_t getComponentsAmount() const;
+    };
+
+    /**
+     * The result of a single-source shortest path search.
+     */
+    struct ShortestPaths
+    {
+        static constexpr uint32_t NO_PREDECESSOR = std::numeric_limits<uint32_t>::max();
+
+        /// The distance from the source to each neuron, by neuron index. Unreachable neurons are infinite.
+        std::vector<double> distances;
+        /// The previous neuron in the shortest path to each neuron, by neuron index.
+        std::vector<uint32_t> predecessors;
+
+        /**
+         * Returns the indices of the neurons of the shortest path from the source to the given neuron,
+         * both included, or an empty path if the neuron is unreachable.
+         */
+        [[nodiscard]] std::vector<uint32_t> getPath(uint32_t target) const;
+    };
+
+    /**
+     * A compact, immutable snapshot of the connectivity of a dataset, meant for graph algorithms.
+     *
+     * Neurons are identified by their index: the position of their UID in ascending order.
+     * Edges are neuron-level connections: several synapses between the same pair of neurons
+     * become a single edge, weighting the minimum weight of its synapses.
+     * Edges are stored twice, as outgoing and incoming compressed sparse rows sorted by neuron index,
+     * so traversals touch contiguous memory instead of the hash tables of the Circuit.
+     *
+     * The graph doesn't track changes of the dataset: build a new one after modifying the circuit.
+     * The caller must hold a read lock on the dataset while building.
+     */
+    class CircuitGraph
+    {
+        std::vector<UID> _uids;
+        std::unordered_map<UID, uint32_t> _indices;
+
+        std::vector<uint64_t> _outOffsets;
+        std::vector<uint32_t> _outNeighbors;
+        std::vector<float> _outWeights;
+
+        std::vector<uint64_t> _inOffsets;
+        std::vector<uint32_t> _inNeighbors;
+        std::vector<float> _inWeights;
+
+        bool _weighted;
+        size_t _threads;
+
+      public:
+        static constexpr uint32_t UNREACHED = std::numeric_limits<uint32_t>::max();
+
+        /**
+         * Creates an empty graph.
+         */
+        CircuitGraph();
+
+        /**
+         * Builds the graph of the neurons and synapses of the dataset.
+         * Synapses whose neurons are not in the dataset are skipped.
+         */
+        explicit CircuitGraph(const Dataset& dataset, const CircuitGraphSettings& settings = {});
+
+        [[nodiscard]] size_t getNeuronsAmount() const;
+
+        [[nodiscard]] uint64_t getEdgesAmount() const;
+
+        /**
+         * Returns the UIDs of the neurons, sorted. The position of each UID is the index of its neuron.
+         */
+        [[nodiscard]] std::span<const UID> getUIDs() const;
+
+        /**
+         * Returns the index of the given neuron, if it's part of the graph.
+         */
+        [[nodiscard]] std::optional<uint32_t> getIndex(UID uid) const;
+
+        /**
+         * Returns the post-synaptic neighbors of the given neuron, sorted by index.
+         */
+        [[nodiscard]] std::span<const uint32_t> getOutgoing(uint32_t index) const;
+
+        /**
+         * Returns the weights of the outgoing edges of the given neuron, matching getOutgoing().
+         * Empty if the graph is unweighted.
+         */
+        [[nodiscard]] std::span<const float> getOutgoingWeights(uint32_t index) const;
+
+        /**
+         * Returns the pre-synaptic neighbors of the given neuron, sorted by index.
+         */
+        [[nodiscard]] std::span<const uint32_t> getIncoming(uint32_t index) const;
+
+        /**
+         * Returns the weights of the incoming edges of the given neuron, matching getIncoming().
+         * Empty if the graph is unweighted.
+         */
+        [[nodiscard]] std::span<const float> getIncomingWeights(uint32_t index) const;
+
+        [[nodiscard]] bool isWeighted() const;
+
+        /**
+         * Computes the amount of hops from the closest source to every neuron using a parallel,
+         * direction-optimizing breadth-first search.
+         *
+         * Small frontiers are expanded top-down, visiting the edges of the frontier.
+         * Large frontiers are expanded bottom-up: every unvisited neuron looks for a parent in the frontier
+         * and stops at the first one, which skips most edges of dense circuits.
+         *
+         * @param sources The indices of the source neurons. They have distance zero.
+         * @param direction The edges to follow.
+         * @param maxHops The maximum amount of hops to explore.
+         * @return The distance of each neuron by index, or UNREACHED.
+         */
+        [[nodiscard]] std::vector<uint32_t> getHopDistances(std::span<const uint32_t> sources,
+                                                            TraversalDirection direction,
+                                                            uint32_t maxHops = UNREACHED) const;
+
+        /**
+         * Returns the UIDs of the neurons reachable from the given ones in one to maxHops hops, sorted.
+         * Sources are not included. Sources not present in the graph are ignored.
+         */
+        [[nodiscard]] std::vector<UID> getNeighborhood(std::span<const UID> sources, uint32_t maxHops,
+                                                       TraversalDirection direction) const;
+
+        /**
+         * Computes the weighted shortest paths from the given neuron to every other one using Dijkstra's algorithm.
+         * Edges with a negative or NaN weight are not followed.
+         */
+        [[nodiscard]] ShortestPaths getShortestPaths(uint32_t source, TraversalDirection direction) const;
+
+        /**
+         * Returns the UIDs of the neurons of the weighted shortest path between two neurons, both included.
+         * The search stops as soon as the target is reached.
+         * @return The path, or an empty optional if the target is unreachable or a neuron is not in the graph.
+         */
+        [[nodiscard]] std::optional<std::vector<UID>> getShortestPath(UID from, UID to,
+                                                                      TraversalDirection direction) const;
+
+        /**
+         * Computes the weakly connected components of the graph in parallel using a concurrent union-find.
+         */
+        [[nodiscard]] GraphComponents getWeaklyConnectedComponents() const;
+
+        /**
+         * Computes the strongly connected components of the graph using an iterative Tarjan's algorithm.
+         */
+        [[nodiscard]] GraphComponents getStronglyConnectedComponents() const;
+    };
+} // namespace mindset
+
+#endif //CIRCUITGRAPH_H
@@ -0,0 +1,170 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#ifndef CONNECTIVITY_H
+#define CONNECTIVITY_H
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <mindset/Dataset.h>
+#include <mindset/UID.h>
+
+namespace mindset
+{
+    /**
+     * Assigns neurons to groups, such as layers, columns or morphological types.
+     * Each neuron belongs to one group at most.
+     */
+    class NeuronGrouping
+    {
+        std::vector<std::string> _labels;
+        std::unordered_map<UID, uint32_t> _groups;
+
+      public:
+        NeuronGrouping() = default;
+
+        /**
+         * Groups the neurons by the value of a categorical property.
+         * Integral and enum values (e.g. layers) and strings (e.g. morphological types) are supported.
+         * Integral groups are sorted by value and come before string groups, which are sorted by name.
+         * Neurons without the property, or with values of other types, are not grouped.
+         * @param dataset The dataset containing the neurons.
+         * @param property The name of the property.
+         */
+        static NeuronGrouping byProperty(const Dataset& dataset, const std::string& property);
+
+        /**
+         * Groups the neurons by the hierarchy nodes of the given type, such as "mindset:column".
+         * Each node becomes a group containing all the neurons of its subtree, labeled with the node's UID.
+         * Neurons contained by several nodes of the type are assigned to the first one in depth-first order.
+         * @param dataset The dataset containing the hierarchy.
+         * @param nodeType The type of the nodes.
+         */
+        static NeuronGrouping byHierarchy(const Dataset& dataset, const std::string& nodeType);
+
+        /**
+         * Adds a new empty group.
+         * @return The index of the group.
+         */
+        uint32_t addGroup(std::string label);
+
+        /**
+         * Assigns a neuron to the given group, replacing its previous group.
+         */
+        void assign(UID neuron, uint32_t group);
+
+        [[nodiscard]] size_t getGroupsAmount() const;
+
+        [[nodiscard]] const std::vector<std::string>& getLabels() const;
+
+        /**
+         * Returns the group of the given neuron, if it has one.
+         */
+        [[nodiscard]] std::optional<uint32_t> getGroup(UID neuron) const;
+
+        /**
+         * Returns the pairs of neurons and groups.
+         */
+        [[nodiscard]] const std::unordered_map<UID, uint32_t>& getAssignments() const;
+
+        /**
+         * Returns the amount of neurons of each group.
+         */
+        [[nodiscard]] std::vector<size_t> getGroupSizes() const;
+    };
+
+    struct ConnectivitySettings
+    {
+        /// The numeric synapse properties summed for each pair of groups, such as conductances or efficacies.
+        std::vector<std::string> properties;
+        /// The maximum amount of threads to use. Zero uses all available cores.
+        size_t threads = 0;
+    };
+
+    /**
+     * A synapse property aggregated for each pair of groups.
+     * Matrices are stored row-major: the pre-synaptic group selects the row.
+     */
+    struct PropertyConnectivity
+    {
+        std::string name;
+        size_t groups = 0;
+        /// The sum of the values of the synapses.
+        std::vector<double> sums;
+        /// The amount of synapses with a numeric value.
+        std::vector<uint64_t> counts;
+
+        /**
+         * Returns the mean value of the synapses from the pre-synaptic group to the post-synaptic group.
+         * Returns zero if no synapse has a value.
+         */
+        [[nodiscard]] double getMean(size_t pre, size_t post) const;
+    };
+
+    /**
+     * Connection counts and probabilities between groups of neurons.
+     *
+     * Matrices are dense and stored row-major: the pre-synaptic group selects the row.
+     * Synapses whose neurons are not grouped are ignored.
+     */
+    struct GroupConnectivity
+    {
+        std::vector<std::string> labels;
+        std::vector<size_t> groupSizes;
+        /// The amount of synapses between each pair of groups.
+        std::vector<uint64_t> synapses;
+        /// The amount of connected ordered pairs of different neurons between each pair of groups.
+        std::vector<uint64_t> connections;
+        std::vector<PropertyConnectivity> properties;
+
+        [[nodiscard]] size_t getGroupsAmount() const;
+
+        [[nodiscard]] uint64_t getSynapses(size_t pre, size_t post) const;
+
+        [[nodiscard]] uint64_t getConnections(size_t pre, size_t post) const;
+
+        /**
+         * Returns the probability of a neuron of the pre-synaptic group being connected
+         * to a different neuron of the post-synaptic group.
+         */
+        [[nodiscard]] double getProbability(size_t pre, size_t post) const;
+
+        /**
+         * Returns the aggregated property with the given name, if it was requested.
+         */
+        [[nodiscard]] std::optional<const PropertyConnectivity*> getProperty(const std::string& name) const;
+
+        /**
+         * Aggregates the circuit of the given dataset in a single parallel pass over the pre-synaptic neurons.
+         * Each thread accumulates into its own matrices, which are merged at the end.
+         * The caller must hold a read lock on the dataset.
+         * @param dataset The dataset containing the circuit.
+         * @param grouping The groups of the neurons.
+         * @param settings The properties to aggregate and the amount of threads.
+         */
+        static GroupConnectivity compute(const Dataset& dataset, const NeuronGrouping& grouping,
+                                         const ConnectivitySettings& settings = {});
+    };
+} // namespace mindset
+
+#endif //CONNECTIVITY_H
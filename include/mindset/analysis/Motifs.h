@@ -0,0 +1,107 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#ifndef MOTIFS_H
+#define MOTIFS_H
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include <mindset/analysis/CircuitGraph.h>
+#include <mindset/analysis/Connectivity.h>
+
+namespace mindset
+{
+    /**
+     * The amount of each of the 16 isomorphism classes of directed triads, using the MAN naming convention:
+     * the amount of Mutual, Asymmetric and Null dyads of the triad, followed by a letter
+     * distinguishing classes with the same dyads (Down, Up, Cyclic, Transitive).
+     */
+    struct TriadCensus
+    {
+        static constexpr std::array<std::string_view, 16> NAMES = {
+            "003",  "012",  "102",  "021D", "021U", "021C", "111D", "111U",
+            "030T", "030C", "201",  "120D", "120U", "120C", "210",  "300",
+        };
+
+        std::array<uint64_t, 16> counts = {};
+
+        /**
+         * Returns the amount of triads of the class with the given name, or zero if the name is unknown.
+         */
+        [[nodiscard]] uint64_t get(std::string_view name) const;
+    };
+
+    struct MotifSettings
+    {
+        /// Whether to compute the triad census, the most expensive statistic.
+        bool census = true;
+        /// Whether to compute the clustering coefficient of each neuron.
+        bool clustering = true;
+        /// The maximum amount of threads to use. Zero uses defaultThreadCount().
+        size_t threads = 0;
+    };
+
+    /**
+     * Motif statistics of a circuit or of the subcircuit induced by a group of neurons.
+     * Autapses are ignored.
+     */
+    struct MotifStatistics
+    {
+        /// The indices of the neurons of the (sub)circuit in the CircuitGraph, sorted.
+        std::vector<uint32_t> neurons;
+        /// The amount of connections between different neurons.
+        uint64_t connections = 0;
+        /// The amount of pairs of neurons connected in both directions.
+        uint64_t reciprocalPairs = 0;
+        TriadCensus census;
+        /// The directed clustering coefficient of each neuron, matching neurons.
+        /// It's the fraction of the possible directed triangles through the neuron that exist (Fagiolo, 2007).
+        std::vector<double> clustering;
+
+        /**
+         * Returns the fraction of connections that are part of a reciprocal pair.
+         */
+        [[nodiscard]] double getReciprocity() const;
+    };
+
+    /**
+     * Computes the motif statistics of the whole graph.
+     *
+     * Every statistic intersects the sorted adjacency of the graph, merging the incoming and outgoing
+     * neighbors of each neuron into a single sorted list that also records the direction of the edges.
+     * The triad census follows Batagelj and Mrvar's algorithm: connected triads are enumerated once
+     * from their lowest neuron and the dyadic and empty ones are derived from the neighborhood sizes.
+     * Neurons are processed in parallel.
+     */
+    [[nodiscard]] MotifStatistics computeMotifs(const CircuitGraph& graph, const MotifSettings& settings = {});
+
+    /**
+     * Computes the motif statistics of the subcircuit induced by each group of neurons,
+     * ignoring the connections between neurons of different groups.
+     * @return The statistics of each group, matching the labels of the grouping.
+     */
+    [[nodiscard]] std::vector<MotifStatistics> computeMotifs(const CircuitGraph& graph,
+                                                             const NeuronGrouping& grouping,
+                                                             const MotifSettings& settings = {});
+} // namespace mindset
+
+#endif //MOTIFS_H
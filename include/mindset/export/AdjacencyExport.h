@@ -0,0 +1,145 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#ifndef ADJACENCYEXPORT_H
+#define ADJACENCYEXPORT_H
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+
+#include <mindset/Dataset.h>
+#include <mindset/util/Result.h>
+
+namespace mindset
+{
+    /**
+     * The file format written by exportAdjacency().
+     */
+    enum class AdjacencyFormat
+    {
+        /// Matrix Market coordinate text format, readable by SciPy, Julia, MATLAB and most graph tools.
+        MATRIX_MARKET,
+        /// Little-endian binary file starting with an AdjacencyFileHeader.
+        RAW
+    };
+
+    /**
+     * The sparse layout of the entries of a raw adjacency file.
+     * Matrix Market files are always coordinate lists, with their entries sorted by row and column.
+     */
+    enum class AdjacencyLayout : uint32_t
+    {
+        /// Compressed sparse rows: row pointers, columns and weights.
+        CSR = 0,
+        /// Coordinate list: rows, columns and weights.
+        COO = 1
+    };
+
+    struct AdjacencyExportSettings
+    {
+        AdjacencyFormat format = AdjacencyFormat::RAW;
+        AdjacencyLayout layout = AdjacencyLayout::CSR;
+        /// The numeric synapse property used as the weight of the entries.
+        /// If empty, the matrix is a pattern matrix without weights.
+        /// Synapses without the property or with a non-numeric value weight zero.
+        std::optional<std::string> weightProperty;
+        /// Whether to collapse the synapses between the same pair of neurons into a single entry.
+        /// Collapsed entries weight the sum of their synapses.
+        /// If false, each synapse is an entry and rows may contain repeated columns.
+        bool collapse = true;
+        /// The maximum amount of threads to use. Zero uses defaultThreadCount().
+        size_t threads = 0;
+    };
+
+    /**
+     * The flags of an AdjacencyFileHeader.
+     */
+    enum AdjacencyFileFlags : uint32_t
+    {
+        ADJACENCY_WEIGHTED = 1,
+        ADJACENCY_COLLAPSED = 2
+    };
+
+    /**
+     * The header of a raw adjacency file.
+     *
+     * The header is followed by its sections, each one aligned to 64 bytes. All values are little-endian.
+     * - uids: rows uint32 values. The UID of the neuron of each row and column, in ascending order.
+     * - rows: for CSR, rows + 1 uint64 row pointers. For COO, entries uint32 row indices.
+     * - columns: entries uint32 column indices.
+     * - weights: entries float64 values. Only present if the ADJACENCY_WEIGHTED flag is set.
+     *
+     * Entries are sorted by row and column. Absent sections have offset zero.
+     */
+    struct AdjacencyFileHeader
+    {
+        static constexpr char MAGIC[8] = {'M', 'N', 'D', 'S', 'A', 'D', 'J', 'M'};
+        static constexpr uint32_t VERSION = 1;
+
+        char magic[8];
+        uint32_t version;
+        uint32_t layout;
+        uint32_t flags;
+        uint32_t reserved;
+        uint64_t rows;
+        uint64_t entries;
+        uint64_t uidsOffset;
+        uint64_t rowsOffset;
+        uint64_t columnsOffset;
+        uint64_t weightsOffset;
+    };
+
+    static_assert(sizeof(AdjacencyFileHeader) == 72);
+
+    /**
+     * A summary of an exported adjacency matrix.
+     */
+    struct AdjacencyExportInfo
+    {
+        /// The amount of rows and columns of the matrix: the amount of neurons of the dataset.
+        uint64_t neurons;
+        /// The amount of non-zero entries written.
+        uint64_t entries;
+        /// The size of the written file.
+        uint64_t bytes;
+    };
+
+    /**
+     * Writes the neuron-level connectivity of the dataset as a sparse adjacency matrix.
+     *
+     * Row and column i correspond to the i-th neuron of the dataset by ascending UID,
+     * and an entry (pre, post) represents the synapses from the neuron pre to the neuron post.
+     * Synapses whose neurons are not in the dataset are skipped.
+     *
+     * The matrix is streamed: rows are processed in parallel batches and written in order,
+     * so the memory used doesn't depend on the amount of synapses.
+     * Every row is read twice from the circuit: once to count the entries and once to write them.
+     *
+     * The caller must hold a read lock on the dataset while exporting.
+     *
+     * @return A summary of the written matrix or the error.
+     */
+    Result<AdjacencyExportInfo, std::string> exportAdjacency(const Dataset& dataset,
+                                                             const std::filesystem::path& path,
+                                                             const AdjacencyExportSettings& settings = {});
+} // namespace mindset
+
+#endif //ADJACENCYEXPORT_H
@@ -0,0 +1,210 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#ifndef GEOMETRYBUFFERS_H
+#define GEOMETRYBUFFERS_H
+
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <mindset/Dataset.h>
+#include <mindset/util/Result.h>
+
+namespace mindset
+{
+    /**
+     * A point of a morphology, ready to be uploaded to the GPU.
+     * The soma is stored as a point of type NeuriteType::SOMA and neurite NO_NEURITE.
+     */
+    struct PackedVertex
+    {
+        static constexpr uint32_t NO_NEURITE = std::numeric_limits<uint32_t>::max();
+
+        float position[3];
+        float radius;
+        uint32_t type;
+        UID neurite;
+    };
+
+    /**
+     * A neuron drawn using one of the exported morphologies.
+     * The model matrix is stored in column-major order.
+     */
+    struct PackedInstance
+    {
+        float model[16];
+        uint32_t morphology;
+        UID neuron;
+        uint32_t padding[2];
+    };
+
+    /**
+     * The ranges of the buffers used by a morphology.
+     * Offsets are expressed in elements, not bytes.
+     */
+    struct PackedMorphologyRange
+    {
+        uint32_t firstVertex;
+        uint32_t vertexCount;
+        uint32_t firstLineIndex;
+        uint32_t lineIndexCount;
+        uint32_t firstCapsuleIndex;
+        uint32_t capsuleIndexCount;
+    };
+
+    static_assert(sizeof(PackedVertex) == 24);
+    static_assert(sizeof(PackedInstance) == 80);
+    static_assert(sizeof(PackedMorphologyRange) == 24);
+
+    struct GeometryExportSettings
+    {
+        /// Whether to write each morphology once and reference it from the instances.
+        /// If false, each neuron gets its own copy of its morphology in global coordinates
+        /// and all instances use the identity matrix.
+        bool instancing = true;
+        /// Whether to export the soma as a vertex and connect the neurites attached to it.
+        bool includeSoma = true;
+        /// The maximum amount of threads to use. Zero uses defaultThreadCount().
+        size_t threads = 0;
+    };
+
+    /**
+     * Packed geometry buffers of the neurons of a dataset, ready to be uploaded to the GPU.
+     *
+     * Every segment of a morphology (a point and its parent) is stored twice:
+     * - As a pair of vertex indices in the line index buffer, for line primitives.
+     * - As six indices in the capsule index buffer, forming two triangles.
+     *   Capsule indices have the form segment * 4 + corner, where segment is the global index
+     *   of the segment in the line index buffer and corner is in [0, 4).
+     *   They are meant for vertex pulling: the vertex shader fetches both endpoints
+     *   from the line index buffer and expands the corner into a camera-facing capsule.
+     *
+     * Indices are global, so a morphology can be drawn with a single indexed draw call
+     * using its range and its instances.
+     *
+     * Calling build() again reuses the allocated memory of the buffers.
+     * The caller must hold a read lock on the dataset while building.
+     */
+    class GeometryBuffers
+    {
+        std::vector<PackedVertex> _vertices;
+        std::vector<uint32_t> _lineIndices;
+        std::vector<uint32_t> _capsuleIndices;
+        std::vector<PackedMorphologyRange> _morphologies;
+        std::vector<PackedInstance> _instances;
+
+      public:
+        GeometryBuffers() = default;
+
+        /**
+         * Packs the geometry of all the neurons of the dataset.
+         * Neurons without a morphology are skipped.
+         */
+        void build(const Dataset& dataset, const GeometryExportSettings& settings = {});
+
+        /**
+         * Packs the geometry of the given neurons.
+         * Neurons without a morphology or not present in the dataset are skipped.
+         */
+        void build(const Dataset& dataset, std::span<const UID> neurons, const GeometryExportSettings& settings = {});
+
+        /**
+         * Empties the buffers, keeping their allocated memory.
+         */
+        void clear();
+
+        [[nodiscard]] std::span<const PackedVertex> getVertices() const;
+
+        [[nodiscard]] std::span<const uint32_t> getLineIndices() const;
+
+        [[nodiscard]] std::span<const uint32_t> getCapsuleIndices() const;
+
+        [[nodiscard]] std::span<const PackedMorphologyRange> getMorphologies() const;
+
+        [[nodiscard]] std::span<const PackedInstance> getInstances() const;
+
+        /**
+         * Returns the amount of bytes used by the buffers' contents.
+         */
+        [[nodiscard]] size_t getByteSize() const;
+
+        /**
+         * Writes the buffers into a binary file that can be memory-mapped using MappedGeometryFile.
+         * @return The amount of bytes written or the error.
+         */
+        [[nodiscard]] Result<size_t, std::string> write(const std::filesystem::path& path) const;
+    };
+
+    /**
+     * A geometry file written by GeometryBuffers::write(), mapped into memory.
+     *
+     * The file starts with a header followed by the buffers, each one aligned to 64 bytes,
+     * so the returned spans point directly into the mapping and can be uploaded without copies.
+     * Platforms without mmap() read the whole file into memory instead.
+     */
+    class MappedGeometryFile
+    {
+        const std::byte* _data;
+        size_t _size;
+        bool _mapped;
+        std::vector<std::byte> _buffer;
+
+        std::span<const PackedVertex> _vertices;
+        std::span<const uint32_t> _lineIndices;
+        std::span<const uint32_t> _capsuleIndices;
+        std::span<const PackedMorphologyRange> _morphologies;
+        std::span<const PackedInstance> _instances;
+
+        MappedGeometryFile();
+
+      public:
+        ~MappedGeometryFile();
+
+        MappedGeometryFile(const MappedGeometryFile&) = delete;
+
+        MappedGeometryFile& operator=(const MappedGeometryFile&) = delete;
+
+        /**
+         * Maps the given file and validates its header.
+         */
+        static Result<std::unique_ptr<MappedGeometryFile>, std::string> open(const std::filesystem::path& path);
+
+        [[nodiscard]] std::span<const PackedVertex> getVertices() const;
+
+        [[nodiscard]] std::span<const uint32_t> getLineIndices() const;
+
+        [[nodiscard]] std::span<const uint32_t> getCapsuleIndices() const;
+
+        [[nodiscard]] std::span<const PackedMorphologyRange> getMorphologies() const;
+
+        [[nodiscard]] std::span<const PackedInstance> getInstances() const;
+
+        /**
+         * Returns the size of the file in bytes.
+         */
+        [[nodiscard]] size_t getByteSize() const;
+    };
+} // namespace mindset
+
+#endif //GEOMETRYBUFFERS_H
@@ -0,0 +1,141 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#ifndef DATASETGENERATOR_H
+#define DATASETGENERATOR_H
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <mindset/Dataset.h>
+
+namespace mindset
+{
+    struct GeneratorMorphologySettings
+    {
+        /// The amount of different morphologies. Neurons share them. Zero generates one morphology per neuron.
+        size_t amount = 16;
+        size_t minDendrites = 4;
+        size_t maxDendrites = 8;
+        /// Whether morphologies have an apical dendrite growing towards +Y.
+        bool apicalDendrite = true;
+        /// The maximum amount of points of each dendrite, axon or apical dendrite.
+        size_t pointsPerTree = 150;
+        /// The distance between consecutive points, in micrometers.
+        float segmentLength = 4.0f;
+        /// The probability of a tip to branch at each step.
+        float branchProbability = 0.04f;
+        /// How much the growth direction changes at each step. Zero grows straight lines.
+        float tortuosity = 0.3f;
+    };
+
+    struct GeneratorPlacementSettings
+    {
+        size_t columns = 1;
+        size_t layers = 6;
+        float columnRadius = 250.0f;
+        float layerThickness = 200.0f;
+        /// The distance between the centers of adjacent columns. Columns are placed in a square grid.
+        float columnSpacing = 600.0f;
+    };
+
+    struct GeneratorSynapseSettings
+    {
+        size_t amount = 10'000;
+        /// The standard deviation of the log-normal weights that control the in and out degree of each neuron.
+        /// Zero gives every neuron the same expected degree. Higher values produce heavier tails (hub neurons).
+        float degreeSigma = 1.0f;
+        bool allowAutapses = false;
+        /// Whether to assign the pre and post neurites and positions of each synapse.
+        /// Requires morphologies. Disable it for huge circuits when only the connectivity is needed.
+        bool positions = true;
+    };
+
+    struct GeneratorActivitySettings
+    {
+        /// Whether to generate an activity with spikes.
+        bool spikes = true;
+        /// The mean firing rate in hertz. Each neuron gets a log-normal rate around it.
+        float meanRate = 5.0f;
+        std::chrono::nanoseconds duration = std::chrono::seconds(1);
+        /// The amount of voltage timesteps per neuron. Zero skips the voltage grid.
+        size_t voltageTimesteps = 0;
+        std::chrono::nanoseconds voltageDelta = std::chrono::microseconds(25);
+    };
+
+    struct DatasetGeneratorSettings
+    {
+        /// The seed of the generator. The same seed and settings always generate the same dataset,
+        /// no matter the amount of threads.
+        uint64_t seed = 42;
+        size_t neurons = 100;
+        bool morphologies = true;
+        bool hierarchy = true;
+        GeneratorMorphologySettings morphology;
+        GeneratorPlacementSettings placement;
+        GeneratorSynapseSettings synapses;
+        GeneratorActivitySettings activity;
+        /// The maximum amount of threads to use. Zero uses defaultThreadCount().
+        size_t threads = 0;
+    };
+
+    /**
+     * Generates synthetic datasets of configurable scale, useful to test and benchmark Mindset
+     * without external data.
+     *
+     * The generated dataset contains:
+     * - Procedurally grown morphologies with a soma, dendrites, an axon and an optional apical dendrite.
+     *   Neurite UIDs are assigned in growth order, so parents always have lower UIDs than their children.
+     * - Neurons (UIDs F to F + N - 1) placed inside cylindrical columns split in layers, rotated around the Y axis.
+     *   Each neuron stores its column and layer, and the hierarchy root -> column -> layer -> neuron is built.
+     * - Synapses (UIDs S to S + M - 1) with log-normal degree distributions.
+     * - An activity with Poisson spike trains and, optionally, a voltage grid.
+     *
+     * F and S are the first UIDs after the neurons and synapses already stored in the dataset:
+     * zero for an empty dataset. Generating into a non-empty dataset appends new elements instead of
+     * replacing existing ones. The activity takes the smallest available activity UID.
+     *
+     * Every element is generated from its own random stream, so the work can be split among threads
+     * without changing the result.
+     */
+    class DatasetGenerator
+    {
+        DatasetGeneratorSettings _settings;
+
+      public:
+        explicit DatasetGenerator(DatasetGeneratorSettings settings = {});
+
+        [[nodiscard]] const DatasetGeneratorSettings& getSettings() const;
+
+        /**
+         * Generates the morphology with the given index.
+         * The dataset is used to define the neurite properties.
+         */
+        [[nodiscard]] std::shared_ptr<Morphology> generateMorphology(Dataset& dataset, size_t index) const;
+
+        /**
+         * Fills the given dataset. The caller must not hold any lock on the dataset.
+         */
+        void generate(Dataset& dataset) const;
+    };
+} // namespace mindset
+
+#endif //DATASETGENERATOR_H
@@ -0,0 +1,52 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#ifndef SWCWRITER_H
+#define SWCWRITER_H
+
+#include <filesystem>
+#include <ostream>
+#include <string>
+
+#include <mindset/Dataset.h>
+#include <mindset/util/Result.h>
+
+namespace mindset
+{
+    /**
+     * Writes the morphology in SWC format.
+     *
+     * Neurite UIDs are used as SWC ids, so SWCLoader produces the same UIDs when reading the file back.
+     * The soma nodes use the soma UID and its extra ids. Parents are always written before their children.
+     * Neurites without a position are skipped.
+     *
+     * @return The amount of written points or the error.
+     */
+    Result<size_t, std::string> writeSWC(const Dataset& dataset, const Morphology& morphology, std::ostream& out);
+
+    /**
+     * Writes the morphology into the given SWC file, creating its parent directories if needed.
+     *
+     * @return The amount of written points or the error.
+     */
+    Result<size_t, std::string> writeSWC(const Dataset& dataset, const Morphology& morphology,
+                                         const std::filesystem::path& path);
+} // namespace mindset
+
+#endif //SWCWRITER_H
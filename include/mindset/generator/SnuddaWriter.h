@@ -0,0 +1,57 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#ifndef SNUDDAWRITER_H
+#define SNUDDAWRITER_H
+
+#include <filesystem>
+#include <string>
+
+#include <mindset/Dataset.h>
+#include <mindset/util/Result.h>
+
+namespace mindset
+{
+    /**
+     * Writes the neurons and synapses of the dataset using the HDF5 layout read by SnuddaLoader.
+     *
+     * Morphologies are written as SWC files inside snuddaData/morphologies and referenced
+     * using the $SNUDDA_DATA prefix, so the loader must use snuddaData as its Snudda data path.
+     * Morphologies are named after their PROPERTY_NAME property when present.
+     * The morphology list is only written if all neurons have a morphology.
+     *
+     * Synapses are written in voxel coordinates using their post-synaptic position
+     * (or their position, if missing) and their post-synaptic neurite.
+     *
+     * @return The amount of written neurons or the error.
+     */
+    Result<size_t, std::string> writeSnuddaNetwork(const Dataset& dataset, const std::filesystem::path& file,
+                                                   const std::filesystem::path& snuddaData);
+
+    /**
+     * Writes the spikes and voltages of the given activity using the layout of Snudda output files.
+     * SnuddaLoader reads voltages with a 25 microseconds timestep.
+     *
+     * @return The amount of written neurons or the error.
+     */
+    Result<size_t, std::string> writeSnuddaActivity(const Dataset& dataset, const Activity& activity,
+                                                    const std::filesystem::path& file);
+} // namespace mindset
+
+#endif //SNUDDAWRITER_H
@@ -30,6 +30,8 @@
 
 namespace mindset
 {
+    class LoaderProgress;
+
     struct BlueConfigLoaderProperties
     {
         UID position; // "mindset:position"
@@ -70,23 +72,42 @@ namespace mindset
      */
     class BlueConfigLoader : public Loader
     {
+        struct HierarchyEntry
+        {
+            UID neuron;
+            UID column;
+            UID miniColumn;
+        };
+
         brion::BlueConfig _blueConfig;
 
         BlueConfigLoaderProperties initProperties(Dataset& dataset, bool shouldLoadMorphologies,
                                                   bool shouldLoadSynapses, bool shouldLoadHierarchy) const;
 
-        static void loadNeurons(Dataset& dataset, const BlueConfigLoaderProperties& properties,
-                                const brion::GIDSet& ids, const brain::Circuit& circuit,
-                                const std::map<std::string, std::shared_ptr<Morphology>>& morphologies);
+        static std::vector<Neuron> loadNeurons(
+            const BlueConfigLoaderProperties& properties, const brion::GIDSet& ids, const brain::Circuit& circuit,
+            const std::map<std::string, std::shared_ptr<Morphology>>& morphologies,
+            const Dataset::allocator_type& allocator);
 
         static std::map<std::string, std::shared_ptr<Morphology>> loadMorphologies(
-            const BlueConfigLoaderProperties& properties, const brion::GIDSet& ids, const brain::Circuit& circuit);
-
-        static void loadSynapses(Dataset& dataset, const BlueConfigLoaderProperties& properties,
-                                 const brion::GIDSet& ids, const brain::Circuit& circuit);
-
-        static void loadHierarchy(Dataset& dataset, const BlueConfigLoaderProperties& properties,
-                                  const brion::GIDSet& ids, const brion::Circuit& circuit);
+            const BlueConfigLoaderProperties& properties, const brion::GIDSet& ids, const brain::Circuit& circuit,
+            LoaderProgress& progress);
+
+        static std::vector<Synapse> loadSynapses(const std::vector<Neuron>& neurons,
+                                                 const BlueConfigLoaderProperties& properties,
+                                                 const brion::GIDSet& ids, const brain::Circuit& circuit,
+                                                 const Dataset& dataset, LoaderProgress& progress);
+
+        static std::vector<HierarchyEntry> loadHierarchy(std::vector<Neuron>& neurons,
+                                                         const BlueConfigLoaderProperties& properties,
+                                                         const brion::GIDSet& ids, const brion::Circuit& circuit);
+
+        /**
+         * Moves all the loaded data into the dataset.
+         * This is the only step that locks the dataset for writing.
+         */
+        static void commit(Dataset& dataset, std::vector<Neuron> neurons, std::vector<Synapse> synapses,
+                           const std::vector<HierarchyEntry>& hierarchy);
 
         static std::shared_ptr<Morphology> loadMorphology(const BlueConfigLoaderProperties& properties,
                                                           const brion::Morphology& morphology);
@@ -21,7 +21,9 @@
 #define LOADER_H
 
 #include <filesystem>
+#include <future>
 #include <istream>
+#include <stop_token>
 #include <string>
 
 #include <hey/Observable.h>
@@ -61,6 +63,7 @@ namespace mindset
     class Loader : public hey::Observable<LoaderStatus>
     {
         LoaderCreateInfo _info;
+        std::stop_token _stopToken;
 
       public:
         Loader(const LoaderCreateInfo& info);
@@ -103,6 +106,41 @@ namespace mindset
          */
         virtual void load(Dataset& dataset) const = 0;
 
+        /**
+         * Loads data into the provided dataset in a new thread.
+         *
+         * The loader checks the given token between chunks of work.
+         * If a stop is requested, the loader stops as soon as possible and
+         * reports a LoaderStatusType::CANCELLED status. Loaders don't modify
+         * the dataset until their commit step, so a cancelled load
+         * leaves the dataset untouched.
+         *
+         * This loader and the dataset must outlive the returned future.
+         *
+         * @param dataset The dataset to populate.
+         * @param stopToken The token used to cancel the load.
+         * @return A future holding the last status reported by the loader.
+         */
+        std::future<LoaderStatus> loadAsync(Dataset& dataset, std::stop_token stopToken = {});
+
+        /**
+         * Sets the token checked by this loader to know whether the load must be cancelled.
+         * This is done automatically by loadAsync(), but it can be used to cancel synchronous loads too.
+         * @param stopToken The token.
+         */
+        void setStopToken(std::stop_token stopToken);
+
+        /**
+         * Returns the token checked by this loader to know whether the load must be cancelled.
+         * Loaders that delegate work to other loaders should share this token with them.
+         */
+        [[nodiscard]] const std::stop_token& getStopToken() const;
+
+        /**
+         * Returns whether a cancellation has been requested through the stop token of this loader.
+         */
+        [[nodiscard]] bool isCancelled() const;
+
         /**
          * Adds a provider function for generating unique identifiers.
          * @param provider Function to generate UIDs.
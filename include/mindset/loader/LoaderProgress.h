@@ -0,0 +1,130 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#ifndef LOADERPROGRESS_H
+#define LOADERPROGRESS_H
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <mindset/loader/LoaderStatus.h>
+
+namespace mindset
+{
+    class Loader;
+
+    /**
+     * Helper used by loaders to report their progress and to check for cancellation.
+     *
+     * Progress updates are throttled: addProgress() can be called for every processed item
+     * without flooding the listeners of the loader.
+     * addProgress() and checkCancelled() can be called concurrently from several threads.
+     * Only the first final status (done, cancelled or error) is reported, and no loading status follows it.
+     */
+    class LoaderProgress
+    {
+        using Clock = std::chrono::steady_clock;
+
+        static constexpr std::chrono::milliseconds REPORT_INTERVAL{100};
+
+        const Loader* _loader;
+        size_t _stages;
+
+        std::mutex _mutex;
+        std::string _task;
+        size_t _stage;
+        size_t _itemsTotal;
+        std::atomic_size_t _items;
+        std::atomic_size_t _bytes;
+        std::atomic_bool _cancelled;
+        std::atomic_bool _finished;
+        Clock::time_point _stageStart;
+        Clock::time_point _lastReport;
+        std::vector<LoaderStageTiming> _timings;
+        bool _stageRunning;
+
+        LoaderStatus buildStatus(LoaderStatusType type) const;
+
+        void finishStage();
+
+        LoaderStatus buildFinalStatus(LoaderStatusType type, std::string task);
+
+        void notify(const LoaderStatus& status) const;
+
+        void notifyFinal(LoaderStatusType type, std::string task);
+
+      public:
+        /**
+         * Creates a progress reporter for the given loader.
+         * @param loader The loader whose listeners will receive the status updates.
+         * @param stages The amount of stages of the load.
+         */
+        LoaderProgress(const Loader& loader, size_t stages);
+
+        LoaderProgress(const LoaderProgress&) = delete;
+
+        LoaderProgress& operator=(const LoaderProgress&) = delete;
+
+        /**
+         * Starts a new stage, resetting the item and byte counters.
+         * @param stage The amount of stages completed before this one.
+         * @param task The description of the stage.
+         * @param itemsTotal The amount of items this stage will process. Zero if unknown.
+         */
+        void startStage(size_t stage, std::string task, size_t itemsTotal = 0);
+
+        /**
+         * Adds processed items and bytes to the current stage.
+         * The listeners are notified at most once every REPORT_INTERVAL.
+         */
+        void addProgress(size_t items, size_t bytes = 0);
+
+        /**
+         * Checks whether the loader has been cancelled.
+         * The first time a cancellation is detected, a LoaderStatusType::CANCELLED status is reported.
+         * @return Whether the load must stop.
+         */
+        bool checkCancelled();
+
+        /**
+         * Reports an error. The load is considered finished.
+         */
+        void reportError(const std::string& message);
+
+        /**
+         * Reports that the load has finished successfully.
+         */
+        void reportDone();
+
+        /**
+         * Returns a snapshot of the current status.
+         */
+        [[nodiscard]] LoaderStatus getStatus();
+
+        /**
+         * Returns the timings of the stages finished so far.
+         */
+        [[nodiscard]] std::vector<LoaderStageTiming> getStageTimings();
+    };
+} // namespace mindset
+
+#endif //LOADERPROGRESS_H
@@ -20,6 +20,10 @@
 #ifndef LOADERSTATUS_H
 #define LOADERSTATUS_H
 
+#include <cstddef>
+#include <string>
+#include <vector>
+
 namespace mindset
 {
 
@@ -35,7 +39,24 @@ namespace mindset
         /// Loading has completed successfully.
         DONE,
         /// Loading encountered an error.
-        LOADING_ERROR
+        LOADING_ERROR,
+        /// Loading was cancelled before committing its data into the dataset.
+        CANCELLED
+    };
+
+    /**
+     * Aggregated timing of a finished loading stage.
+     */
+    struct LoaderStageTiming
+    {
+        /// Description of the stage.
+        std::string task;
+        /// Wall time spent in the stage.
+        double seconds = 0.0;
+        /// Number of items processed in the stage.
+        size_t items = 0;
+        /// Number of bytes processed in the stage.
+        size_t bytes = 0;
     };
 
     /**
@@ -44,13 +65,26 @@ namespace mindset
     struct LoaderStatus
     {
         /// Current status of the loader.
-        LoaderStatusType status;
+        LoaderStatusType status = LoaderStatusType::READY;
         /// Description of the current task.
         std::string currentTask;
         /// Total number of loading stages.
-        size_t stages;
+        size_t stages = 0;
         /// Number of completed stages.
-        size_t stagesCompleted;
+        size_t stagesCompleted = 0;
+        /// Number of items (lines, neurons, synapses...) processed in the current stage.
+        size_t itemsProcessed = 0;
+        /// Total number of items of the current stage. Zero if unknown.
+        size_t itemsTotal = 0;
+        /// Number of bytes processed in the current stage.
+        size_t bytesProcessed = 0;
+        /// Items processed per second in the current stage.
+        double itemsPerSecond = 0.0;
+        /// Bytes processed per second in the current stage.
+        double bytesPerSecond = 0.0;
+        /// Timings of the finished stages, in order.
+        /// Only filled in the final status (DONE, LOADING_ERROR or CANCELLED).
+        std::vector<LoaderStageTiming> stageTimings;
     };
 
 } // namespace mindset
@@ -0,0 +1,117 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#ifndef SWCBATCHLOADER_H
+#define SWCBATCHLOADER_H
+
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <mindset/Dataset.h>
+#include <mindset/UID.h>
+#include <mindset/loader/Loader.h>
+
+namespace mindset
+{
+    static const std::string SWC_BATCH_LOADER_ID = "mindset:loader_swc_batch";
+    static const std::string SWC_BATCH_LOADER_NAME = "SWC (batch)";
+    static const std::string SWC_BATCH_LOADER_ENTRY_THREADS = "mindset:threads";
+    static const std::string SWC_BATCH_LOADER_ENTRY_RECURSIVE = "mindset:recursive";
+    static const std::string SWC_BATCH_LOADER_ENTRY_UID_FROM_FILENAME = "mindset:uid_from_filename";
+
+    /**
+     * Maps the path of an SWC file to the UID of the neuron that will hold its morphology.
+     * Returning an empty optional makes the loader use the next free UID.
+     */
+    using SWCBatchUIDMapping = std::function<std::optional<UID>(const std::filesystem::path&)>;
+
+    /**
+     * Loads many SWC files at once.
+     *
+     * The files can be given as a directory, a glob pattern (e.g. "*.swc" inside a folder) or a list of paths.
+     * If the loader has a FileProvider, the paths are resolved through it; otherwise, they are read from disk.
+     *
+     * All files are parsed in parallel without accessing the dataset.
+     * Then, all neurons are inserted in a single commit step.
+     *
+     * Neuron UIDs are assigned in path order using, by priority:
+     * the UID provider, the UID mapping, the numeric filename (e.g. "42.swc") and the next free UID.
+     */
+    class SWCBatchLoader : public Loader
+    {
+        std::vector<std::filesystem::path> _paths;
+        std::function<UID()> _provider;
+        SWCBatchUIDMapping _mapping;
+
+      public:
+        /**
+         * Creates a loader for the given files.
+         */
+        SWCBatchLoader(const LoaderCreateInfo& info, std::vector<std::filesystem::path> paths);
+
+        /**
+         * Creates a loader for all SWC files inside a directory, all files matching a glob pattern,
+         * or a single SWC file.
+         * Directories are traversed recursively if the "mindset:recursive" entry is set.
+         */
+        SWCBatchLoader(const LoaderCreateInfo& info, const std::filesystem::path& path);
+
+        /**
+         * Creates a loader from a file list, one path per line.
+         */
+        SWCBatchLoader(const LoaderCreateInfo& info, const std::vector<std::string>& lines);
+
+        /**
+         * Returns the files this loader will load, sorted.
+         */
+        [[nodiscard]] const std::vector<std::filesystem::path>& getPaths() const;
+
+        void addUIDProvider(std::function<UID()> provider) override;
+
+        /**
+         * Sets the function used to assign neuron UIDs from file paths.
+         * This mapping has priority over the numeric filename mapping, but not over UID providers.
+         */
+        void setUIDMapping(SWCBatchUIDMapping mapping);
+
+        void load(Dataset& dataset) const override;
+
+        /**
+         * Parses the stem of the given path as a UID. "data/42.swc" returns 42.
+         */
+        static std::optional<UID> uidFromFilename(const std::filesystem::path& path);
+
+        /**
+         * Returns whether the given pattern contains glob wildcards ('*' or '?').
+         */
+        static bool isGlobPattern(const std::string& pattern);
+
+        /**
+         * Matches a filename against a glob pattern. Supports '*' and '?'.
+         */
+        static bool matchesGlob(std::string_view name, std::string_view pattern);
+
+        static LoaderFactory createFactory();
+    };
+} // namespace mindset
+
+#endif //SWCBATCHLOADER_H
@@ -33,9 +33,24 @@
 namespace mindset
 {
 
+    class LoaderProgress;
+
     static const std::string SWC_LOADER_ID = "mindset:loader_swc";
     static const std::string SWC_LOADER_NAME = "SWC";
 
+    /**
+     * The UIDs of the properties used by the SWC loader.
+     * Defining them beforehand allows parsing SWC files without accessing the dataset.
+     */
+    struct SWCLoaderProperties
+    {
+        UID position;    // "mindset:position"
+        UID radius;      // "mindset:radius"
+        UID parent;      // "mindset:parent"
+        UID neuriteType; // "mindset:neurite_type"
+        UID path;        // "mindset:path"
+    };
+
     /**
     * This is an auxiliary SWC Loader that doesn't require Brion to work.
     */
@@ -56,6 +71,9 @@ namespace mindset
 
         [[nodiscard]] Result<SWCSegment, std::string> toSegment(size_t lineIndex) const;
 
+        [[nodiscard]] Result<std::shared_ptr<Morphology>, std::string> parseMorphology(
+            const SWCLoaderProperties& properties, LoaderProgress& progress, size_t firstStage) const;
+
       public:
         explicit SWCLoader(const LoaderCreateInfo& info, const std::vector<std::string>& lines);
 
@@ -67,8 +85,24 @@ namespace mindset
 
         void addUIDProvider(std::function<UID()> provider) override;
 
+        /**
+         * Defines the properties used by SWC morphologies inside the given dataset.
+         * This method locks the dataset for writing.
+         */
+        static SWCLoaderProperties initProperties(Dataset& dataset);
+
+        /**
+         * Defines the SWC properties inside the dataset and parses the morphology.
+         * The morphology is not added to the dataset.
+         */
         Result<std::shared_ptr<Morphology>, std::string> loadMorphology(Dataset& dataset) const;
 
+        /**
+         * Parses the morphology using already defined properties.
+         * This method doesn't access any dataset, so several SWC files can be parsed concurrently.
+         */
+        Result<std::shared_ptr<Morphology>, std::string> loadMorphology(const SWCLoaderProperties& properties) const;
+
         void load(Dataset& dataset) const override;
 
         static LoaderFactory createFactory();
@@ -22,11 +22,15 @@
 
 #include <filesystem>
 
+#include <mindset/EventSequence.h>
+#include <mindset/TimeGrid.h>
 #include <mindset/loader/Loader.h>
 #include <highfive/H5File.hpp>
 
 namespace mindset
 {
+    class LoaderProgress;
+
     static const std::string SNUDDA_LOADER_ID = "mindset:loader_snudda";
     static const std::string SNUDDA_LOADER_NAME = "Snudda";
     static const std::string SNUDDA_LOADER_ENTRY_SNUDDA_DATA_PATH = "mindset:snudda_data_path";
@@ -103,23 +107,40 @@ namespace mindset
      */
     class SnuddaLoader : public Loader
     {
+        struct SnuddaActivity
+        {
+            EventSequence<std::monostate> spikes;
+            std::optional<TimeGrid<double>> voltage;
+        };
+
         HighFive::File _file;
 
         SnuddaLoaderProperties initProperties(Dataset& dataset, const std::string& snuddaPath,
                                               std::vector<uint64_t> ids) const;
 
-        void loadNeurons(Dataset& dataset,
-                         const std::unordered_map<std::string, std::shared_ptr<Morphology>>& morphologies,
-                         const SnuddaLoaderProperties& properties) const;
+        std::vector<Neuron> loadNeurons(
+            const std::unordered_map<std::string, std::shared_ptr<Morphology>>& morphologies,
+            const SnuddaLoaderProperties& properties, const Dataset::allocator_type& allocator,
+            LoaderProgress& progress) const;
 
         Result<std::unordered_map<std::string, std::shared_ptr<Morphology>>, std::string> loadMorphologies(
-            const SnuddaLoaderProperties& properties, Dataset& dataset) const;
+            const SnuddaLoaderProperties& properties, Dataset& dataset, LoaderProgress& progress) const;
+
+        std::vector<Synapse> loadSynapses(const Dataset& dataset, const std::vector<Neuron>& neurons,
+                                          const SnuddaLoaderProperties& properties, LoaderProgress& progress) const;
 
-        void loadSynapses(Dataset& dataset, const SnuddaLoaderProperties& properties) const;
+        std::optional<SnuddaActivity> loadOutputActivity(const SnuddaLoaderProperties& properties,
+                                                         LoaderProgress& progress) const;
 
-        void loadOutputActivity(Dataset& dataset, const SnuddaLoaderProperties& properties) const;
+        std::optional<SnuddaActivity> loadInputActivity(const SnuddaLoaderProperties& properties,
+                                                        LoaderProgress& progress) const;
 
-        void loadInputActivity(Dataset& dataset, const SnuddaLoaderProperties& properties) const;
+        /**
+         * Moves all the loaded data into the dataset.
+         * This is the only step that locks the dataset for writing.
+         */
+        void commit(Dataset& dataset, std::vector<Neuron> neurons, std::vector<Synapse> synapses,
+                    std::vector<SnuddaActivity> activities, const SnuddaLoaderProperties& properties) const;
 
       public:
         explicit SnuddaLoader(const LoaderCreateInfo& info, const std::filesystem::path& path);
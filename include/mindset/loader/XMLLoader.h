@@ -23,6 +23,7 @@
 #include <functional>
 #include <string>
 #include <optional>
+#include <vector>
 
 #include <pugixml.hpp>
 
@@ -36,9 +37,14 @@ namespace mindset
 
     static const std::string XML_LOADER_ID = "mindset:loader_xml";
     static const std::string XML_LOADER_NAME = "XML";
+    static const std::string XML_LOADER_ENTRY_THREADS = "mindset:threads";
 
     /**
     * This loader loads XML Scene files.
+    *
+    * The SWC files referenced by the scene are parsed in parallel, and each file is parsed once
+    * even if several morphology entries reference it. The file provider may be invoked concurrently.
+    * The maximum amount of threads is read from the environment entry "mindset:threads" (zero uses all cores).
     */
     class XMLLoader : public Loader
     {
@@ -57,14 +63,24 @@ namespace mindset
         using FileProvider = std::function<std::optional<std::vector<std::string>>(std::filesystem::path)>;
 
       private:
+        std::vector<char> _buffer;
         pugi::xml_document _doc;
         bool _valid;
 
       public:
+        /**
+         * Parses a copy of the given data.
+         */
         XMLLoader(const LoaderCreateInfo& info, const void* data, size_t size);
 
+        /**
+         * Reads the whole stream into a buffer owned by the loader and parses it in place.
+         */
         XMLLoader(const LoaderCreateInfo& info, std::istream& stream);
 
+        /**
+         * Reads the whole file into a buffer owned by the loader and parses it in place.
+         */
         XMLLoader(const LoaderCreateInfo& info, std::filesystem::path path);
 
         void load(Dataset& dataset) const override;
@@ -0,0 +1,171 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#ifndef PREDICATE_H
+#define PREDICATE_H
+
+#include <any>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include <mindset/PropertyHolder.h>
+#include <mindset/UID.h>
+
+namespace mindset
+{
+    /**
+     * A constant a property can be compared to.
+     * Integers match any integral or enum property (e.g. UID, NeuriteType),
+     * doubles match any numeric property and strings match std::string properties.
+     */
+    using PredicateValue = std::variant<int64_t, double, std::string>;
+
+    /**
+     * Returns the given property value as an integer, if it is an integral or a known enum type.
+     */
+    std::optional<int64_t> propertyAsInteger(const std::any& value);
+
+    /**
+     * Returns the given property value as a double, if it is numeric.
+     */
+    std::optional<double> propertyAsNumber(const std::any& value);
+
+    /**
+     * Returns whether the given property value is equal to the given constant.
+     */
+    bool propertyEquals(const std::any& value, const PredicateValue& constant);
+
+    enum class PredicateType
+    {
+        /// Matches every element.
+        ALWAYS,
+        /// The property is equal to a value.
+        EQUALS,
+        /// The property is equal to any of the given values.
+        IN,
+        /// The property is a number inside [min, max].
+        RANGE,
+        /// The property is present.
+        EXISTS,
+        /// All children match.
+        AND,
+        /// Any child matches.
+        OR,
+        /// The only child doesn't match.
+        NOT,
+        /// A user function matches.
+        CUSTOM
+    };
+
+    /**
+     * A declarative filter over the properties of neurons or synapses.
+     *
+     * Predicates refer to properties by name, so they can be created before the dataset is loaded.
+     * They are combined using the operators &&, || and !:
+     *
+     * auto predicate = Predicate::equals(PROPERTY_LAYER, 5) && Predicate::equals(PROPERTY_COLUMN, 3);
+     *
+     * Predicates are immutable and cheap to copy.
+     */
+    class Predicate
+    {
+      public:
+        /**
+         * A user function. It may be invoked concurrently from several threads.
+         */
+        using Custom = std::function<bool(UID uid, const PropertyHolder& holder)>;
+
+      private:
+        PredicateType _type;
+        std::string _property;
+        std::vector<PredicateValue> _values;
+        double _min;
+        double _max;
+        std::vector<Predicate> _children;
+        std::shared_ptr<const Custom> _custom;
+
+        explicit Predicate(PredicateType type);
+
+      public:
+        /**
+         * Creates a predicate that matches every element.
+         */
+        static Predicate always();
+
+        static Predicate equals(std::string property, PredicateValue value);
+
+        static Predicate in(std::string property, std::vector<PredicateValue> values);
+
+        /**
+         * Matches numeric properties inside the inclusive range [min, max].
+         */
+        static Predicate range(std::string property, double min, double max);
+
+        /**
+         * Matches numeric properties greater or equal than the given value.
+         */
+        static Predicate atLeast(std::string property, double min);
+
+        /**
+         * Matches numeric properties less or equal than the given value.
+         */
+        static Predicate atMost(std::string property, double max);
+
+        static Predicate exists(std::string property);
+
+        static Predicate custom(Custom function);
+
+        static Predicate all(std::vector<Predicate> predicates);
+
+        static Predicate any(std::vector<Predicate> predicates);
+
+        static Predicate negate(Predicate predicate);
+
+        [[nodiscard]] PredicateType getType() const;
+
+        /**
+         * The name of the property used by EQUALS, IN, RANGE and EXISTS predicates.
+         */
+        [[nodiscard]] const std::string& getProperty() const;
+
+        [[nodiscard]] const std::vector<PredicateValue>& getValues() const;
+
+        [[nodiscard]] double getMin() const;
+
+        [[nodiscard]] double getMax() const;
+
+        [[nodiscard]] const std::vector<Predicate>& getChildren() const;
+
+        [[nodiscard]] const Custom* getCustom() const;
+
+        Predicate operator&&(const Predicate& other) const;
+
+        Predicate operator||(const Predicate& other) const;
+
+        Predicate operator!() const;
+    };
+} // namespace mindset
+
+#endif //PREDICATE_H
@@ -0,0 +1,124 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#ifndef PROPERTYINDEX_H
+#define PROPERTYINDEX_H
+
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <mindset/PropertyHolder.h>
+#include <mindset/UID.h>
+#include <mindset/query/Predicate.h>
+#include <mindset/query/UIDSet.h>
+
+namespace mindset
+{
+    /**
+     * The elements an index is built from: pairs of element UIDs and their property holders.
+     */
+    using IndexedElements = std::vector<std::pair<UID, const PropertyHolder*>>;
+
+    enum class IndexType
+    {
+        /// Bitmap index for properties with few distinct integral values, such as layers or neurite types.
+        CATEGORICAL,
+        /// Sorted index for numeric properties, such as efficacies or delays.
+        RANGE
+    };
+
+    /**
+     * Index mapping each distinct integral value of a property to a bitmap of the elements holding it.
+     * Floating-point values are indexed by the integer they are equal to, following propertyEquals().
+     * Elements whose property is missing or is not integral are not indexed.
+     */
+    class CategoricalIndex
+    {
+        std::vector<UID> _elements;
+        std::unordered_map<int64_t, std::vector<uint64_t>> _bitmaps;
+        /// False if some integral floating-point value was too large to be indexed exactly.
+        bool _exact = true;
+
+        void decode(const std::vector<uint64_t>& bitmap, std::vector<UID>& out) const;
+
+      public:
+        CategoricalIndex() = default;
+
+        /**
+         * Builds the index.
+         * @param elements The elements to index.
+         * @param property The UID of the indexed property.
+         * @param threads The maximum amount of threads to use. Zero uses all available cores.
+         */
+        CategoricalIndex(IndexedElements elements, UID property, size_t threads = 0);
+
+        /**
+         * Returns the distinct values of the indexed property.
+         */
+        [[nodiscard]] std::vector<int64_t> getCategories() const;
+
+        /**
+         * Returns the elements whose property is equal to the given value.
+         * Elements holding floating-point values too large to be indexed exactly are not returned.
+         */
+        [[nodiscard]] UIDSet find(int64_t value) const;
+
+        /**
+         * Returns the elements whose property is equal to any of the given values, as propertyEquals() does.
+         * Returns an empty optional if any value is not integral, or if the index is not exact,
+         * as those can't be answered by this index.
+         */
+        [[nodiscard]] std::optional<UIDSet> find(const std::vector<PredicateValue>& values) const;
+    };
+
+    /**
+     * Index sorting the elements by the numeric value of a property.
+     * Elements whose property is missing or is not numeric are not indexed.
+     */
+    class RangeIndex
+    {
+        std::vector<std::pair<double, UID>> _entries;
+
+      public:
+        RangeIndex() = default;
+
+        /**
+         * Builds the index.
+         * @param elements The elements to index.
+         * @param property The UID of the indexed property.
+         * @param threads The maximum amount of threads to use. Zero uses all available cores.
+         */
+        RangeIndex(const IndexedElements& elements, UID property, size_t threads = 0);
+
+        /**
+         * Returns the elements whose property is inside the inclusive range [min, max].
+         */
+        [[nodiscard]] UIDSet find(double min, double max) const;
+
+        /**
+         * Returns the amount of indexed elements.
+         */
+        [[nodiscard]] size_t size() const;
+    };
+} // namespace mindset
+
+#endif //PROPERTYINDEX_H
@@ -0,0 +1,125 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#ifndef QUERYENGINE_H
+#define QUERYENGINE_H
+
+#include <functional>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include <mindset/Dataset.h>
+#include <mindset/query/Predicate.h>
+#include <mindset/query/PropertyIndex.h>
+#include <mindset/query/UIDSet.h>
+
+namespace mindset
+{
+    /**
+     * Evaluates predicates over the neurons and synapses of a dataset.
+     *
+     * Queries are answered from secondary indexes when the predicate allows it;
+     * the remaining conditions are evaluated in parallel over the candidates,
+     * or over every element when no index applies.
+     *
+     * Indexes are tagged with the version of the dataset (neurons) or circuit (synapses)
+     * they were built from and are ignored once it changes.
+     * Modifying the properties of elements that are already indexed doesn't change those versions:
+     * call rebuildIndexes() after doing so.
+     *
+     * The caller must hold a read lock on the dataset while building indexes or querying.
+     */
+    class QueryEngine
+    {
+      public:
+        using Lookup = std::function<std::optional<const PropertyHolder*>(UID)>;
+        using Collector = std::function<IndexedElements()>;
+
+      private:
+        struct Indexes
+        {
+            std::unordered_map<std::string, IndexType> requested;
+            std::unordered_map<UID, CategoricalIndex> categorical;
+            std::unordered_map<UID, RangeIndex> range;
+            uint64_t version = 0;
+            bool built = false;
+        };
+
+        const Dataset* _dataset;
+        Indexes _neuronIndexes;
+        Indexes _synapseIndexes;
+
+        void rebuild(Indexes& indexes, const IndexedElements& elements, uint64_t version, size_t threads) const;
+
+        [[nodiscard]] UIDSet query(const Indexes& indexes, const Collector& collector, const Lookup& lookup,
+                                   uint64_t version, const Predicate& predicate, size_t threads) const;
+
+        [[nodiscard]] IndexedElements neuronElements() const;
+
+        [[nodiscard]] IndexedElements synapseElements() const;
+
+      public:
+        explicit QueryEngine(const Dataset& dataset);
+
+        /**
+         * Requests an index over a neuron property. The index is built on the next call to rebuildIndexes().
+         * @param property The name of the property.
+         * @param type The kind of index.
+         */
+        void addNeuronIndex(std::string property, IndexType type);
+
+        /**
+         * Requests an index over a synapse property. The index is built on the next call to rebuildIndexes().
+         * @param property The name of the property.
+         * @param type The kind of index.
+         */
+        void addSynapseIndex(std::string property, IndexType type);
+
+        /**
+         * Builds all requested indexes from the current state of the dataset.
+         * @param threads The maximum amount of threads to use. Zero uses all available cores.
+         */
+        void rebuildIndexes(size_t threads = 0);
+
+        /**
+         * Returns whether the neuron indexes were built from the current version of the dataset.
+         */
+        [[nodiscard]] bool areNeuronIndexesUpToDate() const;
+
+        /**
+         * Returns whether the synapse indexes were built from the current version of the circuit.
+         */
+        [[nodiscard]] bool areSynapseIndexesUpToDate() const;
+
+        /**
+         * Returns the UIDs of the neurons matching the given predicate.
+         * @param threads The maximum amount of threads to use. Zero uses all available cores.
+         */
+        [[nodiscard]] UIDSet queryNeurons(const Predicate& predicate, size_t threads = 0) const;
+
+        /**
+         * Returns the UIDs of the synapses matching the given predicate.
+         * @param threads The maximum amount of threads to use. Zero uses all available cores.
+         */
+        [[nodiscard]] UIDSet querySynapses(const Predicate& predicate, size_t threads = 0) const;
+    };
+} // namespace mindset
+
+#endif //QUERYENGINE_H
@@ -0,0 +1,95 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#ifndef UIDSET_H
+#define UIDSET_H
+
+#include <algorithm>
+#include <initializer_list>
+#include <vector>
+
+#include <mindset/UID.h>
+
+namespace mindset
+{
+    /**
+     * A compact, immutable set of UIDs stored as a sorted vector.
+     *
+     * UIDSets use a fraction of the memory of an std::unordered_set and support fast
+     * set operations, making them suitable to store the results of large queries.
+     */
+    class UIDSet
+    {
+        std::vector<UID> _uids;
+
+      public:
+        using const_iterator = std::vector<UID>::const_iterator;
+
+        /**
+         * Creates an empty set.
+         */
+        UIDSet() = default;
+
+        /**
+         * Creates a set from the given UIDs. The UIDs don't need to be sorted or unique.
+         */
+        explicit UIDSet(std::vector<UID> uids);
+
+        UIDSet(std::initializer_list<UID> uids);
+
+        /**
+         * Creates a set from UIDs that are already sorted and unique. No checks are performed.
+         */
+        static UIDSet fromSorted(std::vector<UID> uids);
+
+        [[nodiscard]] bool contains(UID uid) const;
+
+        [[nodiscard]] size_t size() const;
+
+        [[nodiscard]] bool empty() const;
+
+        [[nodiscard]] const_iterator begin() const;
+
+        [[nodiscard]] const_iterator end() const;
+
+        /**
+         * Returns the sorted UIDs of this set.
+         */
+        [[nodiscard]] const std::vector<UID>& getUIDs() const;
+
+        /**
+         * Returns the UIDs present in both sets.
+         */
+        [[nodiscard]] UIDSet intersect(const UIDSet& other) const;
+
+        /**
+         * Returns the UIDs present in any of the sets.
+         */
+        [[nodiscard]] UIDSet unite(const UIDSet& other) const;
+
+        /**
+         * Returns the UIDs of this set that are not present in the other set.
+         */
+        [[nodiscard]] UIDSet subtract(const UIDSet& other) const;
+
+        bool operator==(const UIDSet& other) const = default;
+    };
+} // namespace mindset
+
+#endif //UIDSET_H
@@ -0,0 +1,184 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#ifndef LIFSIMULATOR_H
+#define LIFSIMULATOR_H
+
+#include <chrono>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <mindset/Dataset.h>
+#include <mindset/DefaultProperties.h>
+#include <mindset/EventSequence.h>
+#include <mindset/TimeGrid.h>
+#include <mindset/UID.h>
+
+namespace mindset
+{
+    /**
+     * The parameters of a leaky integrate-and-fire neuron with exponential, current-based synapses.
+     *
+     * Currents are expressed as the voltage they would sustain across the membrane resistance,
+     * so synaptic weights are in millivolts:
+     * - dV/dt = (restingPotential - V + I + externalInput) / membraneTimeConstant
+     * - dI/dt = -I / synapticTimeConstant
+     *
+     * The defaults match NEST's iaf_psc_exp model.
+     */
+    struct LIFParameters
+    {
+        /// The resting potential, in millivolts.
+        double restingPotential = -70.0;
+        /// The potential after a spike, in millivolts.
+        double resetPotential = -70.0;
+        /// The potential that triggers a spike, in millivolts.
+        double threshold = -55.0;
+        /// The constant input of every neuron, in millivolts.
+        double externalInput = 0.0;
+        std::chrono::nanoseconds membraneTimeConstant = std::chrono::milliseconds(10);
+        std::chrono::nanoseconds synapticTimeConstant = std::chrono::milliseconds(2);
+        /// The time after a spike during which the potential is clamped to the reset potential.
+        std::chrono::nanoseconds refractoryPeriod = std::chrono::milliseconds(2);
+    };
+
+    struct LIFSimulationSettings
+    {
+        LIFParameters neuron;
+        /// The integration timestep.
+        std::chrono::nanoseconds timestep = std::chrono::microseconds(100);
+        /// The synapse property holding the weight of each synapse, in millivolts.
+        std::string weightProperty = PROPERTY_SYNAPSE_EFFICACY;
+        /// The synapse property holding the delay of each synapse, in milliseconds.
+        std::string delayProperty = PROPERTY_SYNAPSE_DELAY;
+        /// The weight of the synapses without a numeric weight.
+        float defaultWeight = 1.0f;
+        /// The delay of the synapses without a numeric delay.
+        /// Delays are rounded to whole timesteps, and are at least one timestep long.
+        std::chrono::nanoseconds defaultDelay = std::chrono::milliseconds(1);
+        /// The rate of the Poisson background input of each neuron, in hertz.
+        double backgroundRate = 0.0;
+        /// The weight of each background input, in millivolts.
+        float backgroundWeight = 0.0f;
+        /// The seed of the background input.
+        uint64_t seed = 0;
+        /// The interval between voltage samples. Zero disables the voltage recording.
+        /// The interval is rounded to whole timesteps.
+        std::chrono::nanoseconds voltageDelta = std::chrono::nanoseconds::zero();
+        /// The maximum amount of threads to use. Zero uses defaultThreadCount().
+        size_t threads = 0;
+    };
+
+    /**
+     * A point-neuron simulation of the circuit of a dataset, using leaky integrate-and-fire neurons.
+     *
+     * The connectivity is packed on construction into compressed sparse rows of weights and delays,
+     * sorted by target. Neurons are integrated exactly using exponential propagators, and spikes are
+     * delivered into a ring buffer of the input of the upcoming timesteps, one slot per timestep of delay.
+     *
+     * Each step is processed in parallel by partitions of neurons. Every partition delivers the spikes
+     * of the previous step to its own neurons, so no synchronization is needed besides the step barrier.
+     * Background input uses a counter-based generator, making results independent of the amount of threads.
+     *
+     * The simulator doesn't track changes of the dataset: build a new one after modifying the circuit.
+     * The caller must hold a read lock on the dataset while building.
+     */
+    class LIFSimulator
+    {
+        LIFSimulationSettings _settings;
+        std::vector<UID> _neurons;
+
+        std::vector<uint64_t> _offsets;
+        std::vector<uint32_t> _targets;
+        std::vector<float> _weights;
+        std::vector<uint32_t> _delays;
+
+        size_t _ringSize;
+        std::vector<float> _ring;
+        std::vector<double> _voltages;
+        std::vector<double> _currents;
+        std::vector<uint64_t> _refractoryUntil;
+        std::vector<uint32_t> _spiking;
+        uint64_t _step;
+
+        std::vector<std::pair<uint64_t, uint32_t>> _spikes;
+        std::vector<std::vector<double>> _voltageSamples;
+
+      public:
+        /**
+         * Packs the neurons and synapses of the dataset.
+         * Synapses whose neurons are not in the dataset are skipped.
+         * All neurons start at their resting potential.
+         */
+        explicit LIFSimulator(const Dataset& dataset, const LIFSimulationSettings& settings = {});
+
+        [[nodiscard]] size_t getNeuronsAmount() const;
+
+        [[nodiscard]] size_t getSynapsesAmount() const;
+
+        /**
+         * Returns the UIDs of the simulated neurons, sorted.
+         */
+        [[nodiscard]] std::span<const UID> getNeurons() const;
+
+        /**
+         * Returns the simulated time.
+         */
+        [[nodiscard]] std::chrono::nanoseconds getTime() const;
+
+        /**
+         * Returns the current membrane potential of each neuron, matching getNeurons().
+         */
+        [[nodiscard]] std::span<const double> getVoltages() const;
+
+        /**
+         * Advances the simulation by the given duration, rounded up to whole timesteps.
+         */
+        void run(std::chrono::nanoseconds duration);
+
+        /**
+         * Returns the amount of spikes recorded so far.
+         */
+        [[nodiscard]] size_t getSpikesAmount() const;
+
+        /**
+         * Returns the recorded spikes. The UID of each event is the spiking neuron.
+         */
+        [[nodiscard]] EventSequence<std::monostate> getSpikes() const;
+
+        /**
+         * Returns the recorded membrane potentials. Empty if the voltage recording is disabled.
+         */
+        [[nodiscard]] TimeGrid<double> getVoltageGrid() const;
+
+        /**
+         * Adds the recorded spikes and voltages to the dataset as a new Activity,
+         * using PROPERTY_ACTIVITY_SPIKES and PROPERTY_ACTIVITY_VOLTAGE.
+         * This method acquires a write lock on the dataset.
+         * @return The UID of the new activity.
+         */
+        UID writeActivity(Dataset& dataset) const;
+    };
+} // namespace mindset
+
+#endif //LIFSIMULATOR_H
@@ -0,0 +1,149 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#ifndef SPIKEPROPAGATION_H
+#define SPIKEPROPAGATION_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+#include <mindset/Dataset.h>
+#include <mindset/DefaultProperties.h>
+#include <mindset/EventSequence.h>
+#include <mindset/TimeGrid.h>
+#include <mindset/UID.h>
+
+namespace mindset
+{
+    /**
+     * A pre-synaptic spike arriving at a synapse.
+     */
+    struct SpikeArrival
+    {
+        std::chrono::nanoseconds time;
+        /// The UID of the synapse.
+        UID synapse;
+        /// The UID of the post-synaptic neuron.
+        UID neuron;
+        /// The index of the post-synaptic neuron in SpikePropagator::getNeurons().
+        uint32_t target;
+        /// The efficacy of the synapse.
+        float efficacy;
+    };
+
+    struct SpikePropagationSettings
+    {
+        /// The synapse property holding the delay of each synapse, in milliseconds.
+        std::string delayProperty = PROPERTY_SYNAPSE_DELAY;
+        /// The synapse property holding the efficacy of each synapse.
+        std::string efficacyProperty = PROPERTY_SYNAPSE_EFFICACY;
+        /// The delay of the synapses without a numeric delay. Negative delays are clamped to zero.
+        std::chrono::nanoseconds defaultDelay = std::chrono::nanoseconds::zero();
+        /// The efficacy of the synapses without a numeric efficacy.
+        float defaultEfficacy = 1.0f;
+        /// The width of the processing windows. Only the arrivals of one window are held in memory at once.
+        std::chrono::nanoseconds window = std::chrono::milliseconds(10);
+        /// The maximum amount of threads to use. Zero uses defaultThreadCount().
+        size_t threads = 0;
+    };
+
+    /**
+     * Propagates pre-synaptic spikes to the synapses of a circuit, using the delay of each synapse.
+     *
+     * The outgoing synapses of each neuron are packed into contiguous arrays once, on construction.
+     * Arrivals are scheduled into a ring of time buckets one window wide, which covers the longest delay:
+     * the spikes of each window are expanded in parallel into per-thread buckets and, once the window
+     * has been processed, its bucket is sorted and handed to the caller.
+     * Buckets keep their memory between windows, so propagating doesn't allocate per spike or per arrival.
+     *
+     * The propagator doesn't track changes of the dataset: build a new one after modifying the circuit.
+     * The caller must hold a read lock on the dataset while building.
+     */
+    class SpikePropagator
+    {
+        std::vector<UID> _neurons;
+        std::unordered_map<UID, uint32_t> _indices;
+
+        std::vector<uint64_t> _offsets;
+        std::vector<UID> _synapses;
+        std::vector<uint32_t> _targets;
+        std::vector<std::chrono::nanoseconds> _delays;
+        std::vector<float> _efficacies;
+
+        std::chrono::nanoseconds _maxDelay;
+        std::chrono::nanoseconds _window;
+        size_t _threads;
+
+      public:
+        /**
+         * Packs the synapses of the dataset.
+         * Synapses whose neurons are not in the dataset are skipped.
+         */
+        explicit SpikePropagator(const Dataset& dataset, const SpikePropagationSettings& settings = {});
+
+        /**
+         * Returns the UIDs of the neurons of the dataset, sorted.
+         */
+        [[nodiscard]] std::span<const UID> getNeurons() const;
+
+        /**
+         * Returns the amount of synapses that spikes are propagated to.
+         */
+        [[nodiscard]] size_t getSynapsesAmount() const;
+
+        /**
+         * Returns the longest delay of the synapses.
+         */
+        [[nodiscard]] std::chrono::nanoseconds getMaxDelay() const;
+
+        /**
+         * Propagates the spikes and streams the arrivals window by window.
+         *
+         * The callback receives the arrivals of each window sorted by time and synapse,
+         * and windows are delivered in chronological order. The span is only valid during the call.
+         * Spikes of neurons without outgoing synapses are ignored.
+         *
+         * @param spikes The pre-synaptic spikes. The UID of each event is the spiking neuron.
+         * @param callback The function invoked for each window containing arrivals.
+         */
+        void propagate(const EventSequence<std::monostate>& spikes,
+                       const std::function<void(std::span<const SpikeArrival>)>& callback) const;
+
+        /**
+         * Propagates the spikes and collects every arrival.
+         * The UID of each event is the synapse and its value is the efficacy of the synapse.
+         */
+        [[nodiscard]] EventSequence<float> computeArrivals(const EventSequence<std::monostate>& spikes) const;
+
+        /**
+         * Propagates the spikes and sums the efficacies arriving at each neuron in bins of the given width.
+         * The grid contains every neuron of the dataset, sorted by UID, and starts at time zero.
+         */
+        [[nodiscard]] TimeGrid<double> computeInput(const EventSequence<std::monostate>& spikes,
+                                                    std::chrono::nanoseconds bin) const;
+    };
+} // namespace mindset
+
+#endif //SPIKEPROPAGATION_H
@@ -0,0 +1,87 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#ifndef AABB_H
+#define AABB_H
+
+#include <rush/rush.h>
+
+#include <mindset/util/NeuronTransform.h>
+
+namespace mindset
+{
+    /**
+     * Axis-aligned bounding box defined by its minimum and maximum corners.
+     * An empty box has its minimum corner above its maximum corner.
+     */
+    struct AABB
+    {
+        rush::Vec3f min;
+        rush::Vec3f max;
+
+        /**
+         * Creates an empty box. Expanding it by any point or box results in that point or box.
+         */
+        static AABB empty();
+
+        /**
+         * Creates a box containing only the given point.
+         */
+        static AABB fromPoint(const rush::Vec3f& point);
+
+        /**
+         * Creates the smallest box containing the given sphere.
+         */
+        static AABB fromSphere(const rush::Vec3f& center, float radius);
+
+        [[nodiscard]] bool isEmpty() const;
+
+        [[nodiscard]] rush::Vec3f getCenter() const;
+
+        [[nodiscard]] rush::Vec3f getSize() const;
+
+        /**
+         * Grows the box to contain the given point.
+         */
+        void expand(const rush::Vec3f& point);
+
+        /**
+         * Grows the box to contain the given box.
+         */
+        void expand(const AABB& other);
+
+        [[nodiscard]] bool contains(const rush::Vec3f& point) const;
+
+        [[nodiscard]] bool intersects(const AABB& other) const;
+
+        [[nodiscard]] bool intersectsSphere(const rush::Vec3f& center, float radius) const;
+
+        /**
+         * Returns the squared distance from the point to the box. Points inside the box are at distance zero.
+         */
+        [[nodiscard]] float squaredDistance(const rush::Vec3f& point) const;
+
+        /**
+         * Returns the box containing this box after being transformed from local to global coordinates.
+         */
+        [[nodiscard]] AABB transformed(const NeuronTransform& transform) const;
+    };
+} // namespace mindset
+
+#endif //AABB_H
@@ -0,0 +1,55 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#ifndef FRUSTUM_H
+#define FRUSTUM_H
+
+#include <array>
+
+#include <rush/rush.h>
+
+#include <mindset/spatial/AABB.h>
+
+namespace mindset
+{
+    /**
+     * A convex volume bounded by six planes, usually the view volume of a camera.
+     * Each plane is stored as (nx, ny, nz, d), with its normal pointing inside the volume:
+     * a point p is inside the plane if dot(n, p) + d >= 0.
+     */
+    struct Frustum
+    {
+        std::array<rush::Vec4f, 6> planes;
+
+        /**
+         * Extracts the frustum planes from a view-projection matrix, using OpenGL clip space conventions.
+         */
+        static Frustum fromMatrix(const rush::Mat4f& viewProjection);
+
+        [[nodiscard]] bool contains(const rush::Vec3f& point) const;
+
+        /**
+         * Returns whether the box may intersect the frustum.
+         * The test is conservative: boxes near the frustum corners may be reported as intersecting.
+         */
+        [[nodiscard]] bool intersects(const AABB& box) const;
+    };
+} // namespace mindset
+
+#endif //FRUSTUM_H
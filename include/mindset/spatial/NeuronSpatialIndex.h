@@ -0,0 +1,179 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#ifndef NEURONSPATIALINDEX_H
+#define NEURONSPATIALINDEX_H
+
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <hey/Hey.h>
+#include <rush/rush.h>
+
+#include <mindset/Dataset.h>
+#include <mindset/spatial/AABB.h>
+
+namespace mindset
+{
+    /**
+     * The world-space location of an indexed neuron.
+     */
+    struct NeuronSpatialEntry
+    {
+        UID uid;
+        /// The soma center in global coordinates.
+        rush::Vec3f soma;
+        /// The bounds of the soma and the neurites in global coordinates.
+        AABB bounds;
+        /// The version of the neuron this entry was computed from.
+        uint64_t version;
+    };
+
+    enum class SpatialTarget
+    {
+        /// Tests the soma center of each neuron.
+        SOMA,
+        /// Tests the bounding box of each neuron's morphology.
+        BOUNDS
+    };
+
+    /**
+     * Bounding volume hierarchy over the neurons of a dataset.
+     *
+     * Each neuron is represented by its soma center and the bounding box of its morphology,
+     * both transformed by the neuron's mindset:transform property.
+     *
+     * The index listens to the dataset's events: added neurons are kept in a pending list
+     * and removed neurons are marked as tombstones until the hierarchy is rebuilt.
+     * The rebuild happens automatically once enough changes accumulate.
+     * Changes to the transform or the morphology of an already indexed neuron are picked up by refresh().
+     *
+     * The index is protected by the dataset's lock: modify it (including through dataset events)
+     * while holding the write lock and query it while holding, at least, the read lock.
+     */
+    class NeuronSpatialIndex
+    {
+        struct BVHNode
+        {
+            AABB bounds;
+            AABB somaBounds;
+            /// For leaves, the first entry. For inner nodes, the index of the right child.
+            /// The left child is always the next node.
+            uint32_t offset;
+            /// The amount of entries of a leaf. Zero for inner nodes.
+            uint32_t count;
+        };
+
+        struct PropertyUIDs
+        {
+            std::optional<UID> position;
+            std::optional<UID> radius;
+            std::optional<UID> transform;
+        };
+
+        const Dataset* _dataset;
+        std::vector<NeuronSpatialEntry> _entries;
+        std::vector<BVHNode> _nodes;
+        std::vector<NeuronSpatialEntry> _pending;
+        std::unordered_set<UID> _removed;
+        std::unordered_map<UID, uint64_t> _versions;
+
+        hey::Listener<Neuron*> _neuronAddedListener;
+        hey::Listener<UID> _neuronRemovedListener;
+        hey::Listener<void*> _clearListener;
+
+        [[nodiscard]] PropertyUIDs getPropertyUIDs() const;
+
+        [[nodiscard]] NeuronSpatialEntry computeEntry(const Neuron& neuron, const PropertyUIDs& properties) const;
+
+        uint32_t build(uint32_t begin, uint32_t end);
+
+        void onNeuronAdded(const Neuron& neuron);
+
+        void onNeuronRemoved(UID uid);
+
+        void clear();
+
+        void rebuildIfRequired();
+
+        template<typename NodeTest, typename LeafTest>
+        void traverse(NodeTest nodeTest, LeafTest leafTest) const;
+
+      public:
+        /**
+         * Creates the index, indexing all neurons currently in the dataset.
+         * The dataset must outlive the index.
+         */
+        explicit NeuronSpatialIndex(Dataset& dataset);
+
+        NeuronSpatialIndex(const NeuronSpatialIndex&) = delete;
+
+        NeuronSpatialIndex& operator=(const NeuronSpatialIndex&) = delete;
+
+        /**
+         * Recomputes every entry and rebuilds the hierarchy.
+         */
+        void rebuild();
+
+        /**
+         * Recomputes the entries of the neurons modified since they were indexed
+         * and indexes any neuron that was missed.
+         * @return The amount of updated entries.
+         */
+        size_t refresh();
+
+        /**
+         * Returns the amount of indexed neurons.
+         */
+        [[nodiscard]] size_t size() const;
+
+        /**
+         * Returns the entry of the given neuron, if indexed.
+         */
+        [[nodiscard]] std::optional<NeuronSpatialEntry> getEntry(UID uid) const;
+
+        /**
+         * Returns the bounds of all indexed neurons.
+         */
+        [[nodiscard]] AABB getBounds() const;
+
+        /**
+         * Returns the neurons whose target lies inside or intersects the given box, sorted by UID.
+         */
+        [[nodiscard]] std::vector<UID> queryBox(const AABB& box, SpatialTarget target = SpatialTarget::SOMA) const;
+
+        /**
+         * Returns the neurons whose target lies inside or intersects the given sphere, sorted by UID.
+         */
+        [[nodiscard]] std::vector<UID> querySphere(const rush::Vec3f& center, float radius,
+                                                   SpatialTarget target = SpatialTarget::SOMA) const;
+
+        /**
+         * Returns the k neurons whose soma is the closest to the given point,
+         * as pairs of UIDs and distances sorted by distance.
+         */
+        [[nodiscard]] std::vector<std::pair<UID, float>> queryNearest(const rush::Vec3f& point, size_t k) const;
+    };
+} // namespace mindset
+
+#endif //NEURONSPATIALINDEX_H
@@ -0,0 +1,177 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#ifndef SYNAPSESPATIALINDEX_H
+#define SYNAPSESPATIALINDEX_H
+
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <hey/Hey.h>
+#include <rush/rush.h>
+
+#include <mindset/Dataset.h>
+#include <mindset/spatial/AABB.h>
+#include <mindset/spatial/Frustum.h>
+
+namespace mindset
+{
+    /**
+     * The synapse property used as its position.
+     */
+    enum class SynapsePositionType
+    {
+        /// mindset:position
+        POSITION,
+        /// mindset:synapse_pre_position
+        PRE,
+        /// mindset:synapse_post_position
+        POST
+    };
+
+    /**
+     * Hashes the integer coordinates of a voxel.
+     */
+    struct VoxelHash
+    {
+        size_t operator()(const rush::Vec3i& voxel) const;
+    };
+
+    /**
+     * Uniform grid indexing the synapses of a dataset's circuit by their position.
+     *
+     * Only the occupied voxels are stored, so the grid is unbounded.
+     * Synapses without the chosen position property are not indexed.
+     * The index follows the circuit's events; changes to the position of an indexed synapse require rebuild().
+     *
+     * The index is protected by the circuit's lock: modify it (including through circuit events)
+     * while holding the write lock and query it while holding, at least, the read lock.
+     */
+    class SynapseSpatialIndex
+    {
+        struct Item
+        {
+            UID uid;
+            rush::Vec3f position;
+        };
+
+        using Voxels = std::unordered_map<rush::Vec3i, std::vector<Item>, VoxelHash>;
+
+        const Dataset* _dataset;
+        float _voxelSize;
+        SynapsePositionType _positionType;
+        Voxels _voxels;
+        std::unordered_map<UID, rush::Vec3i> _locations;
+
+        hey::Listener<Synapse*> _synapseAddedListener;
+        hey::Listener<UID> _synapseRemovedListener;
+        hey::Listener<void*> _clearListener;
+
+        [[nodiscard]] std::optional<UID> getPositionProperty() const;
+
+        void onSynapseAdded(const Synapse& synapse);
+
+        void onSynapseRemoved(UID uid);
+
+        void clear();
+
+        template<typename VoxelTest, typename ItemTest>
+        [[nodiscard]] std::vector<UID> collect(const AABB& region, VoxelTest voxelTest, ItemTest itemTest) const;
+
+      public:
+        /**
+         * Creates the index, indexing all synapses currently in the dataset's circuit.
+         * The dataset must outlive the index.
+         * @param dataset The dataset whose circuit is indexed.
+         * @param voxelSize The edge length of each voxel, in the units of the synapse positions.
+         * @param positionType The synapse property used as its position.
+         * @param threads The maximum amount of threads used to build the index. Zero uses all available cores.
+         * @throws std::invalid_argument If the voxel size is not a positive finite number.
+         */
+        SynapseSpatialIndex(Dataset& dataset, float voxelSize,
+                            SynapsePositionType positionType = SynapsePositionType::POSITION, size_t threads = 0);
+
+        SynapseSpatialIndex(const SynapseSpatialIndex&) = delete;
+
+        SynapseSpatialIndex& operator=(const SynapseSpatialIndex&) = delete;
+
+        /**
+         * Reindexes every synapse in the circuit.
+         * @param threads The maximum amount of threads to use. Zero uses all available cores.
+         */
+        void rebuild(size_t threads = 0);
+
+        /**
+         * Returns the amount of indexed synapses.
+         */
+        [[nodiscard]] size_t size() const;
+
+        [[nodiscard]] float getVoxelSize() const;
+
+        /**
+         * Returns the voxel containing the given position.
+         */
+        [[nodiscard]] rush::Vec3i getVoxel(const rush::Vec3f& position) const;
+
+        /**
+         * Returns the region covered by the given voxel.
+         */
+        [[nodiscard]] AABB getVoxelBounds(const rush::Vec3i& voxel) const;
+
+        /**
+         * Returns the indexed position of the given synapse.
+         */
+        [[nodiscard]] std::optional<rush::Vec3f> getPosition(UID uid) const;
+
+        /**
+         * Returns the synapses inside the given box, sorted by UID.
+         */
+        [[nodiscard]] std::vector<UID> queryBox(const AABB& box) const;
+
+        /**
+         * Returns the synapses inside the given sphere, sorted by UID.
+         */
+        [[nodiscard]] std::vector<UID> querySphere(const rush::Vec3f& center, float radius) const;
+
+        /**
+         * Returns the synapses inside the given frustum, sorted by UID.
+         */
+        [[nodiscard]] std::vector<UID> queryFrustum(const Frustum& frustum) const;
+
+        /**
+         * Returns the amount of synapses inside the given voxel.
+         */
+        [[nodiscard]] size_t getVoxelCount(const rush::Vec3i& voxel) const;
+
+        /**
+         * Returns the occupied voxels and their amount of synapses, sorted by voxel coordinates.
+         */
+        [[nodiscard]] std::vector<std::pair<rush::Vec3i, size_t>> getVoxelCounts() const;
+
+        /**
+         * Returns the occupied voxels intersecting the given box and their amount of synapses,
+         * sorted by voxel coordinates.
+         */
+        [[nodiscard]] std::vector<std::pair<rush::Vec3i, size_t>> getVoxelCounts(const AABB& box) const;
+    };
+} // namespace mindset
+
+#endif //SYNAPSESPATIALINDEX_H
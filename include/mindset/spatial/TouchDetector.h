@@ -0,0 +1,99 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#ifndef TOUCHDETECTOR_H
+#define TOUCHDETECTOR_H
+
+#include <vector>
+
+#include <rush/rush.h>
+
+#include <mindset/Dataset.h>
+
+namespace mindset
+{
+    struct TouchDetectorSettings
+    {
+        /// Maximum gap between the surfaces of an axonal and a dendritic segment to report a touch.
+        float threshold = 1.0f;
+        /// Edge length of the spatial hashing cells. Zero picks a size from the segment lengths.
+        float cellSize = 0.0f;
+        /// Whether touches between the axon and the dendrites of the same neuron are reported.
+        bool allowAutapses = false;
+        /// The maximum amount of threads to use. Zero uses all available cores.
+        size_t threads = 0;
+    };
+
+    /**
+     * An apposition between an axonal segment and a dendritic segment.
+     * Segments are identified by the neurite at their distal end.
+     */
+    struct TouchCandidate
+    {
+        UID preNeuron;
+        UID postNeuron;
+        UID preNeurite;
+        UID postNeurite;
+        /// Closest point of the axonal segment's axis, in global coordinates.
+        rush::Vec3f prePosition;
+        /// Closest point of the dendritic segment's axis, in global coordinates.
+        rush::Vec3f postPosition;
+        /// Gap between the segments' surfaces. Negative if they overlap.
+        float distance;
+    };
+
+    /**
+     * Finds candidate synapses between the axons and dendrites of the neurons of a dataset.
+     *
+     * Every axonal and dendritic segment is transformed to global coordinates and hashed into a uniform grid.
+     * The occupied cells are then processed in parallel, testing each axonal segment
+     * against the dendritic segments sharing its cell.
+     * A pair of segments sharing several cells is only reported by the cell containing
+     * the minimum corner of the intersection of their bounds.
+     */
+    class TouchDetector
+    {
+        TouchDetectorSettings _settings;
+
+      public:
+        explicit TouchDetector(TouchDetectorSettings settings = {});
+
+        [[nodiscard]] const TouchDetectorSettings& getSettings() const;
+
+        /**
+         * Returns the touches between the neurons of the dataset,
+         * sorted by pre-synaptic neuron, post-synaptic neuron, pre-synaptic neurite and post-synaptic neurite.
+         * The caller must hold a read lock on the dataset.
+         */
+        [[nodiscard]] std::vector<TouchCandidate> detect(const Dataset& dataset) const;
+
+        /**
+         * Adds a synapse to the dataset's circuit for each touch.
+         * Synapses carry the touching neurites, both positions and their midpoint as mindset:position.
+         * The caller must hold a write lock on the dataset.
+         * @param dataset The dataset.
+         * @param candidates The touches to convert.
+         * @param firstUID The UID of the first synapse. The following synapses use consecutive UIDs.
+         * @return The amount of added synapses.
+         */
+        static size_t addSynapses(Dataset& dataset, const std::vector<TouchCandidate>& candidates, UID firstUID);
+    };
+} // namespace mindset
+
+#endif //TOUCHDETECTOR_H
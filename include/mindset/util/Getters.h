@@ -21,12 +21,13 @@
 #define GETTERS_H
 
 #include <mindset/Dataset.h>
+#include <mindset/DatasetView.h>
 
 namespace mindset
 {
 
-    template<typename Type>
-    std::unordered_map<UID, Type> getNeuronsProperties(const Dataset& dataset, const std::string& propertyName)
+    template<typename Type, DatasetLike D>
+    std::unordered_map<UID, Type> getNeuronsProperties(const D& dataset, const std::string& propertyName)
     {
         auto optional = dataset.getProperties().getPropertyUID(propertyName);
         if (!optional) {
@@ -38,7 +39,7 @@ namespace mindset
         result.reserve(dataset.getNeuronsAmount());
 
         for (auto neuron : dataset.getNeurons()) {
-            auto value = neuron->getProperty<Type>(property);
+            auto value = neuron->template getProperty<Type>(property);
             if (value) {
                 result[neuron->getUID()] = std::move(*value);
             }
@@ -47,8 +48,8 @@ namespace mindset
         return result;
     }
 
-    template<typename Type>
-    std::vector<std::optional<Type>> getNeuronsProperties(const Dataset& dataset, const std::vector<UID>& neurons,
+    template<typename Type, DatasetLike D>
+    std::vector<std::optional<Type>> getNeuronsProperties(const D& dataset, const std::vector<UID>& neurons,
                                                           const std::string& propertyName)
     {
         auto optional = dataset.getProperties().getPropertyUID(propertyName);
@@ -62,7 +63,7 @@ namespace mindset
 
         for (UID uid : neurons) {
             if (auto neuron = dataset.getNeuron(uid)) {
-                result.push_back(neuron.value()->getProperty<Type>(property));
+                result.push_back(neuron.value()->template getProperty<Type>(property));
             } else {
                 result.push_back(std::nullopt);
             }
@@ -71,8 +72,8 @@ namespace mindset
         return result;
     }
 
-    template<typename Type>
-    std::unordered_map<UID, Type> getNeuritesProperties(const Dataset& dataset, const Morphology& morphology,
+    template<typename Type, DatasetLike D>
+    std::unordered_map<UID, Type> getNeuritesProperties(const D& dataset, const Morphology& morphology,
                                                         const std::string& propertyName)
     {
         auto optional = dataset.getProperties().getPropertyUID(propertyName);
@@ -93,8 +94,8 @@ namespace mindset
         return result;
     }
 
-    template<typename Type>
-    std::vector<std::optional<Type>> getNeuritesProperties(const Dataset& dataset, const Morphology& morphology,
+    template<typename Type, DatasetLike D>
+    std::vector<std::optional<Type>> getNeuritesProperties(const D& dataset, const Morphology& morphology,
                                                            const std::vector<UID>& neurites,
                                                            const std::string& propertyName)
     {
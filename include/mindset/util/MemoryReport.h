@@ -0,0 +1,138 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#ifndef MEMORYREPORT_H
+#define MEMORYREPORT_H
+
+#include <cstddef>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <mindset/UID.h>
+#include <mindset/util/MemoryTracker.h>
+
+namespace mindset
+{
+    class Dataset;
+
+    /**
+     * Estimated memory used by a group of objects.
+     */
+    struct MemoryUsage
+    {
+        /// Bytes holding the data of the objects: the objects themselves, their keys and their values.
+        size_t payload = 0;
+        /// Bytes used by the containers: node links, bucket arrays, unused capacity,
+        /// heap-allocated mutexes and allocator headers.
+        size_t overhead = 0;
+        /// Amount of objects.
+        size_t objects = 0;
+
+        [[nodiscard]] size_t getTotal() const;
+
+        MemoryUsage& operator+=(const MemoryUsage& other);
+    };
+
+    /**
+     * Estimated memory used by the values of a property, across all the elements holding it.
+     */
+    struct PropertyMemoryUsage
+    {
+        UID property = 0;
+        /// The name of the property, if it is defined in the dataset.
+        std::optional<std::string> name;
+        /// The objects of this usage are the amount of values.
+        MemoryUsage usage;
+        /// Amount of values whose type is unknown by the report.
+        /// Only the map entry of these values is counted: their heap memory is not.
+        size_t unknownValues = 0;
+    };
+
+    /**
+     * A breakdown of the memory used by a Dataset.
+     *
+     * The report walks the neurons, the morphologies, the circuit, the hierarchy and the activities.
+     * Morphologies shared by several neurons are counted once.
+     * Sizes are estimations based on the layout of the standard containers used by Mindset
+     * and on an allocator header of two pointers per allocation.
+     * Properties of known types (arithmetic types, strings, rush vectors, NeuronTransform, vectors,
+     * EventSequence and TimeGrid) are measured including their heap memory.
+     *
+     * Each subsystem includes the properties of its elements and its mutexes.
+     * The property and mutex breakdowns are cross-sections of the subsystems and must not be added to them.
+     *
+     * The user must hold a read lock of the dataset while the report is computed.
+     */
+    struct MemoryReport
+    {
+        /// The dataset object, its maps and its property definitions.
+        MemoryUsage dataset;
+        /// Neurons, including their properties. Morphologies are not included.
+        MemoryUsage neurons;
+        /// Unique morphologies, including their soma and their properties. Neurites are not included.
+        MemoryUsage morphologies;
+        /// Neurites of the unique morphologies, including their properties.
+        MemoryUsage neurites;
+        /// Morphology trees cached by the unique morphologies.
+        MemoryUsage morphologyTrees;
+        /// Synapses of the circuit, including their properties.
+        MemoryUsage synapses;
+        /// Pre- and post-synaptic lookup tables of the circuit.
+        MemoryUsage circuitIndices;
+        /// Nodes of the hierarchy.
+        MemoryUsage hierarchy;
+        /// Activities, including their event sequences and time grids.
+        MemoryUsage activities;
+
+        /// Heap-allocated mutexes of the neurons, morphologies, activities and circuit.
+        MemoryUsage mutexes;
+        /// Memory used by each property, sorted by total size.
+        std::vector<PropertyMemoryUsage> properties;
+
+        /// Amount of neurons referencing a morphology.
+        size_t morphologyReferences = 0;
+
+        /// Bytes allocated from the arena of the dataset. Zero if the dataset doesn't own an arena.
+        size_t arenaBytes = 0;
+
+        /// Live allocations of each allocation scope. Empty if allocation tracking is not available.
+        std::vector<AllocationStats> allocations;
+
+        /**
+         * Computes the memory report of the given dataset.
+         */
+        static MemoryReport compute(const Dataset& dataset);
+
+        /**
+         * Returns the sum of all subsystems.
+         */
+        [[nodiscard]] MemoryUsage getTotal() const;
+
+        /**
+         * Writes a human-readable version of this report.
+         * @param out The output stream.
+         * @param maxProperties The maximum amount of properties to list.
+         */
+        void print(std::ostream& out, size_t maxProperties = 20) const;
+    };
+} // namespace mindset
+
+#endif //MEMORYREPORT_H
@@ -0,0 +1,122 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#ifndef MEMORYTRACKER_H
+#define MEMORYTRACKER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace mindset
+{
+    /**
+     * Live and cumulative allocations attributed to an allocation scope.
+     */
+    struct AllocationStats
+    {
+        /// Name of the scope. "untracked" for allocations done outside any scope.
+        std::string scope;
+        /// Bytes allocated inside the scope that haven't been freed yet.
+        size_t liveBytes = 0;
+        /// Amount of allocations done inside the scope that haven't been freed yet.
+        size_t liveAllocations = 0;
+        /// Bytes allocated inside the scope since the start of the program.
+        size_t totalBytes = 0;
+        /// Amount of allocations done inside the scope since the start of the program.
+        size_t totalAllocations = 0;
+    };
+
+    /**
+     * Attributes heap allocations to named scopes, such as loaders.
+     *
+     * Tracking is only available when Mindset is compiled with MINDSET_TRACK_ALLOCATIONS
+     * (CMake option MINDSET_TRACK_ALLOCATIONS). In that case, the global operator new and operator delete
+     * are replaced by versions that store the active scope of the calling thread next to each allocation.
+     * Freeing memory is always attributed to the scope that allocated it, no matter which thread or scope frees it.
+     *
+     * Without the option, scopes can still be created but no statistics are collected.
+     */
+    class MemoryTracker
+    {
+      public:
+        /// The scope of the allocations done outside any AllocationScope.
+        static constexpr uint32_t UNTRACKED_SCOPE = 0;
+        /// The maximum amount of scopes. Further scopes are attributed to UNTRACKED_SCOPE.
+        static constexpr uint32_t MAX_SCOPES = 64;
+
+        MemoryTracker() = delete;
+
+        /**
+         * Returns whether Mindset has been compiled with allocation tracking.
+         */
+        static bool isAvailable();
+
+        /**
+         * Returns the identifier of the scope with the given name, registering it if required.
+         * The name must outlive the program: use string literals.
+         */
+        static uint32_t getScope(const char* name);
+
+        /**
+         * Returns the scope of the calling thread.
+         */
+        static uint32_t getCurrentScope();
+
+        /**
+         * Sets the scope of the calling thread.
+         * @return The previous scope.
+         */
+        static uint32_t setCurrentScope(uint32_t scope);
+
+        /**
+         * Returns the statistics of all the registered scopes that have done at least one allocation.
+         * Empty if allocation tracking is not available.
+         */
+        static std::vector<AllocationStats> getStats();
+    };
+
+    /**
+     * Sets the allocation scope of the calling thread until its destruction.
+     */
+    class AllocationScope
+    {
+        uint32_t _previous;
+
+      public:
+        /**
+         * Enters the scope with the given name. The name must outlive the program: use string literals.
+         */
+        explicit AllocationScope(const char* name);
+
+        /**
+         * Enters the given scope. Used to propagate the scope of a thread to its workers.
+         */
+        explicit AllocationScope(uint32_t scope);
+
+        ~AllocationScope();
+
+        AllocationScope(const AllocationScope&) = delete;
+
+        AllocationScope& operator=(const AllocationScope&) = delete;
+    };
+} // namespace mindset
+
+#endif //MEMORYTRACKER_H
@@ -0,0 +1,132 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#ifndef MORPHOLOGYLOD_H
+#define MORPHOLOGYLOD_H
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <mindset/Dataset.h>
+#include <mindset/Morphology.h>
+
+namespace mindset
+{
+    /**
+     * Parameters of a simplification level.
+     *
+     * The error of a removed point is the largest of its distance to the simplified segment
+     * and the difference between its radius and the radius interpolated along that segment.
+     * A point may be removed if its error is below tolerance + radiusFactor * radius,
+     * so thick neurites, which hide small deviations, are simplified more aggressively.
+     */
+    struct LODSettings
+    {
+        /// Absolute error allowed, in the units of the morphology. Zero disables the Douglas-Peucker pass.
+        float tolerance = 0.5f;
+        /// Error allowed per unit of radius of the removed point.
+        float radiusFactor = 0.0f;
+        /// If positive, sections are resampled at this arc length before the Douglas-Peucker pass.
+        float resampleLength = 0.0f;
+    };
+
+    /**
+     * A simplified copy of a morphology.
+     */
+    struct SimplifiedMorphology
+    {
+        std::shared_ptr<Morphology> morphology;
+        /// Maps each neurite of the source morphology to the neurite of the simplified morphology
+        /// whose segment (from its parent to itself) covers it.
+        std::unordered_map<UID, UID> remap;
+        size_t sourceNeurites = 0;
+        size_t neurites = 0;
+    };
+
+    /**
+     * Simplifies a morphology section by section.
+     *
+     * Sections are the unbranched paths between the soma, branch points and terminals.
+     * Branch points, terminals and the neurites connected to the soma are always preserved and keep their UIDs.
+     * Kept neurites keep all their properties; points created by resampling copy the properties
+     * of the next source neurite along the section and receive new UIDs.
+     * Neurites without position are copied unchanged.
+     */
+    SimplifiedMorphology simplifyMorphology(const Dataset& dataset, const Morphology& morphology,
+                                            const LODSettings& settings);
+
+    /**
+     * Caches the simplification levels of morphologies.
+     *
+     * Levels are computed on demand and shared by all neurons using the same morphology.
+     * They are invalidated when the morphology's version changes.
+     * All methods are thread-safe. The caller must hold a read lock on the dataset.
+     */
+    class MorphologyLODCache
+    {
+        struct Entry
+        {
+            std::weak_ptr<Morphology> morphology;
+            uint64_t version;
+            std::vector<std::shared_ptr<const SimplifiedMorphology>> levels;
+        };
+
+        std::vector<LODSettings> _levels;
+        mutable std::mutex _mutex;
+        std::unordered_map<const Morphology*, Entry> _entries;
+
+      public:
+        /**
+         * Creates a cache with the given levels, usually sorted from the finest to the coarsest.
+         */
+        explicit MorphologyLODCache(std::vector<LODSettings> levels);
+
+        [[nodiscard]] size_t getLevelsAmount() const;
+
+        [[nodiscard]] const LODSettings& getLevelSettings(size_t level) const;
+
+        /**
+         * Returns the given level of the morphology, computing it if required.
+         * Returns nullptr if the morphology is null or the level doesn't exist.
+         */
+        std::shared_ptr<const SimplifiedMorphology> getLevel(const Dataset& dataset,
+                                                             const std::shared_ptr<Morphology>& morphology,
+                                                             size_t level);
+
+        /**
+         * Drops the entries of destroyed or modified morphologies.
+         * @return The amount of dropped entries.
+         */
+        size_t prune();
+
+        /**
+         * Drops all cached levels.
+         */
+        void clear();
+
+        /**
+         * Returns the amount of cached morphologies.
+         */
+        [[nodiscard]] size_t size() const;
+    };
+} // namespace mindset
+
+#endif //MORPHOLOGYLOD_H
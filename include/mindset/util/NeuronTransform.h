@@ -20,26 +20,35 @@
 #ifndef NEURONTRANSFORM_H
 #define NEURONTRANSFORM_H
 
+#include <span>
+#include <vector>
+
 #include <rush/rush.h>
 
 namespace mindset
 {
     /**
      * Manages spatial transformations (position, rotation, scale) of a neuron and computes corresponding matrices.
+     *
+     * Derived data is recomputed eagerly when the transformation changes,
+     * so const methods can be called concurrently.
      */
     class NeuronTransform
     {
-        mutable rush::Quatf _quat;
-        mutable rush::Mat4f _model;
-        mutable rush::Mat4f _normal;
+        rush::Quatf _quat;
+        rush::Mat4f _model;
+        rush::Mat4f _normal;
+
+        // Rotation axes (columns of the rotation matrix), used by the batched kernels.
+        rush::Vec3f _axisX;
+        rush::Vec3f _axisY;
+        rush::Vec3f _axisZ;
 
         rush::Vec3f _position;
         rush::Vec3f _rotation;
         rush::Vec3f _scale;
 
-        mutable bool _dirty;
-
-        void recalculateIfRequired() const;
+        void recalculate();
 
       public:
         /**
@@ -140,6 +149,35 @@ namespace mindset
          * suitable for transforming directions or velocities.
          */
         rush::Vec3f vectorToLocalCoordinates(rush::Vec3f global) const;
+
+        /**
+         * Transforms a batch of positions from local to global coordinate space.
+         *
+         * @param local The positions in local coordinates.
+         * @param global The output positions. Must have the same size as local. It may alias local.
+         */
+        void positionsToGlobalCoordinates(std::span<const rush::Vec3f> local, std::span<rush::Vec3f> global) const;
+
+        /**
+         * Transforms a batch of positions from local to global coordinate space.
+         *
+         * @param local The positions in local coordinates.
+         * @return The positions in global coordinates.
+         */
+        [[nodiscard]] std::vector<rush::Vec3f> positionsToGlobalCoordinates(std::span<const rush::Vec3f> local) const;
+
+        /**
+         * Transforms a batch of positions from global to local coordinate space.
+         *
+         * @param global The positions in global coordinates.
+         * @param local The output positions. Must have the same size as global. It may alias global.
+         */
+        void positionsToLocalCoordinates(std::span<const rush::Vec3f> global, std::span<rush::Vec3f> local) const;
+
+        /**
+         * Returns whether both transformations have the same position, rotation and scale.
+         */
+        bool operator==(const NeuronTransform& other) const;
     };
 } // namespace mindset
 
@@ -0,0 +1,307 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <mindset/util/MemoryTracker.h>
+
+namespace mindset
+{
+    /**
+     * Returns the amount of worker threads used by the parallel algorithms when no amount is specified.
+     */
+    inline size_t defaultThreadCount()
+    {
+        return std::max<size_t>(1, std::thread::hardware_concurrency());
+    }
+
+    /**
+     * Splits the range [0, amount) in chunks of chunkSize elements and processes them in parallel.
+     *
+     * Chunks are claimed dynamically from a shared counter, so expensive chunks don't stall the other workers.
+     * The function receives the index of the worker thread, and the beginning and the end of the chunk:
+     * fn(size_t thread, size_t begin, size_t end).
+     *
+     * Workers inherit the allocation scope of the calling thread.
+     *
+     * If any invocation throws, the remaining chunks are skipped and the first exception is rethrown
+     * in the calling thread once all workers have finished.
+     *
+     * @param amount The amount of elements to process.
+     * @param chunkSize The amount of elements of each chunk.
+     * @param fn The function to invoke for each chunk.
+     * @param threads The maximum amount of threads to use. Zero uses defaultThreadCount().
+     * @return The amount of threads used. Useful to size per-thread buffers beforehand.
+     */
+    template<typename Fn>
+    size_t parallelForChunks(size_t amount, size_t chunkSize, Fn&& fn, size_t threads = 0)
+    {
+        if (amount == 0) {
+            return 0;
+        }
+
+        chunkSize = std::max<size_t>(1, chunkSize);
+        size_t chunks = (amount + chunkSize - 1) / chunkSize;
+        size_t workers = std::min(threads == 0 ? defaultThreadCount() : threads, chunks);
+
+        if (workers == 1) {
+            for (size_t begin = 0; begin < amount; begin += chunkSize) {
+                fn(size_t(0), begin, std::min(amount, begin + chunkSize));
+            }
+            return 1;
+        }
+
+        std::atomic_size_t next = 0;
+        std::atomic_bool failed = false;
+        std::exception_ptr exception;
+        std::mutex exceptionMutex;
+        uint32_t allocationScope = MemoryTracker::getCurrentScope();
+
+        auto work = [&](size_t thread) {
+            AllocationScope scope(allocationScope);
+            while (!failed.load(std::memory_order_relaxed)) {
+                size_t chunk = next.fetch_add(1, std::memory_order_relaxed);
+                if (chunk >= chunks) {
+                    return;
+                }
+                size_t begin = chunk * chunkSize;
+                try {
+                    fn(thread, begin, std::min(amount, begin + chunkSize));
+                } catch (...) {
+                    std::lock_guard lock(exceptionMutex);
+                    if (!exception) {
+                        exception = std::current_exception();
+                    }
+                    failed = true;
+                }
+            }
+        };
+
+        {
+            std::vector<std::jthread> pool;
+            pool.reserve(workers - 1);
+            for (size_t i = 1; i < workers; ++i) {
+                pool.emplace_back(work, i);
+            }
+            work(0);
+        }
+
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+
+        return workers;
+    }
+
+    /**
+     * Processes each index in [0, amount) in parallel, invoking fn(size_t index).
+     * See parallelForChunks() for the scheduling and error handling details.
+     * @param amount The amount of elements to process.
+     * @param fn The function to invoke for each index.
+     * @param threads The maximum amount of threads to use. Zero uses defaultThreadCount().
+     */
+    template<typename Fn>
+    void parallelFor(size_t amount, Fn&& fn, size_t threads = 0)
+    {
+        parallelForChunks(
+            amount, 1,
+            [&fn](size_t, size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    fn(i);
+                }
+            },
+            threads);
+    }
+
+    /**
+     * A set of worker threads that stays alive across several parallel loops.
+     *
+     * parallelForChunks() spawns its workers on every call, which dominates loops that only take a few
+     * microseconds, such as the timesteps of a simulation. A pool creates its threads once and wakes them
+     * for each loop. Loops with a single chunk run inline in the calling thread without waking anyone.
+     *
+     * Scheduling, allocation scopes and error handling are the same as parallelForChunks().
+     * The calling thread works as the worker 0. Loops must not be started concurrently
+     * nor from inside a running loop.
+     */
+    class ThreadPool
+    {
+        using Invoker = void (*)(void* fn, size_t thread, size_t begin, size_t end);
+
+        struct Job
+        {
+            void* fn = nullptr;
+            Invoker invoker = nullptr;
+            size_t amount = 0;
+            size_t chunkSize = 1;
+            size_t chunks = 0;
+            uint32_t allocationScope = 0;
+            std::atomic_size_t next = 0;
+            std::atomic_bool failed = false;
+            std::exception_ptr exception;
+            std::mutex exceptionMutex;
+        };
+
+        size_t _threadsAmount;
+        Job _job;
+        std::atomic_uint64_t _generation;
+        std::atomic_size_t _running;
+        std::atomic_bool _stopping;
+        std::vector<std::jthread> _threads;
+
+        void work(size_t thread)
+        {
+            AllocationScope scope(_job.allocationScope);
+            while (!_job.failed.load(std::memory_order_relaxed)) {
+                size_t chunk = _job.next.fetch_add(1, std::memory_order_relaxed);
+                if (chunk >= _job.chunks) {
+                    return;
+                }
+                size_t begin = chunk * _job.chunkSize;
+                try {
+                    _job.invoker(_job.fn, thread, begin, std::min(_job.amount, begin + _job.chunkSize));
+                } catch (...) {
+                    std::lock_guard lock(_job.exceptionMutex);
+                    if (!_job.exception) {
+                        _job.exception = std::current_exception();
+                    }
+                    _job.failed = true;
+                }
+            }
+        }
+
+        void loop(size_t thread)
+        {
+            uint64_t seen = 0;
+            while (true) {
+                _generation.wait(seen, std::memory_order_acquire);
+                seen = _generation.load(std::memory_order_acquire);
+                if (_stopping.load(std::memory_order_relaxed)) {
+                    return;
+                }
+                work(thread);
+                if (_running.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    _running.notify_one();
+                }
+            }
+        }
+
+      public:
+        /**
+         * Creates the worker threads.
+         * @param threads The amount of threads, including the calling one. Zero uses defaultThreadCount().
+         */
+        explicit ThreadPool(size_t threads = 0) :
+            _threadsAmount(threads == 0 ? defaultThreadCount() : threads),
+            _generation(0),
+            _running(0),
+            _stopping(false)
+        {
+            _threads.reserve(_threadsAmount - 1);
+            for (size_t i = 1; i < _threadsAmount; ++i) {
+                _threads.emplace_back([this, i] { loop(i); });
+            }
+        }
+
+        ~ThreadPool()
+        {
+            _stopping = true;
+            _generation.fetch_add(1, std::memory_order_release);
+            _generation.notify_all();
+        }
+
+        ThreadPool(const ThreadPool&) = delete;
+
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /**
+         * Returns the amount of threads of the pool, including the calling one.
+         * Useful to size per-thread buffers.
+         */
+        [[nodiscard]] size_t getThreadsAmount() const
+        {
+            return _threadsAmount;
+        }
+
+        /**
+         * Splits the range [0, amount) in chunks of chunkSize elements and processes them in the pool.
+         * See parallelForChunks() for the details.
+         */
+        template<typename Fn>
+        void forChunks(size_t amount, size_t chunkSize, Fn&& fn)
+        {
+            if (amount == 0) {
+                return;
+            }
+
+            chunkSize = std::max<size_t>(1, chunkSize);
+            size_t chunks = (amount + chunkSize - 1) / chunkSize;
+            if (_threads.empty() || chunks == 1) {
+                for (size_t begin = 0; begin < amount; begin += chunkSize) {
+                    fn(size_t(0), begin, std::min(amount, begin + chunkSize));
+                }
+                return;
+            }
+
+            using Function = std::remove_reference_t<Fn>;
+            _job.fn = const_cast<void*>(static_cast<const void*>(std::addressof(fn)));
+            _job.invoker = [](void* function, size_t thread, size_t begin, size_t end) {
+                (*static_cast<Function*>(function))(thread, begin, end);
+            };
+            _job.amount = amount;
+            _job.chunkSize = chunkSize;
+            _job.chunks = chunks;
+            _job.allocationScope = MemoryTracker::getCurrentScope();
+            _job.next = 0;
+            _job.failed = false;
+            _job.exception = nullptr;
+
+            _running.store(_threads.size(), std::memory_order_relaxed);
+            _generation.fetch_add(1, std::memory_order_release);
+            _generation.notify_all();
+
+            work(0);
+
+            size_t running = _running.load(std::memory_order_acquire);
+            while (running != 0) {
+                _running.wait(running, std::memory_order_acquire);
+                running = _running.load(std::memory_order_acquire);
+            }
+
+            if (_job.exception) {
+                std::rethrow_exception(std::exchange(_job.exception, nullptr));
+            }
+        }
+    };
+} // namespace mindset
+
+#endif // PARALLEL_H
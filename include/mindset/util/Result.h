@@ -20,22 +20,103 @@
 #ifndef MINDSET_RESULT_H
 #define MINDSET_RESULT_H
 
-#include <cstdint>
-#include <functional>
+#include <concepts>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <variant>
 
 namespace mindset
 {
 
+    template<class Ok, class Error>
+    class Result;
+
+    template<class T>
+    struct IsResult : std::false_type
+    {
+    };
+
+    template<class Ok, class Error>
+    struct IsResult<Result<Ok, Error>> : std::true_type
+    {
+    };
+
     /**
      * Represents the result of an operation, which may contain either a successful value or an error.
+     *
+     * The value is stored inline, so creating, moving or destroying a result never allocates memory
+     * by itself. Results can be copied when both types are copyable and moved when both are movable.
+     *
      * @tparam Ok The type of the result on success.
      * @tparam Error The type representing the error.
      */
     template<class Ok, class Error>
     class Result
     {
-        void* _data;
-        bool _valid;
+        static_assert(!std::is_same_v<Ok, Error>, "Ok and Error must be different types.");
+        static_assert(!std::is_reference_v<Ok> && !std::is_reference_v<Error>, "References are not supported.");
+
+        static constexpr size_t OK_INDEX = 0;
+        static constexpr size_t ERROR_INDEX = 1;
+
+        std::variant<Ok, Error> _value;
+
+        Ok& okValue()
+        {
+            return *std::get_if<OK_INDEX>(&_value);
+        }
+
+        const Ok& okValue() const
+        {
+            return *std::get_if<OK_INDEX>(&_value);
+        }
+
+        Error& errorValue()
+        {
+            return *std::get_if<ERROR_INDEX>(&_value);
+        }
+
+        const Error& errorValue() const
+        {
+            return *std::get_if<ERROR_INDEX>(&_value);
+        }
+
+        /**
+         * Stores the given successful value, assigning it in place when this result already holds one.
+         * Otherwise, the new value is built before replacing the current one:
+         * if building it throws, this result is left untouched.
+         */
+        template<class T>
+        void assignOk(T&& value)
+        {
+            if constexpr (std::is_assignable_v<Ok&, T&&>) {
+                if (_value.index() == OK_INDEX) {
+                    okValue() = std::forward<T>(value);
+                    return;
+                }
+            }
+            Ok temporary(std::forward<T>(value));
+            _value.template emplace<OK_INDEX>(std::move(temporary));
+        }
+
+        /**
+         * Stores the given error value, assigning it in place when this result already holds one.
+         * Otherwise, the new value is built before replacing the current one:
+         * if building it throws, this result is left untouched.
+         */
+        template<class T>
+        void assignError(T&& value)
+        {
+            if constexpr (std::is_assignable_v<Error&, T&&>) {
+                if (_value.index() == ERROR_INDEX) {
+                    errorValue() = std::forward<T>(value);
+                    return;
+                }
+            }
+            Error temporary(std::forward<T>(value));
+            _value.template emplace<ERROR_INDEX>(std::move(temporary));
+        }
 
       public:
         /**
@@ -43,10 +124,8 @@ namespace mindset
          * @param ok The successful result value.
          */
         Result(const Ok& ok) :
-            _valid(true)
+            _value(std::in_place_index<OK_INDEX>, ok)
         {
-            _data = new uint8_t[sizeof(Ok)];
-            std::construct_at<Ok, const Ok&>(static_cast<Ok*>(_data), ok);
         }
 
         /**
@@ -54,10 +133,8 @@ namespace mindset
          * @param ok The successful result value.
          */
         Result(Ok&& ok) :
-            _valid(true)
+            _value(std::in_place_index<OK_INDEX>, std::move(ok))
         {
-            _data = new uint8_t[sizeof(Ok)];
-            std::construct_at<Ok, Ok&&>(static_cast<Ok*>(_data), std::forward<Ok>(ok));
         }
 
         /**
@@ -65,10 +142,8 @@ namespace mindset
          * @param error The error value.
          */
         Result(const Error& error) :
-            _valid(false)
+            _value(std::in_place_index<ERROR_INDEX>, error)
         {
-            _data = new uint8_t[sizeof(Error)];
-            std::construct_at<Error, const Error&>(static_cast<Error*>(_data), error);
         }
 
         /**
@@ -76,20 +151,40 @@ namespace mindset
          * @param error The error value.
          */
         Result(Error&& error) :
-            _valid(false)
+            _value(std::in_place_index<ERROR_INDEX>, std::move(error))
         {
-            _data = new uint8_t[sizeof(Error)];
-            std::construct_at<Error, Error&&>(static_cast<Error*>(_data), std::forward<Error>(error));
         }
 
-        ~Result()
+        Result(const Result& other) = default;
+
+        Result(Result&& other) = default;
+
+        Result& operator=(const Result& other)
+            requires(std::is_copy_constructible_v<Ok> && std::is_copy_constructible_v<Error>)
         {
-            if (_valid) {
-                std::destroy_at<Ok>(static_cast<Ok*>(_data));
-            } else {
-                std::destroy_at<Error>(static_cast<Error*>(_data));
+            if (this != &other) {
+                if (other.isOk()) {
+                    assignOk(other.okValue());
+                } else {
+                    assignError(other.errorValue());
+                }
             }
-            delete[] static_cast<uint8_t*>(_data);
+            return *this;
+        }
+
+        Result& operator=(Result&& other) noexcept(
+            std::is_nothrow_move_constructible_v<Ok> && std::is_nothrow_move_constructible_v<Error> &&
+            std::is_nothrow_move_assignable_v<Ok> && std::is_nothrow_move_assignable_v<Error>)
+            requires(std::is_move_constructible_v<Ok> && std::is_move_constructible_v<Error>)
+        {
+            if (this != &other) {
+                if (other.isOk()) {
+                    assignOk(std::move(other.okValue()));
+                } else {
+                    assignError(std::move(other.errorValue()));
+                }
+            }
+            return *this;
         }
 
         /**
@@ -97,43 +192,61 @@ namespace mindset
          */
         [[nodiscard]] bool isOk() const
         {
-            return _valid;
+            return _value.index() == OK_INDEX;
         }
 
         /**
          * Retrieves the result value.
          * @return Reference to the result value.
          */
-        [[nodiscard]] Ok& getResult()
+        [[nodiscard]] Ok& getResult() &
         {
-            return *static_cast<Ok*>(_data);
+            return okValue();
         }
 
         /**
          * Retrieves the result value.
          * @return Reference to the result value.
          */
-        [[nodiscard]] const Ok& getResult() const
+        [[nodiscard]] const Ok& getResult() const&
         {
-            return *static_cast<Ok*>(_data);
+            return okValue();
+        }
+
+        /**
+         * Retrieves the result value of a temporary result, moving it out.
+         * @return The result value.
+         */
+        [[nodiscard]] Ok&& getResult() &&
+        {
+            return std::move(okValue());
         }
 
         /**
          * Retrieves the error value.
          * @return Reference to the error value.
          */
-        [[nodiscard]] Error& getError()
+        [[nodiscard]] Error& getError() &
         {
-            return *static_cast<Error*>(_data);
+            return errorValue();
         }
 
         /**
          * Retrieves the error value.
          * @return Reference to the error value.
          */
-        [[nodiscard]] const Error& getError() const
+        [[nodiscard]] const Error& getError() const&
         {
-            return *static_cast<Error*>(_data);
+            return errorValue();
+        }
+
+        /**
+         * Retrieves the error value of a temporary result, moving it out.
+         * @return The error value.
+         */
+        [[nodiscard]] Error&& getError() &&
+        {
+            return std::move(errorValue());
         }
 
         /**
@@ -142,61 +255,130 @@ namespace mindset
          */
         [[nodiscard]] Ok& orElse(Ok& other)
         {
-            return _valid ? getResult() : other;
+            return isOk() ? okValue() : other;
         }
 
         /**
          * Returns the result if successful, otherwise returns the provided fallback value.
          * @param other Fallback value.
          */
-        [[nodiscard]] const Ok& orElse(Ok& other) const
+        [[nodiscard]] const Ok& orElse(const Ok& other) const
+        {
+            return isOk() ? okValue() : other;
+        }
+
+        /**
+         * Returns the result if successful, otherwise computes it using the provided function.
+         * The provider is only invoked on error.
+         * @param provider Callable providing the fallback value.
+         */
+        template<std::invocable Provider>
+        [[nodiscard]] Ok orElseGet(Provider&& provider) const&
         {
-            return _valid ? getResult() : other;
+            if (isOk()) {
+                return okValue();
+            }
+            return std::forward<Provider>(provider)();
         }
 
         /**
          * Returns the result if successful, otherwise computes it using the provided function.
-         * @param provider Function providing the fallback value.
+         * The value is moved out of this temporary result.
+         * @param provider Callable providing the fallback value.
          */
-        [[nodiscard]] Ok orElseGet(std::function<Ok()> provider) const
+        template<std::invocable Provider>
+        [[nodiscard]] Ok orElseGet(Provider&& provider) &&
         {
-            return _valid ? getResult() : provider();
+            if (isOk()) {
+                return std::move(okValue());
+            }
+            return std::forward<Provider>(provider)();
         }
 
         /**
          * Maps the result to another type if successful.
-         * @tparam OOk Type of the mapped result.
-         * @param mapper Function to transform the result.
+         * @param mapper Callable transforming the result.
          */
-        template<class OOk>
-        [[nodiscard]] Result<OOk, Error> map(std::function<OOk(Ok)> mapper) const
+        template<std::invocable<const Ok&> Mapper>
+        [[nodiscard]] auto map(Mapper&& mapper) const& -> Result<std::invoke_result_t<Mapper, const Ok&>, Error>
         {
             // Don't use a ternary operator.
             // The return value is implicitly transformed
             // into a Result using different constructors.
             // Using a ternary operator disallows that.
-            if (_valid) {
-                return mapper(getResult());
+            if (isOk()) {
+                return std::forward<Mapper>(mapper)(okValue());
             }
-            return getError();
+            return errorValue();
+        }
+
+        /**
+         * Maps the result to another type if successful, moving the values out of this temporary result.
+         * @param mapper Callable transforming the result.
+         */
+        template<std::invocable<Ok&&> Mapper>
+        [[nodiscard]] auto map(Mapper&& mapper) && -> Result<std::invoke_result_t<Mapper, Ok&&>, Error>
+        {
+            if (isOk()) {
+                return std::forward<Mapper>(mapper)(std::move(okValue()));
+            }
+            return std::move(errorValue());
         }
 
         /**
          * Maps the error to another type if an error occurred.
-         * @tparam OError Type of the mapped error.
-         * @param mapper Function to transform the error.
+         * @param mapper Callable transforming the error.
          */
-        template<class OError>
-        [[nodiscard]] Result<OError, Error> mapError(std::function<OError(Error)> mapper) const
+        template<std::invocable<const Error&> Mapper>
+        [[nodiscard]] auto mapError(Mapper&& mapper) const& -> Result<Ok, std::invoke_result_t<Mapper, const Error&>>
         {
-            // Don't use a ternary operator.
-            // The return value is implicitly transformed
-            // into a Result using different constructors.
-            // Using a ternary operator disallows that.
-            if (_valid) {
-                return getResult();
+            if (isOk()) {
+                return okValue();
+            }
+            return std::forward<Mapper>(mapper)(errorValue());
+        }
+
+        /**
+         * Maps the error to another type if an error occurred, moving the values out of this temporary result.
+         * @param mapper Callable transforming the error.
+         */
+        template<std::invocable<Error&&> Mapper>
+        [[nodiscard]] auto mapError(Mapper&& mapper) && -> Result<Ok, std::invoke_result_t<Mapper, Error&&>>
+        {
+            if (isOk()) {
+                return std::move(okValue());
+            }
+            return std::forward<Mapper>(mapper)(std::move(errorValue()));
+        }
+
+        /**
+         * Chains another fallible operation if successful.
+         * The callable must return a Result with the same error type.
+         * @param next Callable receiving the result and returning a new Result.
+         */
+        template<std::invocable<const Ok&> Next>
+            requires IsResult<std::invoke_result_t<Next, const Ok&>>::value
+        [[nodiscard]] auto andThen(Next&& next) const& -> std::invoke_result_t<Next, const Ok&>
+        {
+            if (isOk()) {
+                return std::forward<Next>(next)(okValue());
+            }
+            return errorValue();
+        }
+
+        /**
+         * Chains another fallible operation if successful, moving the values out of this temporary result.
+         * The callable must return a Result with the same error type.
+         * @param next Callable receiving the result and returning a new Result.
+         */
+        template<std::invocable<Ok&&> Next>
+            requires IsResult<std::invoke_result_t<Next, Ok&&>>::value
+        [[nodiscard]] auto andThen(Next&& next) && -> std::invoke_result_t<Next, Ok&&>
+        {
+            if (isOk()) {
+                return std::forward<Next>(next)(std::move(okValue()));
             }
-            return mapper(getError());
+            return std::move(errorValue());
         }
     };
 } // namespace mindset
@@ -0,0 +1,216 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace mindset
+{
+    /**
+     * An event recorded by the Tracer.
+     */
+    struct TraceEvent
+    {
+        enum class Type : uint8_t
+        {
+            /// A timed scope.
+            SCOPE,
+            /// The value of a counter at a given moment.
+            COUNTER
+        };
+
+        Type type;
+        /// Static name of the event. Used when dynamicName is empty.
+        const char* name;
+        std::string dynamicName;
+        /// Nanoseconds since the tracer was created.
+        int64_t start;
+        /// Duration of the scope in nanoseconds. Zero for counters.
+        int64_t duration;
+        /// The value of the counter. Zero for scopes.
+        double value;
+        uint32_t thread;
+
+        [[nodiscard]] std::string_view getName() const;
+    };
+
+    /**
+     * Aggregated timings of all the scopes sharing the same name.
+     */
+    struct TraceSummary
+    {
+        std::string name;
+        size_t count = 0;
+        std::chrono::nanoseconds total{0};
+        std::chrono::nanoseconds max{0};
+    };
+
+    /**
+     * Collects scoped timings and counters from the instrumented hot paths of Mindset.
+     *
+     * Instrumentation is only compiled when MINDSET_TRACING is defined (CMake option MINDSET_TRACING).
+     * Otherwise, the MINDSET_TRACE_* macros expand to nothing and have no overhead.
+     * When compiled, events are only recorded while the tracer is enabled.
+     *
+     * Each thread records its events into its own buffer, so recording doesn't contend with other threads.
+     */
+    class Tracer
+    {
+      public:
+        using Clock = std::chrono::steady_clock;
+
+      private:
+        struct ThreadBuffer
+        {
+            std::mutex mutex;
+            uint32_t thread;
+            std::vector<TraceEvent> events;
+        };
+
+        std::atomic_bool _enabled;
+        Clock::time_point _origin;
+        std::mutex _mutex;
+        std::vector<std::shared_ptr<ThreadBuffer>> _buffers;
+
+        Tracer();
+
+        ThreadBuffer& getThreadBuffer();
+
+      public:
+        Tracer(const Tracer&) = delete;
+
+        Tracer& operator=(const Tracer&) = delete;
+
+        /**
+         * Returns the global tracer.
+         */
+        static Tracer& getInstance();
+
+        [[nodiscard]] bool isEnabled() const
+        {
+            return _enabled.load(std::memory_order_relaxed);
+        }
+
+        void setEnabled(bool enabled);
+
+        /**
+         * Records a scope that started at the given time point and ended now.
+         * The name must outlive the tracer: use string literals.
+         */
+        void recordScope(const char* name, Clock::time_point start);
+
+        /**
+         * Records a scope with a runtime-generated name.
+         */
+        void recordScope(std::string name, Clock::time_point start);
+
+        /**
+         * Records the value of a counter. The name must outlive the tracer: use string literals.
+         */
+        void recordCounter(const char* name, double value);
+
+        /**
+         * Returns a copy of all recorded events, sorted by start time.
+         */
+        [[nodiscard]] std::vector<TraceEvent> getEvents();
+
+        /**
+         * Returns the aggregated timings of the recorded scopes, sorted by total time.
+         */
+        [[nodiscard]] std::vector<TraceSummary> getSummary();
+
+        /**
+         * Discards all recorded events.
+         */
+        void clear();
+
+        /**
+         * Writes the recorded events using the Chrome trace-event JSON format.
+         * The result can be opened with chrome://tracing or https://ui.perfetto.dev.
+         */
+        void writeChromeTrace(std::ostream& out);
+
+        /**
+         * Writes the recorded events into the given file using the Chrome trace-event JSON format.
+         * @return Whether the file could be written.
+         */
+        bool writeChromeTrace(const std::filesystem::path& path);
+    };
+
+    /**
+     * Records the time between its construction and its destruction if the tracer is enabled.
+     */
+    class TraceScope
+    {
+        const char* _name;
+        Tracer::Clock::time_point _start;
+        bool _active;
+
+      public:
+        explicit TraceScope(const char* name) :
+            _name(name),
+            _active(Tracer::getInstance().isEnabled())
+        {
+            if (_active) {
+                _start = Tracer::Clock::now();
+            }
+        }
+
+        ~TraceScope()
+        {
+            if (_active) {
+                Tracer::getInstance().recordScope(_name, _start);
+            }
+        }
+
+        TraceScope(const TraceScope&) = delete;
+
+        TraceScope& operator=(const TraceScope&) = delete;
+    };
+} // namespace mindset
+
+#define MINDSET_TRACE_CONCAT_IMPL(a, b) a##b
+#define MINDSET_TRACE_CONCAT(a, b)      MINDSET_TRACE_CONCAT_IMPL(a, b)
+
+#ifdef MINDSET_TRACING
+    /// Times the rest of the enclosing scope. The name must be a string literal.
+    #define MINDSET_TRACE_SCOPE(name) ::mindset::TraceScope MINDSET_TRACE_CONCAT(mindsetTraceScope, __LINE__)(name)
+    /// Records the value of a counter. The name must be a string literal.
+    #define MINDSET_TRACE_COUNTER(name, value)                                                                         \
+        do {                                                                                                           \
+            if (::mindset::Tracer::getInstance().isEnabled()) {                                                        \
+                ::mindset::Tracer::getInstance().recordCounter(name, static_cast<double>(value));                      \
+            }                                                                                                          \
+        } while (false)
+#else
+    #define MINDSET_TRACE_SCOPE(name)          ((void) 0)
+    #define MINDSET_TRACE_COUNTER(name, value) ((void) 0)
+#endif
+
+#endif //TRACE_H
@@ -0,0 +1,142 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#ifndef WORLDGEOMETRYCACHE_H
+#define WORLDGEOMETRYCACHE_H
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include <rush/rush.h>
+
+#include <mindset/Dataset.h>
+#include <mindset/DefaultProperties.h>
+#include <mindset/Morphology.h>
+#include <mindset/util/NeuronTransform.h>
+
+namespace mindset
+{
+    /**
+     * The neurite points of a morphology packed in arrays, in local coordinates.
+     * Neurites without a position are skipped.
+     */
+    struct MorphologyGeometry
+    {
+        static constexpr uint32_t NO_PARENT = std::numeric_limits<uint32_t>::max();
+        static constexpr uint32_t SOMA_PARENT = std::numeric_limits<uint32_t>::max() - 1;
+
+        std::vector<UID> neurites;
+        std::vector<rush::Vec3f> positions;
+        std::vector<float> radii;
+        std::vector<NeuriteType> types;
+        /// Index of each point's parent point, SOMA_PARENT if the parent is the soma or NO_PARENT if it's missing.
+        std::vector<uint32_t> parents;
+        std::optional<rush::Vec3f> somaCenter;
+        float somaRadius = 0.0f;
+
+        /**
+         * Returns whether the parent of the given point is another point.
+         */
+        [[nodiscard]] bool hasParentPoint(size_t point) const;
+
+        /**
+         * Packs the geometry of the given morphology.
+         */
+        static MorphologyGeometry extract(const Dataset& dataset, const Morphology& morphology);
+    };
+
+    /**
+     * The geometry of a neuron in global coordinates.
+     */
+    struct WorldGeometry
+    {
+        /// The shared local geometry. Use it for the UIDs, radii and parents of each point.
+        std::shared_ptr<const MorphologyGeometry> local;
+        std::vector<rush::Vec3f> positions;
+        std::optional<rush::Vec3f> somaCenter;
+    };
+
+    /**
+     * Caches the packed geometry of morphologies and the global geometry of neurons.
+     *
+     * Local geometries are shared by all neurons using the same morphology and are invalidated
+     * when the morphology's version changes (neurites or soma added or removed).
+     * Global geometries are invalidated when the neuron's morphology, its version or its transform changes.
+     * Changing the properties of a neurite doesn't change the morphology's version: call clear() after doing so.
+     *
+     * All methods are thread-safe. The caller must hold a read lock on the dataset.
+     */
+    class WorldGeometryCache
+    {
+        struct LocalEntry
+        {
+            std::weak_ptr<Morphology> morphology;
+            uint64_t version;
+            std::shared_ptr<const MorphologyGeometry> geometry;
+        };
+
+        struct WorldEntry
+        {
+            std::weak_ptr<Morphology> morphology;
+            uint64_t version;
+            std::optional<NeuronTransform> transform;
+            std::shared_ptr<const WorldGeometry> geometry;
+        };
+
+        mutable std::mutex _mutex;
+        std::unordered_map<const Morphology*, LocalEntry> _local;
+        std::unordered_map<UID, WorldEntry> _world;
+
+      public:
+        WorldGeometryCache() = default;
+
+        /**
+         * Returns the packed local geometry of the morphology.
+         */
+        std::shared_ptr<const MorphologyGeometry> getLocalGeometry(const Dataset& dataset,
+                                                                   const std::shared_ptr<Morphology>& morphology);
+
+        /**
+         * Returns the geometry of the neuron in global coordinates, or nullptr if the neuron has no morphology.
+         */
+        std::shared_ptr<const WorldGeometry> getWorldGeometry(const Dataset& dataset, const Neuron& neuron);
+
+        /**
+         * Drops the cached geometries of the given neuron.
+         */
+        void invalidate(UID neuron);
+
+        /**
+         * Drops all cached geometries.
+         */
+        void clear();
+
+        /**
+         * Returns the amount of cached global geometries.
+         */
+        [[nodiscard]] size_t size() const;
+    };
+} // namespace mindset
+
+#endif //WORLDGEOMETRYCACHE_H
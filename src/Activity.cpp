@@ -26,4 +26,24 @@ namespace mindset
         Identifiable(uid)
     {
     }
+
+    Activity::Activity(UID uid, const allocator_type& allocator) :
+        Identifiable(uid),
+        PropertyHolder(allocator)
+    {
+    }
+
+    Activity::Activity(const Activity& other, const allocator_type& allocator) :
+        Identifiable(other),
+        PropertyHolder(other, allocator),
+        MutexHolder(other)
+    {
+    }
+
+    Activity::Activity(Activity&& other, const allocator_type& allocator) :
+        Identifiable(other),
+        PropertyHolder(std::move(other), allocator),
+        MutexHolder(std::move(other))
+    {
+    }
 } // namespace mindset
\ No newline at end of file
@@ -0,0 +1,117 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <mindset/Arena.h>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace mindset
+{
+    void* Arena::tryAllocate(Block* block, size_t bytes, size_t alignment)
+    {
+        auto base = reinterpret_cast<uintptr_t>(block) + HEADER_SIZE;
+        size_t used = block->used.load(std::memory_order_relaxed);
+        size_t start;
+        do {
+            start = (base + used + alignment - 1) / alignment * alignment - base;
+            if (start + bytes > block->capacity) {
+                return nullptr;
+            }
+        } while (!block->used.compare_exchange_weak(used, start + bytes, std::memory_order_relaxed));
+        return reinterpret_cast<void*>(base + start);
+    }
+
+    void Arena::refill(Block* exhausted, size_t bytes, size_t alignment)
+    {
+        std::lock_guard lock(_mutex);
+        if (_current.load(std::memory_order_relaxed) != exhausted) {
+            return; // Another thread already replaced the block.
+        }
+
+        size_t size = std::max(_nextSize, HEADER_SIZE + bytes + alignment);
+        auto* block = static_cast<Block*>(_upstream->allocate(size, alignof(std::max_align_t)));
+        block->next = _blocks;
+        block->size = size;
+        block->capacity = size - HEADER_SIZE;
+        block->used.store(0, std::memory_order_relaxed);
+        _blocks = block;
+        size_t limit = std::max(MAX_BLOCK_SIZE, _initialSize);
+        _nextSize = std::min(std::max(_nextSize, std::min(size, limit)) * 2, limit);
+
+        _current.store(block, std::memory_order_release);
+    }
+
+    void* Arena::do_allocate(size_t bytes, size_t alignment)
+    {
+        _allocatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+        while (true) {
+            Block* block = _current.load(std::memory_order_acquire);
+            if (block != nullptr) {
+                if (void* pointer = tryAllocate(block, bytes, alignment)) {
+                    return pointer;
+                }
+            }
+            refill(block, bytes, alignment);
+        }
+    }
+
+    void Arena::do_deallocate(void*, size_t, size_t)
+    {
+        // Memory is reclaimed when the arena is released.
+    }
+
+    bool Arena::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+    {
+        return this == &other;
+    }
+
+    Arena::Arena(size_t initialSize, std::pmr::memory_resource* upstream) :
+        _upstream(upstream),
+        _initialSize(std::max(initialSize, HEADER_SIZE * 2)),
+        _blocks(nullptr),
+        _nextSize(_initialSize),
+        _current(nullptr),
+        _allocatedBytes(0)
+    {
+    }
+
+    Arena::~Arena()
+    {
+        release();
+    }
+
+    void Arena::release()
+    {
+        std::lock_guard lock(_mutex);
+        while (_blocks != nullptr) {
+            Block* next = _blocks->next;
+            _upstream->deallocate(_blocks, _blocks->size, alignof(std::max_align_t));
+            _blocks = next;
+        }
+        _nextSize = _initialSize;
+        _current.store(nullptr, std::memory_order_relaxed);
+        _allocatedBytes.store(0, std::memory_order_relaxed);
+    }
+
+    size_t Arena::getAllocatedBytes() const
+    {
+        return _allocatedBytes.load(std::memory_order_relaxed);
+    }
+} // namespace mindset
@@ -23,6 +23,18 @@ namespace mindset
 {
     Circuit::Circuit() = default;
 
+    Circuit::Circuit(const allocator_type& allocator) :
+        _synapses(allocator),
+        _preSynapses(allocator),
+        _postSynapses(allocator)
+    {
+    }
+
+    Circuit::allocator_type Circuit::getAllocator() const
+    {
+        return _synapses.get_allocator();
+    }
+
     std::pair<Synapse*, bool> Circuit::addSynapse(Synapse synapse)
     {
         UID pre = synapse.getPreSynapticNeuron();
@@ -82,9 +94,11 @@ namespace mindset
 
     void Circuit::clear()
     {
-        _synapses.clear();
-        _preSynapses.clear();
-        _postSynapses.clear();
+        // The containers are replaced instead of cleared to release their bucket arrays too.
+        auto allocator = getAllocator();
+        _synapses = decltype(_synapses)(allocator);
+        _preSynapses = decltype(_preSynapses)(allocator);
+        _postSynapses = decltype(_postSynapses)(allocator);
         incrementVersion();
         _clearEvent.invoke(nullptr);
     }
@@ -21,10 +21,45 @@
 
 namespace mindset
 {
-    Dataset::Dataset()
+    Dataset::Dataset() :
+        Dataset(DatasetMemory::HEAP)
     {
     }
 
+    Dataset::Dataset(DatasetMemory memory) :
+        _arena(memory == DatasetMemory::ARENA ? std::make_unique<Arena>() : nullptr),
+        _neurons(_arena == nullptr ? std::pmr::get_default_resource() : _arena.get()),
+        _circuit(_neurons.get_allocator()),
+        _hierarchyGeneration(0),
+        _hierarchyIndexMutex(std::make_unique<std::mutex>()),
+        _hierarchyIndexGeneration(0),
+        _activities(_neurons.get_allocator())
+    {
+    }
+
+    Dataset::Dataset(std::pmr::memory_resource* resource) :
+        _neurons(resource),
+        _circuit(resource),
+        _hierarchyGeneration(0),
+        _hierarchyIndexMutex(std::make_unique<std::mutex>()),
+        _hierarchyIndexGeneration(0),
+        _activities(resource)
+    {
+    }
+
+    Dataset::allocator_type Dataset::getAllocator() const
+    {
+        return _neurons.get_allocator();
+    }
+
+    std::optional<const Arena*> Dataset::getArena() const
+    {
+        if (_arena == nullptr) {
+            return {};
+        }
+        return _arena.get();
+    }
+
     void Dataset::reserveSpaceForNeurons(size_t amount)
     {
         _neurons.reserve(amount);
@@ -45,6 +80,23 @@ namespace mindset
         return {&it->second, result};
     }
 
+    size_t Dataset::addNeurons(std::vector<Neuron> neurons)
+    {
+        _neurons.reserve(_neurons.size() + neurons.size());
+        size_t inserted = 0;
+        for (auto& neuron : neurons) {
+            auto [it, result] = _neurons.insert({neuron.getUID(), std::move(neuron)});
+            if (result) {
+                _neuronAddedEvent.invoke(&it->second);
+                ++inserted;
+            }
+        }
+        if (inserted > 0) {
+            incrementVersion();
+        }
+        return inserted;
+    }
+
     bool Dataset::removeNeuron(UID uid)
     {
         bool result = _neurons.erase(uid) > 0;
@@ -112,10 +164,26 @@ namespace mindset
     Node* Dataset::createHierarchy(UID uid, std::string type)
     {
         _hierarchy.emplace(uid, type);
+        ++_hierarchyGeneration;
         incrementVersion();
         return &_hierarchy.value();
     }
 
+    std::shared_ptr<const HierarchyIndex> Dataset::getHierarchyIndex() const
+    {
+        if (!_hierarchy.has_value()) {
+            return nullptr;
+        }
+
+        std::lock_guard lock(*_hierarchyIndexMutex);
+        if (_hierarchyIndex == nullptr || _hierarchyIndexGeneration != _hierarchyGeneration ||
+            _hierarchyIndex->getVersion() != _hierarchy->getVersion()) {
+            _hierarchyIndex = std::make_shared<const HierarchyIndex>(_hierarchy.value());
+            _hierarchyIndexGeneration = _hierarchyGeneration;
+        }
+        return _hierarchyIndex;
+    }
+
     size_t Dataset::getActivitiesAmount() const
     {
         return _activities.size();
@@ -161,11 +229,17 @@ namespace mindset
 
     void Dataset::clear()
     {
-        _neurons.clear();
+        // The containers are replaced instead of cleared to release their bucket arrays too.
+        auto allocator = getAllocator();
+        _neurons = decltype(_neurons)(allocator);
         _circuit.clear();
         _hierarchy = {};
-        _activities.clear();
+        ++_hierarchyGeneration;
+        _activities = decltype(_activities)(allocator);
         _clearEvent.invoke(nullptr);
+        if (_arena != nullptr) {
+            _arena->release();
+        }
         incrementVersion();
     }
 
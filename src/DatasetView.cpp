@@ -0,0 +1,101 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <mindset/DatasetView.h>
+
+namespace mindset
+{
+    DatasetView::DatasetView(Dataset& dataset, UIDSet neurons) :
+        _dataset(&dataset)
+    {
+        std::vector<UID> present;
+        present.reserve(neurons.size());
+        _neurons.reserve(neurons.size());
+        for (UID uid : neurons) {
+            if (auto neuron = dataset.getNeuron(uid)) {
+                present.push_back(uid);
+                _neurons.push_back(neuron.value());
+            }
+        }
+        _uids = UIDSet::fromSorted(std::move(present));
+    }
+
+    DatasetView::DatasetView(Dataset& dataset) :
+        DatasetView(dataset, UIDSet(std::vector<UID>(dataset.getNeuronsUIDs().begin(), dataset.getNeuronsUIDs().end())))
+    {
+    }
+
+    Dataset& DatasetView::getDataset()
+    {
+        return *_dataset;
+    }
+
+    const Dataset& DatasetView::getDataset() const
+    {
+        return *_dataset;
+    }
+
+    Properties& DatasetView::getProperties()
+    {
+        return _dataset->getProperties();
+    }
+
+    const Properties& DatasetView::getProperties() const
+    {
+        return _dataset->getProperties();
+    }
+
+    const UIDSet& DatasetView::getNeuronsUIDs() const
+    {
+        return _uids;
+    }
+
+    size_t DatasetView::getNeuronsAmount() const
+    {
+        return _neurons.size();
+    }
+
+    bool DatasetView::contains(UID uid) const
+    {
+        return _uids.contains(uid);
+    }
+
+    std::optional<Neuron*> DatasetView::getNeuron(UID uid)
+    {
+        auto it = std::ranges::lower_bound(_uids, uid);
+        if (it == _uids.end() || *it != uid) {
+            return {};
+        }
+        return _neurons[std::distance(_uids.begin(), it)];
+    }
+
+    std::optional<const Neuron*> DatasetView::getNeuron(UID uid) const
+    {
+        auto it = std::ranges::lower_bound(_uids, uid);
+        if (it == _uids.end() || *it != uid) {
+            return {};
+        }
+        return _neurons[std::distance(_uids.begin(), it)];
+    }
+
+    DatasetView DatasetView::subview(const UIDSet& neurons) const
+    {
+        return {*_dataset, _uids.intersect(neurons)};
+    }
+} // namespace mindset
@@ -0,0 +1,208 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <mindset/HierarchyIndex.h>
+
+#include <algorithm>
+
+#include <mindset/Node.h>
+
+namespace mindset
+{
+    HierarchyIndex::HierarchyIndex(const Node& root) :
+        _version(root.getVersion())
+    {
+        struct Frame
+        {
+            const Node* node;
+            size_t index;
+            std::vector<const Node*> children;
+            size_t next;
+        };
+
+        auto sortedChildren = [](const Node* node) {
+            std::vector<const Node*> children;
+            children.reserve(node->getNodesAmount());
+            for (const Node* child : node->getNodes()) {
+                children.push_back(child);
+            }
+            std::ranges::sort(children, {}, [](const Node* n) { return n->getUID(); });
+            return children;
+        };
+
+        auto open = [this](const Node* node, size_t parent, uint32_t depth) {
+            size_t index = _nodes.size();
+            size_t neuronsBegin = _neurons.size();
+
+            auto neurons = node->getNeurons();
+            _neurons.insert(_neurons.end(), neurons.begin(), neurons.end());
+            std::sort(_neurons.begin() + static_cast<ptrdiff_t>(neuronsBegin), _neurons.end());
+
+            for (size_t i = neuronsBegin; i < _neurons.size(); ++i) {
+                // Children are visited later, so deeper nodes overwrite their ancestors.
+                _neuronToNode[_neurons[i]] = index;
+            }
+
+            _nodes.push_back({
+                .uid = node->getUID(),
+                .type = node->getType(),
+                .depth = depth,
+                .parent = parent,
+                .subtreeEnd = index + 1,
+                .neuronsBegin = neuronsBegin,
+                .ownNeuronsEnd = _neurons.size(),
+                .neuronsEnd = _neurons.size(),
+            });
+            return index;
+        };
+
+        // Iterative DFS: hierarchies can be deep and we don't want to overflow the stack.
+        std::vector<Frame> stack;
+        stack.push_back({&root, open(&root, NONE, 0), sortedChildren(&root), 0});
+
+        while (!stack.empty()) {
+            auto& frame = stack.back();
+            if (frame.next < frame.children.size()) {
+                const Node* child = frame.children[frame.next++];
+                size_t parent = frame.index;
+                auto depth = static_cast<uint32_t>(stack.size());
+                size_t index = open(child, parent, depth);
+                stack.push_back({child, index, sortedChildren(child), 0});
+                continue;
+            }
+
+            auto& node = _nodes[frame.index];
+            node.subtreeEnd = _nodes.size();
+            node.neuronsEnd = _neurons.size();
+            stack.pop_back();
+        }
+    }
+
+    uint64_t HierarchyIndex::getVersion() const
+    {
+        return _version;
+    }
+
+    size_t HierarchyIndex::getNodesAmount() const
+    {
+        return _nodes.size();
+    }
+
+    std::span<const HierarchyIndexNode> HierarchyIndex::getNodes() const
+    {
+        return _nodes;
+    }
+
+    const HierarchyIndexNode& HierarchyIndex::getNode(size_t index) const
+    {
+        return _nodes[index];
+    }
+
+    std::span<const HierarchyIndexNode> HierarchyIndex::getSubtree(size_t index) const
+    {
+        auto& node = _nodes[index];
+        return std::span(_nodes).subspan(index, node.subtreeEnd - index);
+    }
+
+    std::span<const UID> HierarchyIndex::getNeurons() const
+    {
+        return _neurons;
+    }
+
+    std::span<const UID> HierarchyIndex::getNeurons(size_t index) const
+    {
+        auto& node = _nodes[index];
+        return std::span(_neurons).subspan(node.neuronsBegin, node.neuronsEnd - node.neuronsBegin);
+    }
+
+    std::span<const UID> HierarchyIndex::getOwnNeurons(size_t index) const
+    {
+        auto& node = _nodes[index];
+        return std::span(_neurons).subspan(node.neuronsBegin, node.ownNeuronsEnd - node.neuronsBegin);
+    }
+
+    std::optional<size_t> HierarchyIndex::getNodeOfNeuron(UID neuron) const
+    {
+        auto it = _neuronToNode.find(neuron);
+        if (it == _neuronToNode.end()) {
+            return {};
+        }
+        return it->second;
+    }
+
+    std::optional<size_t> HierarchyIndex::findNode(const Node* node) const
+    {
+        // Nodes are resolved by their UID path, as node addresses can be reused after the hierarchy changes.
+        std::vector<UID> path;
+        for (const Node* current = node; current != nullptr; current = current->getParent()) {
+            path.push_back(current->getUID());
+        }
+        if (path.empty() || _nodes.empty() || path.back() != _nodes.front().uid) {
+            return {};
+        }
+
+        size_t index = 0;
+        for (auto it = path.rbegin() + 1; it != path.rend(); ++it) {
+            auto child = findChild(index, *it);
+            if (!child.has_value()) {
+                return {};
+            }
+            index = child.value();
+        }
+        return index;
+    }
+
+    std::optional<size_t> HierarchyIndex::findChild(size_t parent, UID uid) const
+    {
+        auto& node = _nodes[parent];
+        // Direct children are found skipping the subtrees of the previous siblings.
+        for (size_t i = parent + 1; i < node.subtreeEnd; i = _nodes[i].subtreeEnd) {
+            if (_nodes[i].uid == uid) {
+                return i;
+            }
+        }
+        return {};
+    }
+
+    std::vector<size_t> HierarchyIndex::getNodesOfType(std::string_view type) const
+    {
+        std::vector<size_t> result;
+        for (size_t i = 0; i < _nodes.size(); ++i) {
+            if (_nodes[i].type == type) {
+                result.push_back(i);
+            }
+        }
+        return result;
+    }
+
+    std::optional<size_t> HierarchyIndex::getAncestorOfType(size_t index, std::string_view type) const
+    {
+        for (size_t i = index; i != NONE; i = _nodes[i].parent) {
+            if (_nodes[i].type == type) {
+                return i;
+            }
+        }
+        return {};
+    }
+
+    bool HierarchyIndex::isInSubtree(size_t index, size_t ancestor) const
+    {
+        return index >= ancestor && index < _nodes[ancestor].subtreeEnd;
+    }
+} // namespace mindset
@@ -23,6 +23,30 @@ namespace mindset
 {
     Morphology::Morphology() = default;
 
+    Morphology::Morphology(const allocator_type& allocator) :
+        PropertyHolder(allocator),
+        _neurites(allocator)
+    {
+    }
+
+    Morphology::Morphology(const Morphology& other, const allocator_type& allocator) :
+        PropertyHolder(other, allocator),
+        MutexHolder(other),
+        _soma(other._soma),
+        _neurites(other._neurites, allocator),
+        _tree(other._tree)
+    {
+    }
+
+    Morphology::Morphology(Morphology&& other, const allocator_type& allocator) :
+        PropertyHolder(std::move(other), allocator),
+        MutexHolder(std::move(other)),
+        _soma(std::move(other._soma)),
+        _neurites(std::move(other._neurites), allocator),
+        _tree(std::move(other._tree))
+    {
+    }
+
     std::optional<Soma*> Morphology::getSoma()
     {
         if (_soma.has_value()) {
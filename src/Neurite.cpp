@@ -25,4 +25,22 @@ namespace mindset
         Identifiable(uid)
     {
     }
+
+    Neurite::Neurite(UID uid, const allocator_type& allocator) :
+        Identifiable(uid),
+        PropertyHolder(allocator)
+    {
+    }
+
+    Neurite::Neurite(const Neurite& other, const allocator_type& allocator) :
+        Identifiable(other),
+        PropertyHolder(other, allocator)
+    {
+    }
+
+    Neurite::Neurite(Neurite&& other, const allocator_type& allocator) :
+        Identifiable(other),
+        PropertyHolder(std::move(other), allocator)
+    {
+    }
 } // namespace mindset
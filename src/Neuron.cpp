@@ -29,6 +29,29 @@ namespace mindset
     {
     }
 
+    Neuron::Neuron(UID uid, std::shared_ptr<Morphology> morphology, const allocator_type& allocator) :
+        Identifiable(uid),
+        PropertyHolder(allocator),
+        _morphology(std::move(morphology))
+    {
+    }
+
+    Neuron::Neuron(const Neuron& other, const allocator_type& allocator) :
+        Identifiable(other),
+        PropertyHolder(other, allocator),
+        MutexHolder(other),
+        _morphology(other._morphology)
+    {
+    }
+
+    Neuron::Neuron(Neuron&& other, const allocator_type& allocator) :
+        Identifiable(other),
+        PropertyHolder(std::move(other), allocator),
+        MutexHolder(std::move(other)),
+        _morphology(std::move(other._morphology))
+    {
+    }
+
     std::optional<Morphology*> Neuron::getMorphology()
     {
         if (_morphology == nullptr) {
@@ -45,6 +68,11 @@ namespace mindset
         return _morphology.get();
     }
 
+    const std::shared_ptr<Morphology>& Neuron::getMorphologyPtr() const
+    {
+        return _morphology;
+    }
+
     void Neuron::setMorphology(std::shared_ptr<Morphology> morphology)
     {
         _morphology = std::move(morphology);
@@ -23,12 +23,24 @@
 
 namespace mindset
 {
+    void Node::markModified()
+    {
+        for (Node* node = this; node != nullptr; node = node->_parent) {
+            node->incrementVersion();
+        }
+    }
+
     Node::Node(Node&& Other) noexcept :
         Identifiable(std::move(Other)),
+        Versioned(std::move(Other)),
         _type(std::move(Other._type)),
+        _parent(Other._parent),
         _children(std::move(Other._children)),
         _neurons(std::move(Other._neurons))
     {
+        for (auto& child : _children | std::views::values) {
+            child->_parent = this;
+        }
     }
 
     Node& Node::operator=(Node&& Other) noexcept
@@ -37,48 +49,83 @@ namespace mindset
             return *this;
         }
         Identifiable::operator=(std::move(Other));
+        Versioned::operator=(std::move(Other));
         _type = std::move(Other._type);
+        _parent = Other._parent;
         _children = std::move(Other._children);
         _neurons = std::move(Other._neurons);
+        for (auto& child : _children | std::views::values) {
+            child->_parent = this;
+        }
         return *this;
     }
 
     Node::Node(UID uid, std::string type) :
         Identifiable(uid),
-        _type(std::move(type))
+        _type(std::move(type)),
+        _parent(nullptr)
     {
     }
 
-    Result<Node*, NodeCreateError> Node::createNode(UID uid, std::string type)
+    Result<Node*, NodeCreateError> Node::createNode(UID uid, std::string_view type)
     {
         auto it = _children.find(uid);
         if (it != _children.end()) {
             return NodeCreateError::ALREADY_EXISTS;
         }
-        auto [result, ok] = _children.insert({uid, std::make_unique<Node>(uid, type)});
+        auto [result, ok] = _children.insert({uid, std::make_unique<Node>(uid, std::string(type))});
         if (!ok) {
             return NodeCreateError::ERROR_WHILE_CREATING;
         }
+        result->second->_parent = this;
+        markModified();
         return result->second.get();
     }
 
-    Result<Node*, NodeCreateError> Node::getOrCreateNode(UID uid, std::string type)
+    Result<Node*, NodeCreateError> Node::getOrCreateNode(UID uid, std::string_view type)
     {
         auto it = _children.find(uid);
         if (it != _children.end()) {
             return it->second.get();
         }
-        auto [result, ok] = _children.insert({uid, std::make_unique<Node>(uid, type)});
+        auto [result, ok] = _children.insert({uid, std::make_unique<Node>(uid, std::string(type))});
         if (!ok) {
             return NodeCreateError::ERROR_WHILE_CREATING;
         }
+        result->second->_parent = this;
+        markModified();
         return result->second.get();
     }
 
+    const std::string& Node::getType() const
+    {
+        return _type;
+    }
+
+    Node* Node::getParent()
+    {
+        return _parent;
+    }
+
+    const Node* Node::getParent() const
+    {
+        return _parent;
+    }
+
+    size_t Node::getNodesAmount() const
+    {
+        return _children.size();
+    }
+
+    size_t Node::getNeuronsAmount() const
+    {
+        return _neurons.size();
+    }
+
     std::optional<const Node*> Node::getNode(UID uid) const
     {
         auto it = _children.find(uid);
-        if (it != _children.end()) {
+        if (it == _children.end()) {
             return {};
         }
         return it->second.get();
@@ -86,13 +133,26 @@ namespace mindset
 
     bool Node::addNeuron(UID neuron)
     {
-        return _neurons.insert(neuron).second;
+        bool result = _neurons.insert(neuron).second;
+        if (result) {
+            markModified();
+        }
+        return result;
+    }
+
+    bool Node::removeNeuron(UID neuron)
+    {
+        bool result = _neurons.erase(neuron) > 0;
+        if (result) {
+            markModified();
+        }
+        return result;
     }
 
     std::optional<Node*> Node::getNode(UID uid)
     {
         auto it = _children.find(uid);
-        if (it != _children.end()) {
+        if (it == _children.end()) {
             return {};
         }
         return it->second.get();
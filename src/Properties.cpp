@@ -19,11 +19,118 @@
 
 #include <mindset/Properties.h>
 
+#include <iostream>
 #include <ranges>
 
 namespace mindset
 {
-    Properties::Properties() = default;
+    void Properties::indexHash(const std::string& name, UID id)
+    {
+        auto hash = hashPropertyName(name);
+        auto [it, inserted] = _propertiesHashes.try_emplace(hash, id, name);
+        if (inserted) {
+            return;
+        }
+
+        // The hash is already used. This is only fine if the old entry is the same property.
+        if (it->second.second != name) {
+            std::cerr << "Property '" << name << "' has the same hash as '" << it->second.second
+                      << "'. It can only be accessed by name." << std::endl;
+            return;
+        }
+        it->second.first = id;
+    }
+
+    void Properties::unindexHash(const std::string& name, UID id)
+    {
+        auto hash = hashPropertyName(name);
+        auto it = _propertiesHashes.find(hash);
+        if (it == _propertiesHashes.end() || it->second.first != id) {
+            return;
+        }
+        _propertiesHashes.erase(it);
+
+        // Hand the hash to another property sharing it, so key lookups keep finding it.
+        for (const auto& [other, otherId] : _properties) {
+            if (otherId != id && hashPropertyName(other) == hash) {
+                _propertiesHashes.try_emplace(hash, otherId, other);
+                return;
+            }
+        }
+    }
+
+    void Properties::KeyCacheEntry::store(std::string_view key, uint64_t currentVersion, std::optional<UID> uid)
+    {
+        uint32_t current = sequence.load(std::memory_order_relaxed);
+        if ((current & 1) || !sequence.compare_exchange_strong(current, current + 1, std::memory_order_acquire)) {
+            return; // Another thread is filling this entry.
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+        name.store(key.data(), std::memory_order_relaxed);
+        size.store(key.size(), std::memory_order_relaxed);
+        version.store(currentVersion, std::memory_order_relaxed);
+        result.store(uid.has_value() ? FOUND | uid.value() : 0, std::memory_order_relaxed);
+        sequence.store(current + 2, std::memory_order_release);
+    }
+
+    void Properties::invalidateKeys()
+    {
+        _version.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::optional<UID> Properties::resolveKey(uint64_t hash, std::string_view name) const
+    {
+        uint64_t version = _version.load(std::memory_order_relaxed);
+        auto uid = getPropertyUIDByHash(hash, name);
+        _keyCache[hash % KEY_CACHE_SIZE].store(name, version, uid);
+        return uid;
+    }
+
+    // Cache entries start with version zero, so they are never valid for a new instance.
+    Properties::Properties() :
+        _version(1)
+    {
+    }
+
+    Properties::Properties(const Properties& other) :
+        _properties(other._properties),
+        _propertiesNames(other._propertiesNames),
+        _propertiesHashes(other._propertiesHashes),
+        _version(1)
+    {
+    }
+
+    Properties::Properties(Properties&& other) noexcept :
+        _properties(std::move(other._properties)),
+        _propertiesNames(std::move(other._propertiesNames)),
+        _propertiesHashes(std::move(other._propertiesHashes)),
+        _version(1)
+    {
+        other.invalidateKeys();
+    }
+
+    Properties& Properties::operator=(const Properties& other)
+    {
+        if (this != &other) {
+            _properties = other._properties;
+            _propertiesNames = other._propertiesNames;
+            _propertiesHashes = other._propertiesHashes;
+            invalidateKeys();
+        }
+        return *this;
+    }
+
+    Properties& Properties::operator=(Properties&& other) noexcept
+    {
+        if (this != &other) {
+            _properties = std::move(other._properties);
+            _propertiesNames = std::move(other._propertiesNames);
+            _propertiesHashes = std::move(other._propertiesHashes);
+            invalidateKeys();
+            other.invalidateKeys();
+        }
+        return *this;
+    }
 
     UID Properties::defineProperty(std::string name)
     {
@@ -38,7 +145,9 @@ namespace mindset
 
         UID id = maxId + 1;
         _properties[name] = id;
+        indexHash(name, id);
         _propertiesNames[id] = std::move(name);
+        invalidateKeys();
 
         return id;
     }
@@ -46,7 +155,9 @@ namespace mindset
     void Properties::defineProperty(std::string name, UID id)
     {
         _properties[name] = id;
+        indexHash(name, id);
         _propertiesNames[id] = std::move(name);
+        invalidateKeys();
     }
 
     bool Properties::isPropertyDefined(const std::string& name) const
@@ -60,7 +171,9 @@ namespace mindset
         if (!optional) {
             return false;
         }
+        unindexHash(name, optional.value());
         _propertiesNames.erase(optional.value());
+        invalidateKeys();
         return _properties.erase(name) > 0;
     }
 
@@ -73,6 +186,28 @@ namespace mindset
         return it->second;
     }
 
+    std::optional<UID> Properties::getPropertyUIDByHash(uint64_t hash) const
+    {
+        auto it = _propertiesHashes.find(hash);
+        if (it == _propertiesHashes.end()) {
+            return {};
+        }
+        return it->second.first;
+    }
+
+    std::optional<UID> Properties::getPropertyUIDByHash(uint64_t hash, std::string_view name) const
+    {
+        auto it = _propertiesHashes.find(hash);
+        if (it == _propertiesHashes.end()) {
+            // Every defined property has its hash indexed, even if another property owns it.
+            return {};
+        }
+        if (it->second.second == name) {
+            return it->second.first;
+        }
+        return getPropertyUID(std::string(name));
+    }
+
     std::optional<std::string> Properties::getPropertyName(UID uid) const
     {        auto it = _propertiesNames.find(uid);
         if (it == _propertiesNames.end()) {
@@ -96,5 +231,7 @@ namespace mindset
     {
         _propertiesNames.clear();
         _properties.clear();
+        _propertiesHashes.clear();
+        invalidateKeys();
     }
 } // namespace mindset
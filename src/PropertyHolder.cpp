@@ -24,7 +24,29 @@ namespace mindset
 {
     PropertyHolder::PropertyHolder() = default;
 
-    const std::unordered_map<UID, std::any>& PropertyHolder::getProperties() const
+    PropertyHolder::PropertyHolder(const allocator_type& allocator) :
+        _properties(allocator)
+    {
+    }
+
+    PropertyHolder::PropertyHolder(const PropertyHolder& other, const allocator_type& allocator) :
+        Versioned(other),
+        _properties(other._properties, allocator)
+    {
+    }
+
+    PropertyHolder::PropertyHolder(PropertyHolder&& other, const allocator_type& allocator) :
+        Versioned(other),
+        _properties(std::move(other._properties), allocator)
+    {
+    }
+
+    PropertyHolder::allocator_type PropertyHolder::getAllocator() const
+    {
+        return _properties.get_allocator();
+    }
+
+    const std::pmr::unordered_map<UID, std::any>& PropertyHolder::getProperties() const
     {
         return _properties;
     }
@@ -28,6 +28,30 @@ namespace mindset
     {
     }
 
+    Synapse::Synapse(UID uid, UID preSynapticNeuron, UID postSynapticNeuron, const allocator_type& allocator) :
+        Identifiable(uid),
+        PropertyHolder(allocator),
+        _preSynapticNeuron(preSynapticNeuron),
+        _postSynapticNeuron(postSynapticNeuron)
+    {
+    }
+
+    Synapse::Synapse(const Synapse& other, const allocator_type& allocator) :
+        Identifiable(other),
+        PropertyHolder(other, allocator),
+        _preSynapticNeuron(other._preSynapticNeuron),
+        _postSynapticNeuron(other._postSynapticNeuron)
+    {
+    }
+
+    Synapse::Synapse(Synapse&& other, const allocator_type& allocator) :
+        Identifiable(other),
+        PropertyHolder(std::move(other), allocator),
+        _preSynapticNeuron(other._preSynapticNeuron),
+        _postSynapticNeuron(other._postSynapticNeuron)
+    {
+    }
+
     UID Synapse::getPreSynapticNeuron() const
     {
         return _preSynapticNeuron;
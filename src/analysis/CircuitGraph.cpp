@@ -0,0 +1,593 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <mindset/analysis/CircuitGraph.h>
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <queue>
+
+#include <mindset/query/Predicate.h>
+#include <mindset/util/Parallel.h>
+#include <mindset/util/Trace.h>
+
+namespace
+{
+    constexpr size_t CHUNK_SIZE = 1024;
+
+    /// A top-down traversal switches to bottom-up once the frontier has more than 1 / ALPHA of the unexplored edges.
+    constexpr uint64_t ALPHA = 14;
+    /// A bottom-up traversal switches back to top-down once the frontier has less than 1 / BETA of the neurons.
+    constexpr uint64_t BETA = 24;
+
+    using Edge = std::pair<uint32_t, float>;
+
+    mindset::TraversalDirection reverse(mindset::TraversalDirection direction)
+    {
+        switch (direction) {
+            case mindset::TraversalDirection::OUTGOING:
+                return mindset::TraversalDirection::INCOMING;
+            case mindset::TraversalDirection::INCOMING:
+                return mindset::TraversalDirection::OUTGOING;
+            default:
+                return direction;
+        }
+    }
+
+    /**
+     * Invokes fn(neighbor) for each neighbor of the given neuron until it returns true.
+     * @return Whether fn returned true.
+     */
+    template<typename Fn>
+    bool visitNeighbors(const mindset::CircuitGraph& graph, uint32_t index, mindset::TraversalDirection direction,
+                        Fn&& fn)
+    {
+        if (direction != mindset::TraversalDirection::INCOMING) {
+            for (uint32_t neighbor : graph.getOutgoing(index)) {
+                if (fn(neighbor)) {
+                    return true;
+                }
+            }
+        }
+        if (direction != mindset::TraversalDirection::OUTGOING) {
+            for (uint32_t neighbor : graph.getIncoming(index)) {
+                if (fn(neighbor)) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    uint64_t getDegree(const mindset::CircuitGraph& graph, uint32_t index, mindset::TraversalDirection direction)
+    {
+        uint64_t degree = 0;
+        if (direction != mindset::TraversalDirection::INCOMING) {
+            degree += graph.getOutgoing(index).size();
+        }
+        if (direction != mindset::TraversalDirection::OUTGOING) {
+            degree += graph.getIncoming(index).size();
+        }
+        return degree;
+    }
+
+    /**
+     * Runs Dijkstra's algorithm from the source, stopping early once the target is settled.
+     */
+    mindset::ShortestPaths dijkstra(const mindset::CircuitGraph& graph, uint32_t source,
+                                    mindset::TraversalDirection direction, uint32_t target)
+    {
+        mindset::ShortestPaths paths;
+        paths.distances.assign(graph.getNeuronsAmount(), std::numeric_limits<double>::infinity());
+        paths.predecessors.assign(graph.getNeuronsAmount(), mindset::ShortestPaths::NO_PREDECESSOR);
+        if (source >= graph.getNeuronsAmount()) {
+            return paths;
+        }
+
+        using Item = std::pair<double, uint32_t>;
+        std::priority_queue<Item, std::vector<Item>, std::greater<>> queue;
+        paths.distances[source] = 0.0;
+        queue.emplace(0.0, source);
+
+        auto relax = [&](double distance, uint32_t from, std::span<const uint32_t> neighbors,
+                         std::span<const float> weights) {
+            for (size_t i = 0; i < neighbors.size(); ++i) {
+                double weight = weights.empty() ? 1.0 : static_cast<double>(weights[i]);
+                if (!(weight >= 0.0)) {
+                    continue;
+                }
+                uint32_t to = neighbors[i];
+                if (distance + weight < paths.distances[to]) {
+                    paths.distances[to] = distance + weight;
+                    paths.predecessors[to] = from;
+                    queue.emplace(distance + weight, to);
+                }
+            }
+        };
+
+        while (!queue.empty()) {
+            auto [distance, index] = queue.top();
+            queue.pop();
+            // Entries are never removed from the queue: skip the stale ones.
+            if (distance > paths.distances[index]) {
+                continue;
+            }
+            if (index == target) {
+                break;
+            }
+            if (direction != mindset::TraversalDirection::INCOMING) {
+                relax(distance, index, graph.getOutgoing(index), graph.getOutgoingWeights(index));
+            }
+            if (direction != mindset::TraversalDirection::OUTGOING) {
+                relax(distance, index, graph.getIncoming(index), graph.getIncomingWeights(index));
+            }
+        }
+
+        return paths;
+    }
+
+    /**
+     * Turns arbitrary component identifiers in [0, n) into consecutive labels ordered by their lowest neuron.
+     */
+    mindset::GraphComponents relabel(const std::vector<uint32_t>& identifiers)
+    {
+        mindset::GraphComponents components;
+        components.labels.resize(identifiers.size());
+        std::vector<uint32_t> labels(identifiers.size(), mindset::CircuitGraph::UNREACHED);
+        for (size_t i = 0; i < identifiers.size(); ++i) {
+            uint32_t& label = labels[identifiers[i]];
+            if (label == mindset::CircuitGraph::UNREACHED) {
+                label = static_cast<uint32_t>(components.sizes.size());
+                components.sizes.push_back(0);
+            }
+            components.labels[i] = label;
+            ++components.sizes[label];
+        }
+        return components;
+    }
+} // namespace
+
+namespace mindset
+{
+    size_t GraphComponents::getComponentsAmount() const
+    {
+        return sizes.size();
+    }
+
+    std::vector<uint32_t> ShortestPaths::getPath(uint32_t target) const
+    {
+        std::vector<uint32_t> path;
+        if (target >= distances.size() || distances[target] == std::numeric_limits<double>::infinity()) {
+            return path;
+        }
+        for (uint32_t index = target; index != NO_PREDECESSOR; index = predecessors[index]) {
+            path.push_back(index);
+        }
+        std::ranges::reverse(path);
+        return path;
+    }
+
+    CircuitGraph::CircuitGraph() :
+        _outOffsets(1, 0),
+        _inOffsets(1, 0),
+        _weighted(false),
+        _threads(0)
+    {
+    }
+
+    CircuitGraph::CircuitGraph(const Dataset& dataset, const CircuitGraphSettings& settings) :
+        _weighted(settings.weightProperty.has_value()),
+        _threads(settings.threads)
+    {
+        MINDSET_TRACE_SCOPE("CircuitGraph::CircuitGraph");
+        _uids.reserve(dataset.getNeuronsAmount());
+        for (UID uid : dataset.getNeuronsUIDs()) {
+            _uids.push_back(uid);
+        }
+        std::ranges::sort(_uids);
+        _indices.reserve(_uids.size());
+        for (size_t i = 0; i < _uids.size(); ++i) {
+            _indices.emplace(_uids[i], static_cast<uint32_t>(i));
+        }
+
+        bool weighted = _weighted;
+        std::optional<UID> weight;
+        if (weighted) {
+            weight = dataset.getProperties().getPropertyUID(settings.weightProperty.value());
+        }
+
+        // Each chunk of rows is read into its own buffer, so the rows can be placed once their sizes are known.
+        size_t neurons = _uids.size();
+        const Circuit& circuit = dataset.getCircuit();
+        std::vector<std::vector<Edge>> chunks((neurons + CHUNK_SIZE - 1) / CHUNK_SIZE);
+        _outOffsets.assign(neurons + 1, 0);
+        parallelForChunks(
+            neurons, CHUNK_SIZE,
+            [&](size_t, size_t begin, size_t end) {
+                auto& edges = chunks[begin / CHUNK_SIZE];
+                for (size_t row = begin; row < end; ++row) {
+                    size_t first = edges.size();
+                    for (const Synapse& synapse : circuit.getPreSynapses(_uids[row])) {
+                        auto it = _indices.find(synapse.getPostSynapticNeuron());
+                        if (it == _indices.end()) {
+                            continue;
+                        }
+                        float value = weighted ? 0.0f : 1.0f;
+                        if (weight.has_value()) {
+                            if (auto property = synapse.getPropertyAsAnyPtr(weight.value())) {
+                                value = static_cast<float>(propertyAsNumber(*property.value()).value_or(0.0));
+                            }
+                        }
+                        edges.emplace_back(it->second, value);
+                    }
+
+                    // Sorting by weight too keeps the lightest synapse of each connection.
+                    auto entries = std::ranges::subrange(edges.begin() + first, edges.end());
+                    std::ranges::sort(entries);
+                    auto duplicates = std::ranges::unique(entries, {}, &Edge::first);
+                    edges.erase(duplicates.begin(), duplicates.end());
+                    _outOffsets[row + 1] = edges.size() - first;
+                }
+            },
+            settings.threads);
+
+        std::partial_sum(_outOffsets.begin(), _outOffsets.end(), _outOffsets.begin());
+        uint64_t edges = _outOffsets.back();
+        _outNeighbors.resize(edges);
+        if (weighted) {
+            _outWeights.resize(edges);
+        }
+
+        parallelFor(
+            chunks.size(),
+            [&](size_t chunk) {
+                uint64_t offset = _outOffsets[chunk * CHUNK_SIZE];
+                for (auto [neighbor, value] : chunks[chunk]) {
+                    _outNeighbors[offset] = neighbor;
+                    if (weighted) {
+                        _outWeights[offset] = value;
+                    }
+                    ++offset;
+                }
+                chunks[chunk] = {};
+            },
+            settings.threads);
+
+        // The incoming rows are a counting sort of the outgoing ones, so they come out sorted too.
+        _inOffsets.assign(neurons + 1, 0);
+        for (uint32_t neighbor : _outNeighbors) {
+            ++_inOffsets[neighbor + 1];
+        }
+        std::partial_sum(_inOffsets.begin(), _inOffsets.end(), _inOffsets.begin());
+        _inNeighbors.resize(edges);
+        if (weighted) {
+            _inWeights.resize(edges);
+        }
+        std::vector<uint64_t> cursors(_inOffsets.begin(), _inOffsets.end() - 1);
+        for (uint32_t row = 0; row < neurons; ++row) {
+            for (uint64_t edge = _outOffsets[row]; edge < _outOffsets[row + 1]; ++edge) {
+                uint64_t position = cursors[_outNeighbors[edge]]++;
+                _inNeighbors[position] = row;
+                if (weighted) {
+                    _inWeights[position] = _outWeights[edge];
+                }
+            }
+        }
+    }
+
+    size_t CircuitGraph::getNeuronsAmount() const
+    {
+        return _uids.size();
+    }
+
+    uint64_t CircuitGraph::getEdgesAmount() const
+    {
+        return _outNeighbors.size();
+    }
+
+    std::span<const UID> CircuitGraph::getUIDs() const
+    {
+        return _uids;
+    }
+
+    std::optional<uint32_t> CircuitGraph::getIndex(UID uid) const
+    {
+        auto it = _indices.find(uid);
+        if (it == _indices.end()) {
+            return {};
+        }
+        return it->second;
+    }
+
+    std::span<const uint32_t> CircuitGraph::getOutgoing(uint32_t index) const
+    {
+        return std::span(_outNeighbors).subspan(_outOffsets[index], _outOffsets[index + 1] - _outOffsets[index]);
+    }
+
+    std::span<const float> CircuitGraph::getOutgoingWeights(uint32_t index) const
+    {
+        if (_outWeights.empty()) {
+            return {};
+        }
+        return std::span(_outWeights).subspan(_outOffsets[index], _outOffsets[index + 1] - _outOffsets[index]);
+    }
+
+    std::span<const uint32_t> CircuitGraph::getIncoming(uint32_t index) const
+    {
+        return std::span(_inNeighbors).subspan(_inOffsets[index], _inOffsets[index + 1] - _inOffsets[index]);
+    }
+
+    std::span<const float> CircuitGraph::getIncomingWeights(uint32_t index) const
+    {
+        if (_inWeights.empty()) {
+            return {};
+        }
+        return std::span(_inWeights).subspan(_inOffsets[index], _inOffsets[index + 1] - _inOffsets[index]);
+    }
+
+    bool CircuitGraph::isWeighted() const
+    {
+        return _weighted;
+    }
+
+    std::vector<uint32_t> CircuitGraph::getHopDistances(std::span<const uint32_t> sources, TraversalDirection direction,
+                                                        uint32_t maxHops) const
+    {
+        MINDSET_TRACE_SCOPE("CircuitGraph::getHopDistances");
+        size_t neurons = _uids.size();
+        std::vector<uint32_t> distances(neurons, UNREACHED);
+        std::vector<uint32_t> frontier;
+        for (uint32_t source : sources) {
+            if (source < neurons && distances[source] == UNREACHED) {
+                distances[source] = 0;
+                frontier.push_back(source);
+            }
+        }
+
+        size_t threads = _threads == 0 ? defaultThreadCount() : _threads;
+        std::vector<std::vector<uint32_t>> next(threads);
+        uint64_t unexplored = direction == TraversalDirection::BOTH ? 2 * getEdgesAmount() : getEdgesAmount();
+        bool bottomUp = false;
+
+        for (uint32_t depth = 0; !frontier.empty() && depth < maxHops; ++depth) {
+            uint64_t frontierEdges = 0;
+            for (uint32_t index : frontier) {
+                frontierEdges += getDegree(*this, index, direction);
+            }
+            if (!bottomUp && frontierEdges > unexplored / ALPHA) {
+                bottomUp = true;
+            } else if (bottomUp && frontier.size() < neurons / BETA) {
+                bottomUp = false;
+            }
+            unexplored -= std::min(unexplored, frontierEdges);
+
+            for (auto& buffer : next) {
+                buffer.clear();
+            }
+
+            if (bottomUp) {
+                // Every unvisited neuron is only written by the worker that owns it.
+                TraversalDirection parents = reverse(direction);
+                parallelForChunks(
+                    neurons, CHUNK_SIZE,
+                    [&](size_t thread, size_t begin, size_t end) {
+                        for (size_t i = begin; i < end; ++i) {
+                            auto index = static_cast<uint32_t>(i);
+                            std::atomic_ref distance(distances[index]);
+                            if (distance.load(std::memory_order_relaxed) != UNREACHED) {
+                                continue;
+                            }
+                            bool found = visitNeighbors(*this, index, parents, [&](uint32_t parent) {
+                                return std::atomic_ref(distances[parent]).load(std::memory_order_relaxed) == depth;
+                            });
+                            if (found) {
+                                distance.store(depth + 1, std::memory_order_relaxed);
+                                next[thread].push_back(index);
+                            }
+                        }
+                    },
+                    _threads);
+            } else {
+                parallelForChunks(
+                    frontier.size(), CHUNK_SIZE,
+                    [&](size_t thread, size_t begin, size_t end) {
+                        for (size_t i = begin; i < end; ++i) {
+                            visitNeighbors(*this, frontier[i], direction, [&](uint32_t neighbor) {
+                                std::atomic_ref distance(distances[neighbor]);
+                                uint32_t expected = UNREACHED;
+                                if (distance.load(std::memory_order_relaxed) == UNREACHED &&
+                                    distance.compare_exchange_strong(expected, depth + 1, std::memory_order_relaxed)) {
+                                    next[thread].push_back(neighbor);
+                                }
+                                return false;
+                            });
+                        }
+                    },
+                    _threads);
+            }
+
+            frontier.clear();
+            for (auto& buffer : next) {
+                frontier.insert(frontier.end(), buffer.begin(), buffer.end());
+            }
+        }
+
+        return distances;
+    }
+
+    std::vector<UID> CircuitGraph::getNeighborhood(std::span<const UID> sources, uint32_t maxHops,
+                                                   TraversalDirection direction) const
+    {
+        std::vector<uint32_t> indices;
+        for (UID uid : sources) {
+            if (auto index = getIndex(uid)) {
+                indices.push_back(index.value());
+            }
+        }
+
+        auto distances = getHopDistances(indices, direction, maxHops);
+        std::vector<UID> result;
+        for (size_t i = 0; i < distances.size(); ++i) {
+            if (distances[i] != 0 && distances[i] != UNREACHED) {
+                result.push_back(_uids[i]);
+            }
+        }
+        return result;
+    }
+
+    ShortestPaths CircuitGraph::getShortestPaths(uint32_t source, TraversalDirection direction) const
+    {
+        MINDSET_TRACE_SCOPE("CircuitGraph::getShortestPaths");
+        return dijkstra(*this, source, direction, UNREACHED);
+    }
+
+    std::optional<std::vector<UID>> CircuitGraph::getShortestPath(UID from, UID to, TraversalDirection direction) const
+    {
+        auto source = getIndex(from);
+        auto target = getIndex(to);
+        if (!source.has_value() || !target.has_value()) {
+            return {};
+        }
+
+        auto path = dijkstra(*this, source.value(), direction, target.value()).getPath(target.value());
+        if (path.empty()) {
+            return {};
+        }
+
+        std::vector<UID> result;
+        result.reserve(path.size());
+        for (uint32_t index : path) {
+            result.push_back(_uids[index]);
+        }
+        return result;
+    }
+
+    GraphComponents CircuitGraph::getWeaklyConnectedComponents() const
+    {
+        MINDSET_TRACE_SCOPE("CircuitGraph::getWeaklyConnectedComponents");
+        std::vector<uint32_t> parents(_uids.size());
+        std::iota(parents.begin(), parents.end(), 0);
+
+        // Roots are always linked to smaller roots, so every parent is lower than its child
+        // and the root of each component is its lowest neuron.
+        auto find = [&](uint32_t index) {
+            while (true) {
+                std::atomic_ref parent(parents[index]);
+                uint32_t current = parent.load(std::memory_order_relaxed);
+                if (current == index) {
+                    return index;
+                }
+                uint32_t grandparent = std::atomic_ref(parents[current]).load(std::memory_order_relaxed);
+                // Path halving: a failed exchange means another worker already moved it up.
+                parent.compare_exchange_weak(current, grandparent, std::memory_order_relaxed);
+                index = grandparent;
+            }
+        };
+
+        parallelForChunks(
+            _uids.size(), CHUNK_SIZE,
+            [&](size_t, size_t begin, size_t end) {
+                for (size_t index = begin; index < end; ++index) {
+                    for (uint32_t neighbor : getOutgoing(static_cast<uint32_t>(index))) {
+                        uint32_t a = static_cast<uint32_t>(index);
+                        uint32_t b = neighbor;
+                        while (true) {
+                            a = find(a);
+                            b = find(b);
+                            if (a == b) {
+                                break;
+                            }
+                            if (a < b) {
+                                std::swap(a, b);
+                            }
+                            uint32_t expected = a;
+                            if (std::atomic_ref(parents[a]).compare_exchange_strong(expected, b,
+                                                                                    std::memory_order_relaxed)) {
+                                break;
+                            }
+                        }
+                    }
+                }
+            },
+            _threads);
+
+        for (uint32_t index = 0; index < parents.size(); ++index) {
+            parents[index] = find(index);
+        }
+        return relabel(parents);
+    }
+
+    GraphComponents CircuitGraph::getStronglyConnectedComponents() const
+    {
+        MINDSET_TRACE_SCOPE("CircuitGraph::getStronglyConnectedComponents");
+        size_t neurons = _uids.size();
+        std::vector<uint32_t> order(neurons, UNREACHED);
+        std::vector<uint32_t> low(neurons, 0);
+        std::vector<uint32_t> components(neurons, UNREACHED);
+        std::vector<uint32_t> stack;
+        std::vector<std::pair<uint32_t, uint64_t>> calls;
+        uint32_t visited = 0;
+        uint32_t found = 0;
+
+        for (uint32_t root = 0; root < neurons; ++root) {
+            if (order[root] != UNREACHED) {
+                continue;
+            }
+
+            order[root] = low[root] = visited++;
+            stack.push_back(root);
+            calls.emplace_back(root, _outOffsets[root]);
+
+            while (!calls.empty()) {
+                auto [index, edge] = calls.back();
+                if (edge < _outOffsets[index + 1]) {
+                    ++calls.back().second;
+                    uint32_t neighbor = _outNeighbors[edge];
+                    if (order[neighbor] == UNREACHED) {
+                        order[neighbor] = low[neighbor] = visited++;
+                        stack.push_back(neighbor);
+                        calls.emplace_back(neighbor, _outOffsets[neighbor]);
+                    } else if (components[neighbor] == UNREACHED) {
+                        // Still on the stack: part of the component being built.
+                        low[index] = std::min(low[index], order[neighbor]);
+                    }
+                    continue;
+                }
+
+                calls.pop_back();
+                if (low[index] == order[index]) {
+                    uint32_t member;
+                    do {
+                        member = stack.back();
+                        stack.pop_back();
+                        components[member] = found;
+                    } while (member != index);
+                    ++found;
+                }
+                if (!calls.empty()) {
+                    uint32_t caller = calls.back().first;
+                    low[caller] = std::min(low[caller], low[index]);
+                }
+            }
+        }
+
+        return relabel(components);
+    }
+} // namespace mindset
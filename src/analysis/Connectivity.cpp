@@ -0,0 +1,295 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <mindset/analysis/Connectivity.h>
+
+#include <algorithm>
+#include <map>
+#include <ranges>
+
+#include <mindset/query/Predicate.h>
+#include <mindset/util/Parallel.h>
+#include <mindset/util/Trace.h>
+
+namespace
+{
+    constexpr size_t CHUNK_SIZE = 256;
+
+    struct Accumulator
+    {
+        std::vector<uint64_t> synapses;
+        std::vector<uint64_t> connections;
+        std::vector<std::vector<double>> sums;
+        std::vector<std::vector<uint64_t>> counts;
+        std::vector<std::pair<mindset::UID, uint32_t>> targets;
+
+        Accumulator(size_t cells, size_t properties) :
+            synapses(cells, 0),
+            connections(cells, 0),
+            sums(properties, std::vector<double>(cells, 0.0)),
+            counts(properties, std::vector<uint64_t>(cells, 0))
+        {
+        }
+    };
+} // namespace
+
+namespace mindset
+{
+    NeuronGrouping NeuronGrouping::byProperty(const Dataset& dataset, const std::string& property)
+    {
+        NeuronGrouping grouping;
+        auto uid = dataset.getProperties().getPropertyUID(property);
+        if (!uid.has_value()) {
+            return grouping;
+        }
+
+        std::map<int64_t, std::vector<UID>> integers;
+        std::map<std::string, std::vector<UID>> strings;
+        for (auto neuron : dataset.getNonContextualizedNeurons()) {
+            auto value = neuron->getPropertyAsAnyPtr(uid.value());
+            if (!value.has_value()) {
+                continue;
+            }
+            if (auto integer = propertyAsInteger(*value.value())) {
+                integers[integer.value()].push_back(neuron->getUID());
+            } else if (auto* string = std::any_cast<std::string>(value.value())) {
+                strings[*string].push_back(neuron->getUID());
+            }
+        }
+
+        grouping._groups.reserve(dataset.getNeuronsAmount());
+        for (auto& [value, neurons] : integers) {
+            uint32_t group = grouping.addGroup(std::to_string(value));
+            for (UID neuron : neurons) {
+                grouping.assign(neuron, group);
+            }
+        }
+        for (auto& [value, neurons] : strings) {
+            uint32_t group = grouping.addGroup(value);
+            for (UID neuron : neurons) {
+                grouping.assign(neuron, group);
+            }
+        }
+        return grouping;
+    }
+
+    NeuronGrouping NeuronGrouping::byHierarchy(const Dataset& dataset, const std::string& nodeType)
+    {
+        NeuronGrouping grouping;
+        auto index = dataset.getHierarchyIndex();
+        if (index == nullptr) {
+            return grouping;
+        }
+
+        auto nodes = index->getNodes();
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            if (nodes[i].type != nodeType) {
+                continue;
+            }
+            uint32_t group = grouping.addGroup(std::to_string(nodes[i].uid));
+            for (UID neuron : index->getNeurons(i)) {
+                grouping._groups.try_emplace(neuron, group);
+            }
+        }
+        return grouping;
+    }
+
+    uint32_t NeuronGrouping::addGroup(std::string label)
+    {
+        _labels.push_back(std::move(label));
+        return static_cast<uint32_t>(_labels.size() - 1);
+    }
+
+    void NeuronGrouping::assign(UID neuron, uint32_t group)
+    {
+        _groups[neuron] = group;
+    }
+
+    size_t NeuronGrouping::getGroupsAmount() const
+    {
+        return _labels.size();
+    }
+
+    const std::vector<std::string>& NeuronGrouping::getLabels() const
+    {
+        return _labels;
+    }
+
+    std::optional<uint32_t> NeuronGrouping::getGroup(UID neuron) const
+    {
+        auto it = _groups.find(neuron);
+        if (it == _groups.end()) {
+            return {};
+        }
+        return it->second;
+    }
+
+    const std::unordered_map<UID, uint32_t>& NeuronGrouping::getAssignments() const
+    {
+        return _groups;
+    }
+
+    std::vector<size_t> NeuronGrouping::getGroupSizes() const
+    {
+        std::vector<size_t> sizes(_labels.size(), 0);
+        for (uint32_t group : _groups | std::views::values) {
+            ++sizes[group];
+        }
+        return sizes;
+    }
+
+    double PropertyConnectivity::getMean(size_t pre, size_t post) const
+    {
+        size_t cell = pre * groups + post;
+        return counts[cell] == 0 ? 0.0 : sums[cell] / static_cast<double>(counts[cell]);
+    }
+
+    size_t GroupConnectivity::getGroupsAmount() const
+    {
+        return labels.size();
+    }
+
+    uint64_t GroupConnectivity::getSynapses(size_t pre, size_t post) const
+    {
+        return synapses[pre * labels.size() + post];
+    }
+
+    uint64_t GroupConnectivity::getConnections(size_t pre, size_t post) const
+    {
+        return connections[pre * labels.size() + post];
+    }
+
+    double GroupConnectivity::getProbability(size_t pre, size_t post) const
+    {
+        uint64_t pairs = static_cast<uint64_t>(groupSizes[pre]) * groupSizes[post];
+        if (pre == post) {
+            pairs -= groupSizes[pre];
+        }
+        return pairs == 0 ? 0.0 : static_cast<double>(getConnections(pre, post)) / static_cast<double>(pairs);
+    }
+
+    std::optional<const PropertyConnectivity*> GroupConnectivity::getProperty(const std::string& name) const
+    {
+        auto it = std::ranges::find(properties, name, &PropertyConnectivity::name);
+        if (it == properties.end()) {
+            return {};
+        }
+        return &*it;
+    }
+
+    GroupConnectivity GroupConnectivity::compute(const Dataset& dataset, const NeuronGrouping& grouping,
+                                                 const ConnectivitySettings& settings)
+    {
+        MINDSET_TRACE_SCOPE("GroupConnectivity::compute");
+        size_t groups = grouping.getGroupsAmount();
+        size_t cells = groups * groups;
+
+        GroupConnectivity result;
+        result.labels = grouping.getLabels();
+        result.groupSizes = grouping.getGroupSizes();
+
+        std::vector<std::optional<UID>> propertyUIDs;
+        for (auto& name : settings.properties) {
+            propertyUIDs.push_back(dataset.getProperties().getPropertyUID(name));
+        }
+
+        // Only grouped neurons can be the pre-synaptic side of a counted synapse.
+        std::vector<std::pair<UID, uint32_t>> sources(grouping.getAssignments().begin(),
+                                                      grouping.getAssignments().end());
+
+        // One accumulator per worker: parallelForChunks never uses more workers than chunks.
+        size_t chunks = (sources.size() + CHUNK_SIZE - 1) / CHUNK_SIZE;
+        size_t threads = settings.threads == 0 ? defaultThreadCount() : settings.threads;
+        size_t workers = std::max<size_t>(1, std::min(threads, chunks));
+        std::vector<Accumulator> accumulators(workers, Accumulator(cells, propertyUIDs.size()));
+
+        const Circuit& circuit = dataset.getCircuit();
+        parallelForChunks(
+            sources.size(), CHUNK_SIZE,
+            [&](size_t thread, size_t begin, size_t end) {
+                auto& accumulator = accumulators[thread];
+                for (size_t i = begin; i < end; ++i) {
+                    auto [neuron, preGroup] = sources[i];
+                    size_t row = preGroup * groups;
+
+                    accumulator.targets.clear();
+                    for (const Synapse& synapse : circuit.getPreSynapses(neuron)) {
+                        UID post = synapse.getPostSynapticNeuron();
+                        auto postGroup = grouping.getGroup(post);
+                        if (!postGroup.has_value()) {
+                            continue;
+                        }
+                        size_t cell = row + postGroup.value();
+                        ++accumulator.synapses[cell];
+
+                        for (size_t p = 0; p < propertyUIDs.size(); ++p) {
+                            if (!propertyUIDs[p].has_value()) {
+                                continue;
+                            }
+                            auto value = synapse.getPropertyAsAnyPtr(propertyUIDs[p].value());
+                            if (!value.has_value()) {
+                                continue;
+                            }
+                            if (auto number = propertyAsNumber(*value.value())) {
+                                accumulator.sums[p][cell] += number.value();
+                                ++accumulator.counts[p][cell];
+                            }
+                        }
+
+                        if (post != neuron) {
+                            accumulator.targets.emplace_back(post, postGroup.value());
+                        }
+                    }
+
+                    // Several synapses between the same pair of neurons are a single connection.
+                    std::ranges::sort(accumulator.targets);
+                    auto duplicates = std::ranges::unique(accumulator.targets, {}, [](const auto& target) {
+                        return target.first;
+                    });
+                    accumulator.targets.erase(duplicates.begin(), duplicates.end());
+                    for (auto [post, postGroup] : accumulator.targets) {
+                        ++accumulator.connections[row + postGroup];
+                    }
+                }
+            },
+            settings.threads);
+
+        result.synapses.assign(cells, 0);
+        result.connections.assign(cells, 0);
+        for (size_t p = 0; p < propertyUIDs.size(); ++p) {
+            result.properties.push_back({settings.properties[p], groups, std::vector<double>(cells, 0.0),
+                                         std::vector<uint64_t>(cells, 0)});
+        }
+
+        for (auto& accumulator : accumulators) {
+            for (size_t cell = 0; cell < cells; ++cell) {
+                result.synapses[cell] += accumulator.synapses[cell];
+                result.connections[cell] += accumulator.connections[cell];
+            }
+            for (size_t p = 0; p < propertyUIDs.size(); ++p) {
+                for (size_t cell = 0; cell < cells; ++cell) {
+                    result.properties[p].sums[cell] += accumulator.sums[p][cell];
+                    result.properties[p].counts[cell] += accumulator.counts[p][cell];
+                }
+            }
+        }
+
+        return result;
+    }
+} // namespace mindset
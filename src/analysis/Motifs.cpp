@@ -0,0 +1,354 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <mindset/analysis/Motifs.h>
+
+#include <algorithm>
+#include <bit>
+#include <numeric>
+#include <span>
+
+#include <mindset/util/Parallel.h>
+#include <mindset/util/Trace.h>
+
+namespace
+{
+    constexpr size_t CHUNK_SIZE = 256;
+    constexpr uint32_t UNGROUPED = std::numeric_limits<uint32_t>::max();
+
+    constexpr uint8_t OUTGOING = 1;
+    constexpr uint8_t INCOMING = 2;
+    constexpr uint8_t MUTUAL = OUTGOING | INCOMING;
+
+    constexpr size_t CLASS_012 = 1;
+    constexpr size_t CLASS_102 = 2;
+
+    /**
+     * The class of each triad, as an index of TriadCensus::NAMES.
+     * The code of a triad (v, u, w) has a bit for each edge: v->u = 1, u->v = 2, v->w = 4, w->v = 8,
+     * u->w = 16 and w->u = 32.
+     */
+    constexpr std::array<uint8_t, 64> TRIAD_CLASSES = {
+        0, 1, 1, 2, 1, 3, 5, 7, 1, 5, 4, 6, 2, 7, 6, 10,
+        1, 5, 3, 7, 4, 8, 8, 12, 5, 9, 8, 13, 6, 13, 11, 14,
+        1, 4, 5, 6, 5, 8, 9, 13, 3, 8, 8, 11, 7, 12, 13, 14,
+        2, 6, 7, 10, 6, 11, 13, 14, 7, 13, 12, 14, 10, 14, 14, 15,
+    };
+
+    /**
+     * The undirected adjacency of the graph, restricted to the edges inside each group and without autapses.
+     * Each neighbor records the directions of its edges with the neuron owning the list.
+     */
+    struct Adjacency
+    {
+        std::vector<uint64_t> offsets;
+        std::vector<uint32_t> neighbors;
+        std::vector<uint8_t> directions;
+
+        [[nodiscard]] std::span<const uint32_t> getNeighbors(uint32_t index) const
+        {
+            return std::span(neighbors).subspan(offsets[index], offsets[index + 1] - offsets[index]);
+        }
+
+        [[nodiscard]] std::span<const uint8_t> getDirections(uint32_t index) const
+        {
+            return std::span(directions).subspan(offsets[index], offsets[index + 1] - offsets[index]);
+        }
+    };
+
+    struct Accumulator
+    {
+        std::vector<uint64_t> connections;
+        std::vector<uint64_t> reciprocalPairs;
+        std::vector<std::array<uint64_t, 16>> census;
+
+        explicit Accumulator(size_t groups) :
+            connections(groups, 0),
+            reciprocalPairs(groups, 0),
+            census(groups, std::array<uint64_t, 16>{})
+        {
+        }
+    };
+
+    Adjacency buildAdjacency(const mindset::CircuitGraph& graph, const std::vector<uint32_t>& groups, size_t threads)
+    {
+        size_t neurons = graph.getNeuronsAmount();
+        Adjacency adjacency;
+        adjacency.offsets.assign(neurons + 1, 0);
+
+        std::vector<std::vector<std::pair<uint32_t, uint8_t>>> chunks((neurons + CHUNK_SIZE - 1) / CHUNK_SIZE);
+        mindset::parallelForChunks(
+            neurons, CHUNK_SIZE,
+            [&](size_t, size_t begin, size_t end) {
+                auto& entries = chunks[begin / CHUNK_SIZE];
+                for (size_t i = begin; i < end; ++i) {
+                    auto index = static_cast<uint32_t>(i);
+                    size_t first = entries.size();
+                    if (groups[index] != UNGROUPED) {
+                        auto outgoing = graph.getOutgoing(index);
+                        auto incoming = graph.getIncoming(index);
+                        size_t o = 0;
+                        size_t n = 0;
+                        while (o < outgoing.size() || n < incoming.size()) {
+                            bool out = n == incoming.size() || (o < outgoing.size() && outgoing[o] <= incoming[n]);
+                            uint32_t neighbor = out ? outgoing[o] : incoming[n];
+                            uint8_t direction = 0;
+                            if (o < outgoing.size() && outgoing[o] == neighbor) {
+                                direction |= OUTGOING;
+                                ++o;
+                            }
+                            if (n < incoming.size() && incoming[n] == neighbor) {
+                                direction |= INCOMING;
+                                ++n;
+                            }
+                            if (neighbor != index && groups[neighbor] == groups[index]) {
+                                entries.emplace_back(neighbor, direction);
+                            }
+                        }
+                    }
+                    adjacency.offsets[index + 1] = entries.size() - first;
+                }
+            },
+            threads);
+
+        std::partial_sum(adjacency.offsets.begin(), adjacency.offsets.end(), adjacency.offsets.begin());
+        adjacency.neighbors.resize(adjacency.offsets.back());
+        adjacency.directions.resize(adjacency.offsets.back());
+        mindset::parallelFor(
+            chunks.size(),
+            [&](size_t chunk) {
+                uint64_t offset = adjacency.offsets[chunk * CHUNK_SIZE];
+                for (auto [neighbor, direction] : chunks[chunk]) {
+                    adjacency.neighbors[offset] = neighbor;
+                    adjacency.directions[offset] = direction;
+                    ++offset;
+                }
+                chunks[chunk] = {};
+            },
+            threads);
+
+        return adjacency;
+    }
+
+    /**
+     * Counts the connected triads whose lowest neuron is v and the dyadic triads of the edges from v
+     * to its higher neighbors.
+     */
+    void countTriads(const Adjacency& adjacency, uint32_t v, uint64_t groupSize, std::array<uint64_t, 16>& census)
+    {
+        auto vNeighbors = adjacency.getNeighbors(v);
+        auto vDirections = adjacency.getDirections(v);
+        for (size_t a = 0; a < vNeighbors.size(); ++a) {
+            uint32_t u = vNeighbors[a];
+            if (u < v) {
+                continue;
+            }
+            uint32_t vu = vDirections[a];
+            auto uNeighbors = adjacency.getNeighbors(u);
+            auto uDirections = adjacency.getDirections(u);
+
+            // Merges both neighborhoods: w walks the union of the neighbors of v and u, excluding themselves.
+            uint64_t neighborhood = 0;
+            size_t i = 0;
+            size_t j = 0;
+            while (i < vNeighbors.size() || j < uNeighbors.size()) {
+                bool fromV = j == uNeighbors.size() || (i < vNeighbors.size() && vNeighbors[i] <= uNeighbors[j]);
+                uint32_t w = fromV ? vNeighbors[i] : uNeighbors[j];
+                uint32_t vw = 0;
+                uint32_t uw = 0;
+                bool adjacentToV = false;
+                if (i < vNeighbors.size() && vNeighbors[i] == w) {
+                    vw = vDirections[i++];
+                    adjacentToV = true;
+                }
+                if (j < uNeighbors.size() && uNeighbors[j] == w) {
+                    uw = uDirections[j++];
+                }
+                if (w == u || w == v) {
+                    continue;
+                }
+                ++neighborhood;
+
+                // Each connected triad is counted once: from its lowest neuron v and its first edge to u.
+                if (u < w || (v < w && !adjacentToV)) {
+                    ++census[TRIAD_CLASSES[vu | vw << 2 | uw << 4]];
+                }
+            }
+
+            // The remaining neurons of the group are connected to neither v nor u.
+            census[vu == MUTUAL ? CLASS_102 : CLASS_012] += groupSize - neighborhood - 2;
+        }
+    }
+
+    /**
+     * Computes the directed clustering coefficient of v.
+     */
+    double computeClustering(const Adjacency& adjacency, uint32_t v)
+    {
+        auto vNeighbors = adjacency.getNeighbors(v);
+        auto vDirections = adjacency.getDirections(v);
+
+        // Each pair of edges (v, j) and (j, k) closed by an edge (v, k) is a directed triangle,
+        // so a mutual edge counts twice.
+        uint64_t degree = 0;
+        uint64_t mutual = 0;
+        uint64_t triangles = 0;
+        for (size_t a = 0; a < vNeighbors.size(); ++a) {
+            uint64_t vj = std::popcount(vDirections[a]);
+            degree += vj;
+            mutual += vDirections[a] == MUTUAL;
+
+            auto jNeighbors = adjacency.getNeighbors(vNeighbors[a]);
+            auto jDirections = adjacency.getDirections(vNeighbors[a]);
+            size_t i = 0;
+            size_t j = 0;
+            while (i < vNeighbors.size() && j < jNeighbors.size()) {
+                if (vNeighbors[i] < jNeighbors[j]) {
+                    ++i;
+                } else if (jNeighbors[j] < vNeighbors[i]) {
+                    ++j;
+                } else {
+                    triangles += vj * std::popcount(vDirections[i++]) * std::popcount(jDirections[j++]);
+                }
+            }
+        }
+
+        if (triangles == 0) {
+            return 0.0;
+        }
+        return static_cast<double>(triangles) / (2.0 * static_cast<double>(degree * (degree - 1) - 2 * mutual));
+    }
+
+    std::vector<mindset::MotifStatistics> compute(const mindset::CircuitGraph& graph,
+                                                  const std::vector<uint32_t>& groups, size_t groupsAmount,
+                                                  const mindset::MotifSettings& settings)
+    {
+        size_t neurons = graph.getNeuronsAmount();
+        std::vector<mindset::MotifStatistics> results(groupsAmount);
+        for (uint32_t index = 0; index < neurons; ++index) {
+            if (groups[index] != UNGROUPED) {
+                results[groups[index]].neurons.push_back(index);
+            }
+        }
+
+        Adjacency adjacency = buildAdjacency(graph, groups, settings.threads);
+
+        size_t chunks = (neurons + CHUNK_SIZE - 1) / CHUNK_SIZE;
+        size_t threads = settings.threads == 0 ? mindset::defaultThreadCount() : settings.threads;
+        size_t workers = std::max<size_t>(1, std::min(threads, chunks));
+        std::vector<Accumulator> accumulators(workers, Accumulator(groupsAmount));
+        std::vector<double> clustering(settings.clustering ? neurons : 0, 0.0);
+
+        mindset::parallelForChunks(
+            neurons, CHUNK_SIZE,
+            [&](size_t thread, size_t begin, size_t end) {
+                auto& accumulator = accumulators[thread];
+                for (size_t i = begin; i < end; ++i) {
+                    auto v = static_cast<uint32_t>(i);
+                    uint32_t group = groups[v];
+                    if (group == UNGROUPED) {
+                        continue;
+                    }
+
+                    auto directions = adjacency.getDirections(v);
+                    auto neighbors = adjacency.getNeighbors(v);
+                    for (size_t a = 0; a < neighbors.size(); ++a) {
+                        // Each pair is counted from its lowest neuron.
+                        if (neighbors[a] > v) {
+                            accumulator.connections[group] += std::popcount(directions[a]);
+                            accumulator.reciprocalPairs[group] += directions[a] == MUTUAL;
+                        }
+                    }
+
+                    if (settings.census) {
+                        countTriads(adjacency, v, results[group].neurons.size(), accumulator.census[group]);
+                    }
+                    if (settings.clustering) {
+                        clustering[v] = computeClustering(adjacency, v);
+                    }
+                }
+            },
+            settings.threads);
+
+        for (size_t group = 0; group < groupsAmount; ++group) {
+            auto& result = results[group];
+            for (auto& accumulator : accumulators) {
+                result.connections += accumulator.connections[group];
+                result.reciprocalPairs += accumulator.reciprocalPairs[group];
+                for (size_t c = 0; c < 16; ++c) {
+                    result.census.counts[c] += accumulator.census[group][c];
+                }
+            }
+
+            if (settings.census) {
+                uint64_t size = result.neurons.size();
+                uint64_t triads = size < 3 ? 0 : size * (size - 1) * (size - 2) / 6;
+                uint64_t counted = std::accumulate(result.census.counts.begin(), result.census.counts.end(),
+                                                   uint64_t(0));
+                result.census.counts[0] = triads - counted;
+            }
+
+            if (settings.clustering) {
+                result.clustering.reserve(result.neurons.size());
+                for (uint32_t index : result.neurons) {
+                    result.clustering.push_back(clustering[index]);
+                }
+            }
+        }
+
+        return results;
+    }
+} // namespace
+
+namespace mindset
+{
+    uint64_t TriadCensus::get(std::string_view name) const
+    {
+        auto it = std::ranges::find(NAMES, name);
+        if (it == NAMES.end()) {
+            return 0;
+        }
+        return counts[it - NAMES.begin()];
+    }
+
+    double MotifStatistics::getReciprocity() const
+    {
+        return connections == 0 ? 0.0 : 2.0 * static_cast<double>(reciprocalPairs) / static_cast<double>(connections);
+    }
+
+    MotifStatistics computeMotifs(const CircuitGraph& graph, const MotifSettings& settings)
+    {
+        MINDSET_TRACE_SCOPE("computeMotifs");
+        std::vector<uint32_t> groups(graph.getNeuronsAmount(), 0);
+        return std::move(compute(graph, groups, 1, settings).front());
+    }
+
+    std::vector<MotifStatistics> computeMotifs(const CircuitGraph& graph, const NeuronGrouping& grouping,
+                                               const MotifSettings& settings)
+    {
+        MINDSET_TRACE_SCOPE("computeMotifs");
+        std::vector<uint32_t> groups(graph.getNeuronsAmount(), UNGROUPED);
+        for (auto [uid, group] : grouping.getAssignments()) {
+            if (auto index = graph.getIndex(uid)) {
+                groups[index.value()] = group;
+            }
+        }
+        return compute(graph, groups, grouping.getGroupsAmount(), settings);
+    }
+} // namespace mindset
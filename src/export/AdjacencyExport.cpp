@@ -0,0 +1,352 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <mindset/export/AdjacencyExport.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <charconv>
+#include <fstream>
+#include <limits>
+#include <span>
+#include <unordered_map>
+
+#include <mindset/query/Predicate.h>
+#include <mindset/util/Parallel.h>
+#include <mindset/util/Trace.h>
+
+namespace
+{
+    constexpr size_t CHUNK_SIZE = 1024;
+    constexpr size_t CHUNKS_PER_WORKER = 4;
+    constexpr uint64_t FILE_ALIGNMENT = 64;
+
+    struct Entry
+    {
+        uint32_t column;
+        double weight;
+    };
+
+    /**
+     * The entries of a chunk of rows of a raw file, waiting to be written.
+     */
+    struct RawChunk
+    {
+        std::vector<uint32_t> rows;
+        std::vector<uint32_t> columns;
+        std::vector<double> weights;
+    };
+
+    uint64_t align(uint64_t value)
+    {
+        return (value + FILE_ALIGNMENT - 1) / FILE_ALIGNMENT * FILE_ALIGNMENT;
+    }
+
+    template<typename T>
+    T toLittleEndian(T value)
+    {
+        if constexpr (std::endian::native == std::endian::big) {
+            auto bytes = std::bit_cast<std::array<std::byte, sizeof(T)>>(value);
+            std::ranges::reverse(bytes);
+            return std::bit_cast<T>(bytes);
+        } else {
+            return value;
+        }
+    }
+
+    template<typename T>
+    void writeLittleEndian(std::ostream& out, std::span<const T> values)
+    {
+        if constexpr (std::endian::native == std::endian::little) {
+            out.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size_bytes()));
+        } else {
+            for (T value : values) {
+                T converted = toLittleEndian(value);
+                out.write(reinterpret_cast<const char*>(&converted), sizeof(T));
+            }
+        }
+    }
+
+    /**
+     * Writes the given member of the chunks contiguously, starting at the entry first of the section.
+     */
+    template<typename T>
+    void writeSection(std::ostream& out, uint64_t offset, uint64_t first, const std::vector<RawChunk>& chunks,
+                      std::vector<T> RawChunk::*member)
+    {
+        out.seekp(static_cast<std::streamoff>(offset + first * sizeof(T)));
+        for (const auto& chunk : chunks) {
+            writeLittleEndian<T>(out, chunk.*member);
+        }
+    }
+
+    /**
+     * Reads the entries of the row of the given neuron, sorted by column.
+     */
+    struct RowReader
+    {
+        const mindset::Circuit& circuit;
+        const std::unordered_map<mindset::UID, uint32_t>& indices;
+        std::optional<mindset::UID> weight;
+        bool collapse;
+
+        void read(mindset::UID neuron, std::vector<Entry>& entries, bool weights) const
+        {
+            entries.clear();
+            for (const mindset::Synapse& synapse : circuit.getPreSynapses(neuron)) {
+                auto it = indices.find(synapse.getPostSynapticNeuron());
+                if (it == indices.end()) {
+                    continue;
+                }
+                double value = 0.0;
+                if (weights && weight.has_value()) {
+                    auto property = synapse.getPropertyAsAnyPtr(weight.value());
+                    if (property.has_value()) {
+                        value = mindset::propertyAsNumber(*property.value()).value_or(0.0);
+                    }
+                }
+                entries.push_back({it->second, value});
+            }
+
+            // Sorting by weight too keeps the order of repeated columns deterministic.
+            std::ranges::sort(entries, [](const Entry& a, const Entry& b) {
+                return a.column != b.column ? a.column < b.column : a.weight < b.weight;
+            });
+
+            if (collapse && !entries.empty()) {
+                size_t last = 0;
+                for (size_t i = 1; i < entries.size(); ++i) {
+                    if (entries[i].column == entries[last].column) {
+                        entries[last].weight += entries[i].weight;
+                    } else {
+                        entries[++last] = entries[i];
+                    }
+                }
+                entries.resize(last + 1);
+            }
+        }
+    };
+
+    void appendNumber(std::string& text, auto value)
+    {
+        char buffer[32];
+        auto [end, error] = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        text.append(buffer, end);
+    }
+} // namespace
+
+namespace mindset
+{
+    Result<AdjacencyExportInfo, std::string> exportAdjacency(const Dataset& dataset, const std::filesystem::path& path,
+                                                             const AdjacencyExportSettings& settings)
+    {
+        MINDSET_TRACE_SCOPE("exportAdjacency");
+        std::vector<UID> uids;
+        uids.reserve(dataset.getNeuronsAmount());
+        for (UID uid : dataset.getNeuronsUIDs()) {
+            uids.push_back(uid);
+        }
+        std::ranges::sort(uids);
+
+        if (uids.size() > std::numeric_limits<uint32_t>::max()) {
+            return std::string("The dataset has too many neurons to be exported as an adjacency matrix.");
+        }
+
+        std::unordered_map<UID, uint32_t> indices;
+        indices.reserve(uids.size());
+        for (size_t i = 0; i < uids.size(); ++i) {
+            indices.emplace(uids[i], static_cast<uint32_t>(i));
+        }
+
+        std::optional<UID> weight;
+        if (settings.weightProperty.has_value()) {
+            weight = dataset.getProperties().getPropertyUID(settings.weightProperty.value());
+            if (!weight.has_value()) {
+                return "Property " + settings.weightProperty.value() + " not found.";
+            }
+        }
+        bool weighted = weight.has_value();
+
+        RowReader reader{dataset.getCircuit(), indices, weight, settings.collapse};
+        size_t rows = uids.size();
+        size_t chunks = (rows + CHUNK_SIZE - 1) / CHUNK_SIZE;
+        size_t threads = settings.threads == 0 ? defaultThreadCount() : settings.threads;
+        size_t workers = std::max<size_t>(1, std::min(threads, chunks));
+        std::vector<std::vector<Entry>> buffers(workers);
+
+        // First pass: the amount of entries of each row, so every section can be sized before writing it.
+        std::vector<uint64_t> rowPointers(rows + 1, 0);
+        parallelForChunks(
+            rows, CHUNK_SIZE,
+            [&](size_t thread, size_t begin, size_t end) {
+                for (size_t row = begin; row < end; ++row) {
+                    reader.read(uids[row], buffers[thread], false);
+                    rowPointers[row + 1] = buffers[thread].size();
+                }
+            },
+            settings.threads);
+        for (size_t row = 0; row < rows; ++row) {
+            rowPointers[row + 1] += rowPointers[row];
+        }
+        uint64_t entries = rowPointers.back();
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            return "Couldn't open " + path.string() + " for writing.";
+        }
+
+        // Second pass: batches of chunks are filled in parallel and then written in order.
+        size_t batchRows = workers * CHUNKS_PER_WORKER * CHUNK_SIZE;
+        std::atomic_bool changed = false;
+        auto fillBatch = [&](size_t batchBegin, auto&& fill) {
+            size_t batchEnd = std::min(rows, batchBegin + batchRows);
+            parallelForChunks(
+                batchEnd - batchBegin, CHUNK_SIZE,
+                [&](size_t thread, size_t begin, size_t end) {
+                    size_t chunk = begin / CHUNK_SIZE;
+                    for (size_t row = batchBegin + begin; row < batchBegin + end; ++row) {
+                        auto& rowEntries = buffers[thread];
+                        reader.read(uids[row], rowEntries, true);
+                        if (rowEntries.size() != rowPointers[row + 1] - rowPointers[row]) {
+                            changed = true;
+                        }
+                        fill(chunk, static_cast<uint32_t>(row), rowEntries);
+                    }
+                },
+                settings.threads);
+            return batchEnd;
+        };
+
+        uint64_t bytes;
+        if (settings.format == AdjacencyFormat::MATRIX_MARKET) {
+            out << "%%MatrixMarket matrix coordinate " << (weighted ? "real" : "pattern") << " general\n";
+            out << "% Row and column i correspond to the i-th neuron of the dataset by ascending UID.\n";
+            out << rows << ' ' << rows << ' ' << entries << '\n';
+
+            std::vector<std::string> texts(workers * CHUNKS_PER_WORKER);
+            for (size_t batchBegin = 0; batchBegin < rows;) {
+                for (auto& text : texts) {
+                    text.clear();
+                }
+                batchBegin = fillBatch(batchBegin, [&](size_t chunk, uint32_t row, const auto& rowEntries) {
+                    auto& text = texts[chunk];
+                    for (const Entry& entry : rowEntries) {
+                        // Matrix Market indices are one-based.
+                        appendNumber(text, row + 1);
+                        text.push_back(' ');
+                        appendNumber(text, entry.column + 1);
+                        if (weighted) {
+                            text.push_back(' ');
+                            appendNumber(text, entry.weight);
+                        }
+                        text.push_back('\n');
+                    }
+                });
+                for (auto& text : texts) {
+                    out.write(text.data(), static_cast<std::streamsize>(text.size()));
+                }
+            }
+            bytes = static_cast<uint64_t>(out.tellp());
+        } else {
+            bool csr = settings.layout == AdjacencyLayout::CSR;
+            AdjacencyFileHeader header = {};
+            std::ranges::copy(AdjacencyFileHeader::MAGIC, header.magic);
+            header.version = AdjacencyFileHeader::VERSION;
+            header.layout = static_cast<uint32_t>(settings.layout);
+            header.flags = (weighted ? static_cast<uint32_t>(ADJACENCY_WEIGHTED) : 0u) |
+                           (settings.collapse ? static_cast<uint32_t>(ADJACENCY_COLLAPSED) : 0u);
+            header.rows = rows;
+            header.entries = entries;
+            header.uidsOffset = align(sizeof(AdjacencyFileHeader));
+            header.rowsOffset = align(header.uidsOffset + rows * sizeof(UID));
+            header.columnsOffset = align(header.rowsOffset + (csr ? (rows + 1) * sizeof(uint64_t)
+                                                                  : entries * sizeof(uint32_t)));
+            bytes = header.columnsOffset + entries * sizeof(uint32_t);
+            if (weighted) {
+                header.weightsOffset = align(bytes);
+                bytes = header.weightsOffset + entries * sizeof(double);
+            }
+
+            AdjacencyFileHeader stored = header;
+            for (uint32_t* field : {&stored.version, &stored.layout, &stored.flags}) {
+                *field = toLittleEndian(*field);
+            }
+            for (uint64_t* field : {&stored.rows, &stored.entries, &stored.uidsOffset, &stored.rowsOffset,
+                                    &stored.columnsOffset, &stored.weightsOffset}) {
+                *field = toLittleEndian(*field);
+            }
+            out.write(reinterpret_cast<const char*>(&stored), sizeof(AdjacencyFileHeader));
+
+            // Gaps between sections are left as holes: seeking past the end zero-fills them.
+            out.seekp(static_cast<std::streamoff>(header.uidsOffset));
+            writeLittleEndian<UID>(out, uids);
+            if (csr) {
+                out.seekp(static_cast<std::streamoff>(header.rowsOffset));
+                writeLittleEndian<uint64_t>(out, rowPointers);
+            }
+
+            std::vector<RawChunk> chunkBuffers(workers * CHUNKS_PER_WORKER);
+            for (size_t batchBegin = 0; batchBegin < rows;) {
+                for (auto& chunk : chunkBuffers) {
+                    chunk.rows.clear();
+                    chunk.columns.clear();
+                    chunk.weights.clear();
+                }
+                uint64_t first = rowPointers[batchBegin];
+                batchBegin = fillBatch(batchBegin, [&](size_t index, uint32_t row, const auto& rowEntries) {
+                    auto& chunk = chunkBuffers[index];
+                    for (const Entry& entry : rowEntries) {
+                        if (!csr) {
+                            chunk.rows.push_back(row);
+                        }
+                        chunk.columns.push_back(entry.column);
+                        if (weighted) {
+                            chunk.weights.push_back(entry.weight);
+                        }
+                    }
+                });
+
+                if (!csr) {
+                    writeSection(out, header.rowsOffset, first, chunkBuffers, &RawChunk::rows);
+                }
+                writeSection(out, header.columnsOffset, first, chunkBuffers, &RawChunk::columns);
+                if (weighted) {
+                    writeSection(out, header.weightsOffset, first, chunkBuffers, &RawChunk::weights);
+                }
+            }
+
+            // Extends the file when the last sections are empty.
+            out.seekp(0, std::ios::end);
+            if (static_cast<uint64_t>(out.tellp()) < bytes) {
+                out.seekp(static_cast<std::streamoff>(bytes - 1));
+                out.put('\0');
+            }
+        }
+
+        if (!out) {
+            return "Couldn't write " + path.string() + ".";
+        }
+        if (changed) {
+            return "The circuit changed while exporting " + path.string() + ".";
+        }
+        return AdjacencyExportInfo{rows, entries, bytes};
+    }
+} // namespace mindset
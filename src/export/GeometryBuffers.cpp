@@ -0,0 +1,490 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <mindset/export/GeometryBuffers.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <unordered_map>
+
+#include <mindset/DefaultProperties.h>
+#include <mindset/util/Parallel.h>
+#include <mindset/util/WorldGeometryCache.h>
+#include <mindset/util/Trace.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #define MINDSET_HAS_MMAP
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace
+{
+    constexpr char FILE_MAGIC[8] = {'M', 'N', 'D', 'S', 'G', 'E', 'O', 'M'};
+    constexpr uint32_t FILE_VERSION = 1;
+    constexpr uint64_t FILE_ALIGNMENT = 64;
+
+    enum FileSectionIndex : uint32_t
+    {
+        SECTION_VERTICES = 0,
+        SECTION_LINE_INDICES,
+        SECTION_CAPSULE_INDICES,
+        SECTION_MORPHOLOGIES,
+        SECTION_INSTANCES,
+        SECTION_AMOUNT
+    };
+
+    struct FileSection
+    {
+        uint64_t offset;
+        uint64_t count;
+        uint32_t stride;
+        uint32_t reserved;
+    };
+
+    struct FileHeader
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t sections;
+        FileSection section[SECTION_AMOUNT];
+    };
+
+    constexpr uint32_t SECTION_STRIDES[SECTION_AMOUNT] = {
+        sizeof(mindset::PackedVertex),
+        sizeof(uint32_t),
+        sizeof(uint32_t),
+        sizeof(mindset::PackedMorphologyRange),
+        sizeof(mindset::PackedInstance),
+    };
+
+    constexpr uint32_t CAPSULE_CORNERS[6] = {0, 1, 2, 2, 1, 3};
+
+    uint64_t align(uint64_t value)
+    {
+        return (value + FILE_ALIGNMENT - 1) / FILE_ALIGNMENT * FILE_ALIGNMENT;
+    }
+
+    /**
+     * A morphology to export: its local geometry and, if it's baked into a neuron, the neuron's transform.
+     */
+    struct Source
+    {
+        std::shared_ptr<mindset::Morphology> morphology;
+        std::optional<mindset::NeuronTransform> bake;
+        mindset::MorphologyGeometry geometry;
+        bool soma = false;
+        uint32_t segments = 0;
+    };
+
+    void storeModel(const rush::Mat4f& model, float* out)
+    {
+        for (size_t c = 0; c < 4; ++c) {
+            for (size_t r = 0; r < 4; ++r) {
+                out[c * 4 + r] = model[c][r];
+            }
+        }
+    }
+} // namespace
+
+namespace mindset
+{
+    void GeometryBuffers::build(const Dataset& dataset, const GeometryExportSettings& settings)
+    {
+        std::vector<UID> neurons;
+        neurons.reserve(dataset.getNeuronsAmount());
+        for (UID uid : dataset.getNeuronsUIDs()) {
+            neurons.push_back(uid);
+        }
+        std::ranges::sort(neurons);
+        build(dataset, neurons, settings);
+    }
+
+    void GeometryBuffers::build(const Dataset& dataset, std::span<const UID> neurons,
+                                const GeometryExportSettings& settings)
+    {
+        MINDSET_TRACE_SCOPE("GeometryBuffers::build");
+        clear();
+
+        std::optional<UID> transformProperty = dataset.getProperties().getPropertyUID(PROPERTY_TRANSFORM);
+
+        std::vector<Source> sources;
+        std::unordered_map<const Morphology*, uint32_t> sourceIndices;
+        std::vector<std::pair<const Neuron*, uint32_t>> instances;
+        instances.reserve(neurons.size());
+
+        for (UID uid : neurons) {
+            auto neuron = dataset.getNeuron(uid);
+            if (!neuron || neuron.value()->getMorphologyPtr() == nullptr) {
+                continue;
+            }
+            auto& morphology = neuron.value()->getMorphologyPtr();
+
+            std::optional<NeuronTransform> transform;
+            if (transformProperty) {
+                transform = neuron.value()->getProperty<NeuronTransform>(transformProperty.value());
+            }
+
+            if (settings.instancing) {
+                auto [it, added] = sourceIndices.try_emplace(morphology.get(), static_cast<uint32_t>(sources.size()));
+                if (added) {
+                    sources.push_back({morphology, std::nullopt, {}});
+                }
+                instances.emplace_back(neuron.value(), it->second);
+            } else {
+                instances.emplace_back(neuron.value(), static_cast<uint32_t>(sources.size()));
+                sources.push_back({morphology, std::move(transform), {}});
+            }
+        }
+
+        parallelFor(
+            sources.size(),
+            [&](size_t i) {
+                auto& source = sources[i];
+                source.geometry = MorphologyGeometry::extract(dataset, *source.morphology);
+                source.soma = settings.includeSoma && source.geometry.somaCenter.has_value();
+                for (size_t point = 0; point < source.geometry.parents.size(); ++point) {
+                    if (source.geometry.hasParentPoint(point) ||
+                        (source.soma && source.geometry.parents[point] == MorphologyGeometry::SOMA_PARENT)) {
+                        ++source.segments;
+                    }
+                }
+            },
+            settings.threads);
+
+        // resize() keeps the capacity when shrinking, so repeated builds don't reallocate.
+        _morphologies.resize(sources.size());
+        size_t vertices = 0;
+        size_t segments = 0;
+        for (size_t i = 0; i < sources.size(); ++i) {
+            auto& source = sources[i];
+            uint32_t vertexCount = static_cast<uint32_t>(source.geometry.positions.size()) + (source.soma ? 1 : 0);
+            _morphologies[i] = {
+                .firstVertex = static_cast<uint32_t>(vertices),
+                .vertexCount = vertexCount,
+                .firstLineIndex = static_cast<uint32_t>(segments * 2),
+                .lineIndexCount = source.segments * 2,
+                .firstCapsuleIndex = static_cast<uint32_t>(segments * 6),
+                .capsuleIndexCount = source.segments * 6,
+            };
+            vertices += vertexCount;
+            segments += source.segments;
+        }
+
+        _vertices.resize(vertices);
+        _lineIndices.resize(segments * 2);
+        _capsuleIndices.resize(segments * 6);
+
+        parallelFor(
+            sources.size(),
+            [&](size_t i) {
+                auto& source = sources[i];
+                auto& geometry = source.geometry;
+                auto& range = _morphologies[i];
+
+                std::vector<rush::Vec3f> baked;
+                std::optional<rush::Vec3f> somaCenter = geometry.somaCenter;
+                if (source.bake) {
+                    baked = source.bake->positionsToGlobalCoordinates(geometry.positions);
+                    if (somaCenter) {
+                        somaCenter = source.bake->positionToGlobalCoordinates(somaCenter.value());
+                    }
+                }
+                auto& positions = source.bake ? baked : geometry.positions;
+
+                PackedVertex* vertex = _vertices.data() + range.firstVertex;
+                uint32_t somaVertex = range.firstVertex;
+                uint32_t firstPoint = range.firstVertex;
+                if (source.soma) {
+                    auto center = somaCenter.value();
+                    *vertex++ = {
+                        .position = {center.x(), center.y(), center.z()},
+                        .radius = geometry.somaRadius,
+                        .type = static_cast<uint32_t>(NeuriteType::SOMA),
+                        .neurite = PackedVertex::NO_NEURITE,
+                    };
+                    ++firstPoint;
+                }
+
+                for (size_t point = 0; point < positions.size(); ++point) {
+                    auto& position = positions[point];
+                    *vertex++ = {
+                        .position = {position.x(), position.y(), position.z()},
+                        .radius = geometry.radii[point],
+                        .type = static_cast<uint32_t>(geometry.types[point]),
+                        .neurite = geometry.neurites[point],
+                    };
+                }
+
+                uint32_t* line = _lineIndices.data() + range.firstLineIndex;
+                uint32_t* capsule = _capsuleIndices.data() + range.firstCapsuleIndex;
+                uint32_t segment = range.firstLineIndex / 2;
+                for (size_t point = 0; point < geometry.parents.size(); ++point) {
+                    uint32_t parent;
+                    if (geometry.hasParentPoint(point)) {
+                        parent = firstPoint + geometry.parents[point];
+                    } else if (source.soma && geometry.parents[point] == MorphologyGeometry::SOMA_PARENT) {
+                        parent = somaVertex;
+                    } else {
+                        continue;
+                    }
+
+                    *line++ = parent;
+                    *line++ = firstPoint + static_cast<uint32_t>(point);
+                    for (uint32_t corner : CAPSULE_CORNERS) {
+                        *capsule++ = segment * 4 + corner;
+                    }
+                    ++segment;
+                }
+            },
+            settings.threads);
+
+        static const rush::Mat4f IDENTITY(1.0f);
+        _instances.resize(instances.size());
+        parallelFor(
+            instances.size(),
+            [&](size_t i) {
+                auto [neuron, morphology] = instances[i];
+                auto& instance = _instances[i];
+                instance = {};
+                instance.morphology = morphology;
+                instance.neuron = neuron->getUID();
+
+                std::optional<NeuronTransform> transform;
+                if (settings.instancing && transformProperty) {
+                    transform = neuron->getProperty<NeuronTransform>(transformProperty.value());
+                }
+                storeModel(transform ? transform->getModel() : IDENTITY, instance.model);
+            },
+            settings.threads);
+    }
+
+    void GeometryBuffers::clear()
+    {
+        _vertices.clear();
+        _lineIndices.clear();
+        _capsuleIndices.clear();
+        _morphologies.clear();
+        _instances.clear();
+    }
+
+    std::span<const PackedVertex> GeometryBuffers::getVertices() const
+    {
+        return _vertices;
+    }
+
+    std::span<const uint32_t> GeometryBuffers::getLineIndices() const
+    {
+        return _lineIndices;
+    }
+
+    std::span<const uint32_t> GeometryBuffers::getCapsuleIndices() const
+    {
+        return _capsuleIndices;
+    }
+
+    std::span<const PackedMorphologyRange> GeometryBuffers::getMorphologies() const
+    {
+        return _morphologies;
+    }
+
+    std::span<const PackedInstance> GeometryBuffers::getInstances() const
+    {
+        return _instances;
+    }
+
+    size_t GeometryBuffers::getByteSize() const
+    {
+        return _vertices.size() * sizeof(PackedVertex) + _lineIndices.size() * sizeof(uint32_t) +
+               _capsuleIndices.size() * sizeof(uint32_t) + _morphologies.size() * sizeof(PackedMorphologyRange) +
+               _instances.size() * sizeof(PackedInstance);
+    }
+
+    Result<size_t, std::string> GeometryBuffers::write(const std::filesystem::path& path) const
+    {
+        MINDSET_TRACE_SCOPE("GeometryBuffers::write");
+        std::span<const std::byte> sections[SECTION_AMOUNT] = {
+            std::as_bytes(getVertices()),     std::as_bytes(getLineIndices()), std::as_bytes(getCapsuleIndices()),
+            std::as_bytes(getMorphologies()), std::as_bytes(getInstances()),
+        };
+
+        FileHeader header = {};
+        std::memcpy(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+        header.version = FILE_VERSION;
+        header.sections = SECTION_AMOUNT;
+
+        uint64_t offset = align(sizeof(FileHeader));
+        for (uint32_t i = 0; i < SECTION_AMOUNT; ++i) {
+            header.section[i] = {
+                .offset = offset,
+                .count = sections[i].size() / SECTION_STRIDES[i],
+                .stride = SECTION_STRIDES[i],
+                .reserved = 0,
+            };
+            offset = align(offset + sections[i].size());
+        }
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            return "Couldn't open " + path.string() + " for writing.";
+        }
+
+        static const char PADDING[FILE_ALIGNMENT] = {};
+        out.write(reinterpret_cast<const char*>(&header), sizeof(FileHeader));
+        uint64_t written = sizeof(FileHeader);
+        for (uint32_t i = 0; i < SECTION_AMOUNT; ++i) {
+            out.write(PADDING, static_cast<std::streamsize>(header.section[i].offset - written));
+            out.write(reinterpret_cast<const char*>(sections[i].data()),
+                      static_cast<std::streamsize>(sections[i].size()));
+            written = header.section[i].offset + sections[i].size();
+        }
+        out.write(PADDING, static_cast<std::streamsize>(offset - written));
+
+        if (!out) {
+            return "Couldn't write " + path.string() + ".";
+        }
+        return static_cast<size_t>(offset);
+    }
+
+    MappedGeometryFile::MappedGeometryFile() :
+        _data(nullptr),
+        _size(0),
+        _mapped(false)
+    {
+    }
+
+    MappedGeometryFile::~MappedGeometryFile()
+    {
+#ifdef MINDSET_HAS_MMAP
+        if (_mapped) {
+            munmap(const_cast<std::byte*>(_data), _size);
+        }
+#endif
+    }
+
+    Result<std::unique_ptr<MappedGeometryFile>, std::string> MappedGeometryFile::open(
+        const std::filesystem::path& path)
+    {
+        std::unique_ptr<MappedGeometryFile> file(new MappedGeometryFile());
+
+#ifdef MINDSET_HAS_MMAP
+        int descriptor = ::open(path.c_str(), O_RDONLY);
+        if (descriptor < 0) {
+            return "Couldn't open " + path.string() + ".";
+        }
+        struct stat status = {};
+        if (fstat(descriptor, &status) != 0) {
+            close(descriptor);
+            return "Couldn't read the size of " + path.string() + ".";
+        }
+        file->_size = static_cast<size_t>(status.st_size);
+        if (file->_size >= sizeof(FileHeader)) {
+            void* data = mmap(nullptr, file->_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+            if (data != MAP_FAILED) {
+                file->_data = static_cast<const std::byte*>(data);
+                file->_mapped = true;
+            }
+        }
+        close(descriptor);
+#endif
+
+        if (!file->_mapped) {
+            std::ifstream in(path, std::ios::binary | std::ios::ate);
+            if (!in) {
+                return "Couldn't open " + path.string() + ".";
+            }
+            file->_size = static_cast<size_t>(in.tellg());
+            file->_buffer.resize(file->_size);
+            in.seekg(0);
+            in.read(reinterpret_cast<char*>(file->_buffer.data()), static_cast<std::streamsize>(file->_size));
+            if (!in) {
+                return "Couldn't read " + path.string() + ".";
+            }
+            file->_data = file->_buffer.data();
+        }
+
+        if (file->_size < sizeof(FileHeader)) {
+            return path.string() + " is not a geometry file.";
+        }
+
+        FileHeader header;
+        std::memcpy(&header, file->_data, sizeof(FileHeader));
+        if (std::memcmp(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0) {
+            return path.string() + " is not a geometry file.";
+        }
+        if (header.version != FILE_VERSION || header.sections != SECTION_AMOUNT) {
+            return path.string() + " uses an unsupported version (" + std::to_string(header.version) + ").";
+        }
+
+        for (uint32_t i = 0; i < SECTION_AMOUNT; ++i) {
+            auto& section = header.section[i];
+            if (section.stride != SECTION_STRIDES[i] || section.offset % FILE_ALIGNMENT != 0 ||
+                section.offset > file->_size || section.count > (file->_size - section.offset) / section.stride) {
+                return path.string() + " is corrupted: section " + std::to_string(i) + " is out of bounds.";
+            }
+        }
+
+        auto sectionData = [&](uint32_t i) { return file->_data + header.section[i].offset; };
+        file->_vertices = {reinterpret_cast<const PackedVertex*>(sectionData(SECTION_VERTICES)),
+                           header.section[SECTION_VERTICES].count};
+        file->_lineIndices = {reinterpret_cast<const uint32_t*>(sectionData(SECTION_LINE_INDICES)),
+                              header.section[SECTION_LINE_INDICES].count};
+        file->_capsuleIndices = {reinterpret_cast<const uint32_t*>(sectionData(SECTION_CAPSULE_INDICES)),
+                                 header.section[SECTION_CAPSULE_INDICES].count};
+        file->_morphologies = {reinterpret_cast<const PackedMorphologyRange*>(sectionData(SECTION_MORPHOLOGIES)),
+                               header.section[SECTION_MORPHOLOGIES].count};
+        file->_instances = {reinterpret_cast<const PackedInstance*>(sectionData(SECTION_INSTANCES)),
+                            header.section[SECTION_INSTANCES].count};
+
+        return file;
+    }
+
+    std::span<const PackedVertex> MappedGeometryFile::getVertices() const
+    {
+        return _vertices;
+    }
+
+    std::span<const uint32_t> MappedGeometryFile::getLineIndices() const
+    {
+        return _lineIndices;
+    }
+
+    std::span<const uint32_t> MappedGeometryFile::getCapsuleIndices() const
+    {
+        return _capsuleIndices;
+    }
+
+    std::span<const PackedMorphologyRange> MappedGeometryFile::getMorphologies() const
+    {
+        return _morphologies;
+    }
+
+    std::span<const PackedInstance> MappedGeometryFile::getInstances() const
+    {
+        return _instances;
+    }
+
+    size_t MappedGeometryFile::getByteSize() const
+    {
+        return _size;
+    }
+} // namespace mindset
@@ -0,0 +1,635 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <mindset/generator/DatasetGenerator.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <variant>
+
+#include <mindset/DefaultProperties.h>
+#include <mindset/EventSequence.h>
+#include <mindset/TimeGrid.h>
+#include <mindset/util/NeuronTransform.h>
+#include <mindset/util/Parallel.h>
+#include <mindset/util/Trace.h>
+#include <mindset/util/MemoryTracker.h>
+
+namespace
+{
+    using namespace mindset;
+
+    constexpr size_t SYNAPSE_CHUNK_SIZE = 1 << 16;
+    constexpr UID SOMA_UID = 1;
+
+    enum class Stream : uint64_t
+    {
+        MORPHOLOGY,
+        NEURON,
+        WEIGHTS,
+        SYNAPSES,
+        ACTIVITY
+    };
+
+    /**
+     * SplitMix64. Cheap to seed, so every element can have its own stream.
+     */
+    class Random
+    {
+        uint64_t _state;
+
+      public:
+        using result_type = uint64_t;
+
+        Random(uint64_t seed, Stream stream, uint64_t index) :
+            _state(seed)
+        {
+            _state = (*this)() ^ (static_cast<uint64_t>(stream) * 0x9E3779B97F4A7C15ull);
+            _state = (*this)() ^ index;
+            (*this)();
+        }
+
+        static constexpr result_type min()
+        {
+            return 0;
+        }
+
+        static constexpr result_type max()
+        {
+            return std::numeric_limits<result_type>::max();
+        }
+
+        result_type operator()()
+        {
+            uint64_t z = (_state += 0x9E3779B97F4A7C15ull);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
+        }
+
+        float uniform(float min = 0.0f, float max = 1.0f)
+        {
+            return min + static_cast<float>((*this)() >> 40) / static_cast<float>(1 << 24) * (max - min);
+        }
+
+        size_t index(size_t size)
+        {
+            return static_cast<size_t>((*this)() % size);
+        }
+
+        rush::Vec3f direction()
+        {
+            std::normal_distribution<float> normal;
+            rush::Vec3f result(normal(*this), normal(*this), normal(*this));
+            float length = result.length();
+            return length > 0.0f ? result / length : rush::Vec3f(0.0f, 1.0f, 0.0f);
+        }
+    };
+
+    /**
+     * Samples indices proportionally to their weights in constant time (Vose's alias method).
+     */
+    class AliasTable
+    {
+        std::vector<float> _probabilities;
+        std::vector<uint32_t> _aliases;
+
+      public:
+        explicit AliasTable(const std::vector<double>& weights) :
+            _probabilities(weights.size()),
+            _aliases(weights.size())
+        {
+            double total = 0.0;
+            for (double weight : weights) {
+                total += weight;
+            }
+
+            std::vector<double> scaled(weights.size());
+            std::vector<uint32_t> small, large;
+            for (uint32_t i = 0; i < weights.size(); ++i) {
+                scaled[i] = weights[i] * static_cast<double>(weights.size()) / total;
+                (scaled[i] < 1.0 ? small : large).push_back(i);
+            }
+
+            while (!small.empty() && !large.empty()) {
+                uint32_t less = small.back();
+                uint32_t more = large.back();
+                small.pop_back();
+                large.pop_back();
+                _probabilities[less] = static_cast<float>(scaled[less]);
+                _aliases[less] = more;
+                scaled[more] = scaled[more] + scaled[less] - 1.0;
+                (scaled[more] < 1.0 ? small : large).push_back(more);
+            }
+
+            for (uint32_t i : large) {
+                _probabilities[i] = 1.0f;
+                _aliases[i] = i;
+            }
+            for (uint32_t i : small) {
+                _probabilities[i] = 1.0f;
+                _aliases[i] = i;
+            }
+        }
+
+        uint32_t sample(Random& random) const
+        {
+            auto i = static_cast<uint32_t>(random.index(_probabilities.size()));
+            return random.uniform() < _probabilities[i] ? i : _aliases[i];
+        }
+    };
+
+    struct GeneratorProperties
+    {
+        UID position;
+        UID radius;
+        UID parent;
+        UID neuriteType;
+        UID name;
+        UID transform;
+        UID column;
+        UID layer;
+        UID synapsePosition;
+        UID synapsePreNeurite;
+        UID synapsePostNeurite;
+        UID synapsePrePosition;
+        UID synapsePostPosition;
+        UID activitySpikes;
+        UID activityVoltage;
+    };
+
+    GeneratorProperties defineProperties(Dataset& dataset)
+    {
+        auto lock = dataset.writeLock();
+        auto& properties = dataset.getProperties();
+
+        GeneratorProperties result{};
+        result.position = properties.defineProperty(PROPERTY_POSITION);
+        result.radius = properties.defineProperty(PROPERTY_RADIUS);
+        result.parent = properties.defineProperty(PROPERTY_PARENT);
+        result.neuriteType = properties.defineProperty(PROPERTY_NEURITE_TYPE);
+        result.name = properties.defineProperty(PROPERTY_NAME);
+        result.transform = properties.defineProperty(PROPERTY_TRANSFORM);
+        result.column = properties.defineProperty(PROPERTY_COLUMN);
+        result.layer = properties.defineProperty(PROPERTY_LAYER);
+        result.synapsePosition = result.position;
+        result.synapsePreNeurite = properties.defineProperty(PROPERTY_SYNAPSE_PRE_NEURITE);
+        result.synapsePostNeurite = properties.defineProperty(PROPERTY_SYNAPSE_POST_NEURITE);
+        result.synapsePrePosition = properties.defineProperty(PROPERTY_SYNAPSE_PRE_POSITION);
+        result.synapsePostPosition = properties.defineProperty(PROPERTY_SYNAPSE_POST_POSITION);
+        result.activitySpikes = properties.defineProperty(PROPERTY_ACTIVITY_SPIKES);
+        result.activityVoltage = properties.defineProperty(PROPERTY_ACTIVITY_VOLTAGE);
+        return result;
+    }
+
+    struct Tip
+    {
+        UID neurite;
+        rush::Vec3f position;
+        rush::Vec3f direction;
+        float radius;
+    };
+
+    std::shared_ptr<Morphology> growMorphology(const GeneratorProperties& properties,
+                                               const GeneratorMorphologySettings& settings, uint64_t seed,
+                                               size_t index)
+    {
+        Random random(seed, Stream::MORPHOLOGY, index);
+        auto morphology = std::make_shared<Morphology>();
+        morphology->setProperty(properties.name, "synthetic_" + std::to_string(index));
+
+        float somaRadius = random.uniform(5.0f, 9.0f);
+        Soma soma(SOMA_UID);
+        soma.addNode({rush::Vec3f(0.0f), somaRadius});
+        morphology->setSoma(std::move(soma));
+
+        UID next = SOMA_UID + 1;
+        auto addNeurite = [&](NeuriteType type, UID parent, const rush::Vec3f& position, float radius) {
+            Neurite neurite(next);
+            neurite.setProperty(properties.neuriteType, type);
+            neurite.setProperty(properties.position, position);
+            neurite.setProperty(properties.radius, radius);
+            neurite.setProperty(properties.parent, parent);
+            morphology->addNeurite(std::move(neurite));
+            return next++;
+        };
+
+        // Trees grow all their tips one step at a time, so branches get a similar share of the points.
+        auto growTree = [&](NeuriteType type, rush::Vec3f direction, float radius, float branchProbability) {
+            direction = direction.normalized();
+            // The SWC loader merges points close to the soma into it. Start outside that area.
+            rush::Vec3f start = direction * somaRadius * 1.5f;
+            std::vector<Tip> tips = {{addNeurite(type, SOMA_UID, start, radius), start, direction, radius}};
+            std::vector<Tip> nextTips;
+
+            size_t points = 1;
+            while (!tips.empty() && points < settings.pointsPerTree) {
+                nextTips.clear();
+                for (auto& tip : tips) {
+                    if (points >= settings.pointsPerTree) {
+                        break;
+                    }
+                    if (random.uniform() < 0.004f) {
+                        continue;
+                    }
+
+                    rush::Vec3f newDirection =
+                        (tip.direction + random.direction() * settings.tortuosity).normalized();
+                    rush::Vec3f position = tip.position + newDirection * settings.segmentLength;
+                    float newRadius = std::max(0.1f, tip.radius * 0.99f);
+                    UID uid = addNeurite(type, tip.neurite, position, newRadius);
+                    ++points;
+
+                    nextTips.push_back({uid, position, newDirection, newRadius});
+                    if (random.uniform() < branchProbability) {
+                        rush::Vec3f branch = (newDirection + random.direction() * 0.8f).normalized();
+                        nextTips.push_back({uid, position, branch, newRadius * 0.8f});
+                    }
+                }
+                std::swap(tips, nextTips);
+            }
+        };
+
+        size_t maxDendrites = std::max(settings.minDendrites, settings.maxDendrites);
+        size_t dendrites = settings.minDendrites + random.index(maxDendrites - settings.minDendrites + 1);
+        for (size_t i = 0; i < dendrites; ++i) {
+            growTree(NeuriteType::BASAL_DENDRITE, random.direction(), random.uniform(0.8f, 1.2f),
+                     settings.branchProbability);
+        }
+        if (settings.apicalDendrite) {
+            growTree(NeuriteType::APICAL_DENDRITE, rush::Vec3f(0.0f, 1.0f, 0.0f) + random.direction() * 0.1f, 1.5f,
+                     settings.branchProbability * 0.5f);
+        }
+        growTree(NeuriteType::AXON, rush::Vec3f(0.0f, -1.0f, 0.0f) + random.direction() * 0.3f, 0.5f,
+                 settings.branchProbability);
+
+        return morphology;
+    }
+
+    /**
+     * The points of a morphology where synapses can be placed.
+     */
+    struct SynapseSites
+    {
+        std::vector<std::pair<UID, rush::Vec3f>> axon;
+        std::vector<std::pair<UID, rush::Vec3f>> dendrites;
+    };
+
+    SynapseSites findSynapseSites(const GeneratorProperties& properties, const Morphology& morphology)
+    {
+        SynapseSites sites;
+        for (auto* neurite : morphology.getNeurites()) {
+            auto type = neurite->getProperty<NeuriteType>(properties.neuriteType);
+            auto position = neurite->getProperty<rush::Vec3f>(properties.position);
+            if (!type || !position) {
+                continue;
+            }
+            if (type == NeuriteType::AXON) {
+                sites.axon.emplace_back(neurite->getUID(), position.value());
+            } else {
+                sites.dendrites.emplace_back(neurite->getUID(), position.value());
+            }
+        }
+        // Neurites are stored in a hash map. Sorting makes the sites independent of its iteration order.
+        auto byUID = [](const auto& a, const auto& b) { return a.first < b.first; };
+        std::ranges::sort(sites.axon, byUID);
+        std::ranges::sort(sites.dendrites, byUID);
+        return sites;
+    }
+
+    std::vector<double> logNormalWeights(Random& random, size_t amount, float sigma)
+    {
+        std::normal_distribution<double> normal(0.0, sigma);
+        std::vector<double> weights(amount);
+        for (auto& weight : weights) {
+            weight = std::exp(normal(random));
+        }
+        return weights;
+    }
+
+    template<class Range>
+    UID nextFreeUID(Range&& uids)
+    {
+        UID next = 0;
+        for (UID uid : uids) {
+            next = std::max(next, uid + 1);
+        }
+        return next;
+    }
+} // namespace
+
+namespace mindset
+{
+    DatasetGenerator::DatasetGenerator(DatasetGeneratorSettings settings) :
+        _settings(std::move(settings))
+    {
+    }
+
+    const DatasetGeneratorSettings& DatasetGenerator::getSettings() const
+    {
+        return _settings;
+    }
+
+    std::shared_ptr<Morphology> DatasetGenerator::generateMorphology(Dataset& dataset, size_t index) const
+    {
+        return growMorphology(defineProperties(dataset), _settings.morphology, _settings.seed, index);
+    }
+
+    void DatasetGenerator::generate(Dataset& dataset) const
+    {
+        MINDSET_TRACE_SCOPE("DatasetGenerator::generate");
+        AllocationScope allocationScope("DatasetGenerator");
+        auto properties = defineProperties(dataset);
+        size_t neuronsAmount = _settings.neurons;
+        size_t threads = _settings.threads;
+        auto allocator = dataset.getAllocator();
+
+        // Generated elements are appended after the existing ones, so previous contents are never replaced.
+        UID firstNeuron, firstSynapse;
+        {
+            auto lock = dataset.readLock();
+            firstNeuron = nextFreeUID(dataset.getNeuronsUIDs());
+        }
+        {
+            auto& circuit = dataset.getCircuit();
+            auto lock = circuit.readLock();
+            firstSynapse = nextFreeUID(circuit.getSynapsesUIDs());
+        }
+
+        // Morphologies
+        std::vector<std::shared_ptr<Morphology>> morphologies;
+        std::vector<SynapseSites> sites;
+        if (_settings.morphologies && neuronsAmount > 0) {
+            size_t amount = _settings.morphology.amount == 0 ? neuronsAmount
+                                                              : std::min(_settings.morphology.amount, neuronsAmount);
+            morphologies.resize(amount);
+            sites.resize(amount);
+            parallelFor(
+                amount,
+                [&](size_t i) {
+                    morphologies[i] = growMorphology(properties, _settings.morphology, _settings.seed, i);
+                    sites[i] = findSynapseSites(properties, *morphologies[i]);
+                },
+                threads);
+        }
+
+        // Neurons
+        auto& placement = _settings.placement;
+        size_t columns = std::max<size_t>(1, placement.columns);
+        size_t layers = std::max<size_t>(1, placement.layers);
+        auto gridWidth = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(columns))));
+
+        std::vector<std::optional<Neuron>> generated(neuronsAmount);
+        std::vector<NeuronTransform> transforms(neuronsAmount);
+        std::vector<uint32_t> morphologyIndices(neuronsAmount, 0);
+        std::vector<std::pair<UID, UID>> locations(neuronsAmount);
+
+        parallelFor(
+            neuronsAmount,
+            [&](size_t i) {
+                Random random(_settings.seed, Stream::NEURON, i);
+                UID column = static_cast<UID>(i % columns);
+                UID layer = static_cast<UID>(random.index(layers));
+
+                float angle = random.uniform(0.0f, 2.0f * std::numbers::pi_v<float>);
+                float distance = placement.columnRadius * std::sqrt(random.uniform());
+                rush::Vec3f center(static_cast<float>(column % gridWidth) * placement.columnSpacing, 0.0f,
+                                   static_cast<float>(column / gridWidth) * placement.columnSpacing);
+                rush::Vec3f position =
+                    center + rush::Vec3f(std::cos(angle) * distance,
+                                         -(static_cast<float>(layer) + random.uniform()) * placement.layerThickness,
+                                         std::sin(angle) * distance);
+
+                auto& transform = transforms[i];
+                transform.setPosition(position);
+                transform.setRotation(rush::Vec3f(0.0f, random.uniform(0.0f, 2.0f * std::numbers::pi_v<float>), 0.0f));
+
+                std::shared_ptr<Morphology> morphology;
+                if (!morphologies.empty()) {
+                    morphologyIndices[i] = static_cast<uint32_t>(
+                        morphologies.size() == neuronsAmount ? i : random.index(morphologies.size()));
+                    morphology = morphologies[morphologyIndices[i]];
+                }
+
+                Neuron neuron(firstNeuron + static_cast<UID>(i), std::move(morphology), allocator);
+                neuron.setProperty(properties.transform, transform);
+                if (_settings.hierarchy) {
+                    neuron.setProperty(properties.column, column);
+                    neuron.setProperty(properties.layer, layer);
+                }
+                locations[i] = {column, layer};
+                generated[i] = std::move(neuron);
+            },
+            threads);
+
+        {
+            std::vector<Neuron> neurons;
+            neurons.reserve(neuronsAmount);
+            for (auto& neuron : generated) {
+                neurons.push_back(std::move(neuron.value()));
+            }
+            generated.clear();
+
+            auto lock = dataset.writeLock();
+            dataset.addNeurons(std::move(neurons));
+
+            if (_settings.hierarchy && neuronsAmount > 0) {
+                Node* root = dataset.getHierarchy().value_or(nullptr);
+                if (root == nullptr) {
+                    root = dataset.createHierarchy(0, "mindset:root");
+                }
+                for (size_t i = 0; i < neuronsAmount; ++i) {
+                    auto [column, layer] = locations[i];
+                    if (auto columnResult = root->getOrCreateNode(column, "mindset:column"); columnResult.isOk()) {
+                        if (auto layerResult = columnResult.getResult()->getOrCreateNode(layer, "mindset:layer");
+                            layerResult.isOk()) {
+                            layerResult.getResult()->addNeuron(firstNeuron + static_cast<UID>(i));
+                        }
+                    }
+                }
+            }
+        }
+
+        // Synapses
+        auto& synapseSettings = _settings.synapses;
+        bool canConnect = neuronsAmount > 1 || (neuronsAmount == 1 && synapseSettings.allowAutapses);
+        if (synapseSettings.amount > 0 && canConnect) {
+            Random weightsRandom(_settings.seed, Stream::WEIGHTS, 0);
+            AliasTable preTable(logNormalWeights(weightsRandom, neuronsAmount, synapseSettings.degreeSigma));
+            AliasTable postTable(logNormalWeights(weightsRandom, neuronsAmount, synapseSettings.degreeSigma));
+            bool positions = synapseSettings.positions && !morphologies.empty();
+
+            size_t chunks = (synapseSettings.amount + SYNAPSE_CHUNK_SIZE - 1) / SYNAPSE_CHUNK_SIZE;
+            std::vector<std::vector<Synapse>> generatedSynapses(chunks);
+
+            parallelForChunks(
+                synapseSettings.amount, SYNAPSE_CHUNK_SIZE,
+                [&](size_t, size_t begin, size_t end) {
+                    size_t chunk = begin / SYNAPSE_CHUNK_SIZE;
+                    Random random(_settings.seed, Stream::SYNAPSES, chunk);
+                    auto& result = generatedSynapses[chunk];
+                    result.reserve(end - begin);
+
+                    for (size_t i = begin; i < end; ++i) {
+                        uint32_t pre = preTable.sample(random);
+                        uint32_t post = postTable.sample(random);
+                        while (!synapseSettings.allowAutapses && pre == post) {
+                            post = postTable.sample(random);
+                        }
+
+                        Synapse synapse(firstSynapse + static_cast<UID>(i), firstNeuron + pre, firstNeuron + post,
+                                        allocator);
+                        if (positions) {
+                            auto& preSites = sites[morphologyIndices[pre]].axon;
+                            auto& postSites = sites[morphologyIndices[post]].dendrites;
+                            if (!preSites.empty()) {
+                                auto& [neurite, local] = preSites[random.index(preSites.size())];
+                                synapse.setProperty(properties.synapsePreNeurite, neurite);
+                                synapse.setProperty(properties.synapsePrePosition,
+                                                    transforms[pre].positionToGlobalCoordinates(local));
+                            }
+                            if (!postSites.empty()) {
+                                auto& [neurite, local] = postSites[random.index(postSites.size())];
+                                auto global = transforms[post].positionToGlobalCoordinates(local);
+                                synapse.setProperty(properties.synapsePostNeurite, neurite);
+                                synapse.setProperty(properties.synapsePostPosition, global);
+                                synapse.setProperty(properties.synapsePosition, global);
+                            }
+                        }
+                        result.push_back(std::move(synapse));
+                    }
+                },
+                threads);
+
+            std::vector<Synapse> synapses;
+            synapses.reserve(synapseSettings.amount);
+            for (auto& chunk : generatedSynapses) {
+                std::ranges::move(chunk, std::back_inserter(synapses));
+                chunk = {};
+            }
+
+            auto& circuit = dataset.getCircuit();
+            auto lock = circuit.writeLock();
+            circuit.addSynapses(std::move(synapses));
+        }
+
+        // Activity
+        auto& activitySettings = _settings.activity;
+        bool voltage = activitySettings.voltageTimesteps > 0 && activitySettings.voltageDelta.count() > 0;
+        if ((!activitySettings.spikes && !voltage) || neuronsAmount == 0) {
+            return;
+        }
+
+        std::vector<std::vector<std::chrono::nanoseconds>> spikes(neuronsAmount);
+        std::vector<std::vector<double>> voltages(voltage ? neuronsAmount : 0);
+
+        parallelFor(
+            neuronsAmount,
+            [&](size_t i) {
+                Random random(_settings.seed, Stream::ACTIVITY, i);
+
+                // Log-normal rates with the requested mean: E[exp(N(0, s))] = exp(s^2 / 2).
+                constexpr double RATE_SIGMA = 0.5;
+                std::normal_distribution<double> normal(0.0, RATE_SIGMA);
+                double rate = activitySettings.meanRate * std::exp(normal(random) - RATE_SIGMA * RATE_SIGMA / 2.0);
+
+                auto& neuronSpikes = spikes[i];
+                if (rate > 0.0) {
+                    // Poisson process with a 2 ms refractory period.
+                    std::exponential_distribution<double> interval(rate);
+                    double time = 0.0;
+                    double duration = std::chrono::duration<double>(activitySettings.duration).count();
+                    while (true) {
+                        time += 0.002 + interval(random);
+                        if (time >= duration) {
+                            break;
+                        }
+                        neuronSpikes.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::duration<double>(time)));
+                    }
+                }
+
+                if (!voltage) {
+                    return;
+                }
+
+                // Resting potential with noise. Spikes peak and then recover from a hyperpolarized reset.
+                constexpr double REST = -70.0, RESET = -78.0, PEAK = 30.0, TAU = 10e-3;
+                double delta = std::chrono::duration<double>(activitySettings.voltageDelta).count();
+                std::normal_distribution<double> noise(0.0, 0.5);
+                auto& trace = voltages[i];
+                trace.resize(activitySettings.voltageTimesteps);
+
+                size_t nextSpike = 0;
+                double lastSpike = -std::numeric_limits<double>::infinity();
+                for (size_t step = 0; step < trace.size(); ++step) {
+                    double time = static_cast<double>(step) * delta;
+                    bool spiking = false;
+                    while (nextSpike < neuronSpikes.size() &&
+                           std::chrono::duration<double>(neuronSpikes[nextSpike]).count() <= time) {
+                        lastSpike = std::chrono::duration<double>(neuronSpikes[nextSpike++]).count();
+                        spiking = time - lastSpike < delta;
+                    }
+                    trace[step] = spiking ? PEAK : REST + (RESET - REST) * std::exp(-(time - lastSpike) / TAU) +
+                                                        noise(random);
+                }
+            },
+            threads);
+
+        std::optional<EventSequence<std::monostate>> sequence;
+        if (activitySettings.spikes) {
+            sequence.emplace();
+            for (size_t i = 0; i < neuronsAmount; ++i) {
+                for (auto time : spikes[i]) {
+                    sequence->addEvent(firstNeuron + static_cast<UID>(i), time, std::monostate());
+                }
+            }
+        }
+
+        std::optional<TimeGrid<double>> grid;
+        if (voltage) {
+            std::vector<UID> uids(neuronsAmount);
+            for (size_t i = 0; i < neuronsAmount; ++i) {
+                uids[i] = firstNeuron + static_cast<UID>(i);
+            }
+
+            grid.emplace(activitySettings.voltageDelta);
+            grid->defineUIDs(uids);
+            std::vector<double> timestep(neuronsAmount);
+            for (size_t step = 0; step < activitySettings.voltageTimesteps; ++step) {
+                for (size_t i = 0; i < neuronsAmount; ++i) {
+                    timestep[i] = voltages[i][step];
+                }
+                grid->addTimestep(timestep);
+            }
+        }
+
+        auto lock = dataset.writeLock();
+        Activity activity(dataset.findSmallestAvailableActivityUID(), dataset.getAllocator());
+        if (sequence) {
+            activity.setProperty(properties.activitySpikes, std::move(sequence.value()));
+        }
+        if (grid) {
+            activity.setProperty(properties.activityVoltage, std::move(grid.value()));
+        }
+        dataset.addActivity(std::move(activity));
+    }
+} // namespace mindset
@@ -0,0 +1,187 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <mindset/generator/SWCWriter.h>
+
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+#include <ranges>
+#include <unordered_map>
+
+#include <mindset/DefaultProperties.h>
+
+namespace
+{
+    using namespace mindset;
+
+    void appendNumber(std::string& line, auto value)
+    {
+        char buffer[32];
+        auto [end, error] = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        line.append(buffer, end);
+    }
+
+    void writePoint(std::ostream& out, std::string& line, int64_t id, uint32_t type, const rush::Vec3f& position,
+                    float radius, int64_t parent)
+    {
+        line.clear();
+        appendNumber(line, id);
+        line += ' ';
+        appendNumber(line, type);
+        for (size_t i = 0; i < 3; ++i) {
+            line += ' ';
+            appendNumber(line, position[i]);
+        }
+        line += ' ';
+        appendNumber(line, radius);
+        line += ' ';
+        appendNumber(line, parent);
+        line += '\n';
+        out << line;
+    }
+} // namespace
+
+namespace mindset
+{
+    Result<size_t, std::string> writeSWC(const Dataset& dataset, const Morphology& morphology, std::ostream& out)
+    {
+        auto& properties = dataset.getProperties();
+        auto positionProperty = properties.getPropertyUID(PROPERTY_POSITION);
+        auto radiusProperty = properties.getPropertyUID(PROPERTY_RADIUS);
+        auto parentProperty = properties.getPropertyUID(PROPERTY_PARENT);
+        auto typeProperty = properties.getPropertyUID(PROPERTY_NEURITE_TYPE);
+
+        std::string line;
+        size_t written = 0;
+
+        UID nextFreeUID = 0;
+        for (UID uid : morphology.getNeuritesUIDs()) {
+            nextFreeUID = std::max(nextFreeUID, uid + 1);
+        }
+
+        // A soma without nodes can't be represented in SWC. Its neurites are written as roots.
+        const Soma* soma = morphology.getSoma().value_or(nullptr);
+        if (soma != nullptr && soma->getNodes().empty()) {
+            soma = nullptr;
+        }
+        if (soma != nullptr) {
+            nextFreeUID = std::max(nextFreeUID, soma->getUID() + 1);
+            for (UID uid : soma->getExtraId()) {
+                nextFreeUID = std::max(nextFreeUID, uid + 1);
+            }
+
+            auto extraIds = soma->getExtraId().begin();
+            auto& nodes = soma->getNodes();
+            for (size_t i = 0; i < nodes.size(); ++i) {
+                UID uid;
+                if (i == 0) {
+                    uid = soma->getUID();
+                } else if (extraIds != soma->getExtraId().end()) {
+                    uid = *extraIds++;
+                } else {
+                    uid = nextFreeUID++;
+                }
+                int64_t parent = i == 0 ? -1 : static_cast<int64_t>(soma->getUID());
+                writePoint(out, line, uid, static_cast<uint32_t>(NeuriteType::SOMA), nodes[i].position,
+                           nodes[i].radius, parent);
+                ++written;
+            }
+        }
+
+        if (!positionProperty) {
+            if (!out) {
+                return std::string("Couldn't write the SWC data.");
+            }
+            return written;
+        }
+
+        // Sorts the neurites so each parent is written before its children.
+        std::unordered_map<UID, std::vector<UID>> children;
+        std::vector<UID> roots;
+        for (auto* neurite : morphology.getNeurites()) {
+            if (!neurite->hasProperty(positionProperty.value())) {
+                continue;
+            }
+            std::optional<UID> parent;
+            if (parentProperty) {
+                parent = neurite->getProperty<UID>(parentProperty.value());
+            }
+            if (parent && morphology.getNeurite(parent.value()).has_value()) {
+                children[parent.value()].push_back(neurite->getUID());
+            } else {
+                roots.push_back(neurite->getUID());
+            }
+        }
+
+        std::ranges::sort(roots, std::greater());
+        for (auto& list : children | std::views::values) {
+            std::ranges::sort(list, std::greater());
+        }
+
+        std::vector<UID> stack = std::move(roots);
+        while (!stack.empty()) {
+            UID uid = stack.back();
+            stack.pop_back();
+
+            auto* neurite = morphology.getNeurite(uid).value();
+            auto position = neurite->getProperty<rush::Vec3f>(positionProperty.value()).value();
+            float radius = radiusProperty ? neurite->getProperty<float>(radiusProperty.value()).value_or(0.0f) : 0.0f;
+            auto type = typeProperty ? neurite->getProperty<NeuriteType>(typeProperty.value())
+                                           .value_or(NeuriteType::UNDEFINED)
+                                     : NeuriteType::UNDEFINED;
+
+            int64_t parentId = -1;
+            if (auto parent = parentProperty ? neurite->getProperty<UID>(parentProperty.value()) : std::nullopt) {
+                if (soma != nullptr && soma->isRepresentedById(parent.value())) {
+                    parentId = soma->getUID();
+                } else if (morphology.getNeurite(parent.value()).has_value()) {
+                    parentId = parent.value();
+                }
+            }
+
+            writePoint(out, line, uid, static_cast<uint32_t>(type), position, radius, parentId);
+            ++written;
+
+            if (auto it = children.find(uid); it != children.end()) {
+                stack.insert(stack.end(), it->second.begin(), it->second.end());
+            }
+        }
+
+        if (!out) {
+            return std::string("Couldn't write the SWC data.");
+        }
+        return written;
+    }
+
+    Result<size_t, std::string> writeSWC(const Dataset& dataset, const Morphology& morphology,
+                                         const std::filesystem::path& path)
+    {
+        std::error_code error;
+        if (path.has_parent_path()) {
+            std::filesystem::create_directories(path.parent_path(), error);
+        }
+
+        std::ofstream out(path);
+        if (!out) {
+            return "Couldn't open " + path.string() + " for writing.";
+        }
+        return writeSWC(dataset, morphology, out);
+    }
+} // namespace mindset
@@ -0,0 +1,263 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <mindset/generator/SnuddaWriter.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <map>
+#include <ranges>
+#include <set>
+#include <unordered_map>
+#include <variant>
+
+#include <highfive/H5File.hpp>
+
+#include <mindset/DefaultProperties.h>
+#include <mindset/EventSequence.h>
+#include <mindset/TimeGrid.h>
+#include <mindset/generator/SWCWriter.h>
+#include <mindset/util/NeuronTransform.h>
+
+namespace
+{
+    using namespace mindset;
+
+    constexpr double MICROMETER_METER_RATIO = 1e-6;
+    constexpr double VOXEL_SIZE = 0.5e-6;
+    const std::string SNUDDA_PREFIX = "$SNUDDA_DATA";
+
+    std::vector<const Neuron*> sortedNeurons(const Dataset& dataset)
+    {
+        std::vector<const Neuron*> neurons;
+        neurons.reserve(dataset.getNeuronsAmount());
+        for (UID uid : dataset.getNeuronsUIDs()) {
+            neurons.push_back(dataset.getNeuron(uid).value());
+        }
+        std::ranges::sort(neurons, {}, [](const Neuron* neuron) { return neuron->getUID(); });
+        return neurons;
+    }
+} // namespace
+
+namespace mindset
+{
+    Result<size_t, std::string> writeSnuddaNetwork(const Dataset& dataset, const std::filesystem::path& file,
+                                                   const std::filesystem::path& snuddaData)
+    {
+        auto& properties = dataset.getProperties();
+        auto transformProperty = properties.getPropertyUID(PROPERTY_TRANSFORM);
+        auto nameProperty = properties.getPropertyUID(PROPERTY_NAME);
+        auto neurons = sortedNeurons(dataset);
+
+        std::vector<uint64_t> ids;
+        std::vector<std::array<double, 3>> positions;
+        std::vector<std::array<double, 9>> rotations;
+        std::vector<std::string> morphologyNames;
+        ids.reserve(neurons.size());
+        positions.reserve(neurons.size());
+        rotations.reserve(neurons.size());
+
+        bool allMorphologies = !neurons.empty();
+        std::unordered_map<const Morphology*, std::string> names;
+        std::map<std::string, size_t> usedNames;
+
+        for (auto* neuron : neurons) {
+            ids.push_back(neuron->getUID());
+
+            NeuronTransform transform;
+            if (transformProperty) {
+                transform = neuron->getProperty<NeuronTransform>(transformProperty.value()).value_or(transform);
+            }
+            auto& model = transform.getModel();
+            positions.push_back({model[3][0] * MICROMETER_METER_RATIO, model[3][1] * MICROMETER_METER_RATIO,
+                                 model[3][2] * MICROMETER_METER_RATIO});
+
+            // SnuddaLoader reads rotation(column, row) from array[column + row * 3].
+            std::array<double, 9> rotation{};
+            for (size_t c = 0; c < 3; ++c) {
+                for (size_t r = 0; r < 3; ++r) {
+                    rotation[c + r * 3] = model[c][r];
+                }
+            }
+            rotations.push_back(rotation);
+
+            auto& morphology = neuron->getMorphologyPtr();
+            if (morphology == nullptr) {
+                allMorphologies = false;
+                continue;
+            }
+
+            auto [it, added] = names.try_emplace(morphology.get());
+            if (added) {
+                std::string name = "morphology_" + std::to_string(names.size() - 1);
+                if (nameProperty) {
+                    name = morphology->getProperty<std::string>(nameProperty.value()).value_or(name);
+                }
+                // Different morphologies may share a name. Suffixes keep their files apart.
+                if (size_t uses = usedNames[name]++; uses > 0) {
+                    name += "_" + std::to_string(uses);
+                }
+                it->second = name;
+
+                auto result = writeSWC(dataset, *morphology, snuddaData / "morphologies" / (name + ".swc"));
+                if (!result.isOk()) {
+                    return result.getError();
+                }
+            }
+            morphologyNames.push_back(SNUDDA_PREFIX + "/morphologies/" + it->second + ".swc");
+        }
+
+        auto positionProperty = properties.getPropertyUID(PROPERTY_POSITION);
+        auto postPositionProperty = properties.getPropertyUID(PROPERTY_SYNAPSE_POST_POSITION);
+        auto postNeuriteProperty = properties.getPropertyUID(PROPERTY_SYNAPSE_POST_NEURITE);
+
+        auto synapsePosition = [&](const Synapse& synapse) {
+            std::optional<rush::Vec3f> position;
+            if (postPositionProperty) {
+                position = synapse.getProperty<rush::Vec3f>(postPositionProperty.value());
+            }
+            if (!position && positionProperty) {
+                position = synapse.getProperty<rush::Vec3f>(positionProperty.value());
+            }
+            return position.value_or(rush::Vec3f(0.0f));
+        };
+
+        std::vector<const Synapse*> synapses;
+        auto& circuit = dataset.getCircuit();
+        for (auto* synapse : circuit.getSynapses()) {
+            synapses.push_back(synapse);
+        }
+        std::ranges::sort(synapses, {}, [](const Synapse* synapse) { return synapse->getUID(); });
+
+        std::array<double, 3> origin = {0.0, 0.0, 0.0};
+        if (!synapses.empty()) {
+            origin = {std::numeric_limits<double>::max(), std::numeric_limits<double>::max(),
+                      std::numeric_limits<double>::max()};
+            for (auto* synapse : synapses) {
+                auto position = synapsePosition(*synapse);
+                for (size_t i = 0; i < 3; ++i) {
+                    origin[i] = std::min(origin[i], position[i] * MICROMETER_METER_RATIO);
+                }
+            }
+        }
+
+        std::vector<std::array<int32_t, 13>> rows;
+        rows.reserve(synapses.size());
+        for (auto* synapse : synapses) {
+            std::array<int32_t, 13> row{};
+            row[0] = static_cast<int32_t>(synapse->getPreSynapticNeuron());
+            row[1] = static_cast<int32_t>(synapse->getPostSynapticNeuron());
+            auto position = synapsePosition(*synapse);
+            for (size_t i = 0; i < 3; ++i) {
+                row[2 + i] = static_cast<int32_t>(
+                    std::lround((position[i] * MICROMETER_METER_RATIO - origin[i]) / VOXEL_SIZE));
+            }
+            // SnuddaLoader assigns the neurite destSegId + 1.
+            row[9] = -1;
+            if (postNeuriteProperty) {
+                if (auto neurite = synapse->getProperty<UID>(postNeuriteProperty.value()); neurite && neurite > 0) {
+                    row[9] = static_cast<int32_t>(neurite.value() - 1);
+                }
+            }
+            rows.push_back(row);
+        }
+
+        try {
+            HighFive::File h5(file.string(), HighFive::File::Overwrite);
+            h5.createDataSet("network/neurons/neuron_id", ids);
+            h5.createDataSet("network/neurons/position", positions);
+            h5.createDataSet("network/neurons/rotation", rotations);
+            if (allMorphologies) {
+                h5.createDataSet("network/neurons/morphology", morphologyNames);
+            }
+            if (!rows.empty()) {
+                h5.createDataSet("meta/voxel_size", VOXEL_SIZE);
+                h5.createDataSet("meta/simulation_origo", origin);
+                h5.createDataSet("network/synapses", rows);
+            }
+            h5.flush();
+        } catch (const std::exception& exception) {
+            return "Couldn't write " + file.string() + ": " + exception.what();
+        }
+
+        return neurons.size();
+    }
+
+    Result<size_t, std::string> writeSnuddaActivity(const Dataset& dataset, const Activity& activity,
+                                                    const std::filesystem::path& file)
+    {
+        auto& properties = dataset.getProperties();
+        auto spikesProperty = properties.getPropertyUID(PROPERTY_ACTIVITY_SPIKES);
+        auto voltageProperty = properties.getPropertyUID(PROPERTY_ACTIVITY_VOLTAGE);
+
+        std::map<UID, std::vector<double>> spikes;
+        if (spikesProperty) {
+            if (auto sequence = activity.getPropertyPtr<EventSequence<std::monostate>>(spikesProperty.value())) {
+                for (auto& event : sequence.value()->getEvents()) {
+                    spikes[event.uid].push_back(std::chrono::duration<double>(event.timepoint).count());
+                }
+            }
+        }
+
+        const TimeGrid<double>* voltage = nullptr;
+        if (voltageProperty) {
+            voltage = activity.getPropertyPtr<TimeGrid<double>>(voltageProperty.value()).value_or(nullptr);
+        }
+
+        std::map<UID, size_t> voltageIndices;
+        if (voltage != nullptr) {
+            auto& uids = voltage->getUIDIndices();
+            for (size_t i = 0; i < uids.size(); ++i) {
+                voltageIndices.emplace(uids[i], i);
+            }
+        }
+
+        std::set<UID> neurons;
+        for (auto& uid : spikes | std::views::keys) {
+            neurons.insert(uid);
+        }
+        for (auto& uid : voltageIndices | std::views::keys) {
+            neurons.insert(uid);
+        }
+
+        try {
+            HighFive::File h5(file.string(), HighFive::File::Overwrite);
+            std::vector<double> trace;
+            for (UID uid : neurons) {
+                std::string group = "neurons/" + std::to_string(uid);
+                if (auto it = spikes.find(uid); it != spikes.end()) {
+                    h5.createDataSet(group + "/spikes", it->second);
+                }
+                if (auto it = voltageIndices.find(uid); it != voltageIndices.end()) {
+                    trace.clear();
+                    for (auto& timestep : voltage->getData()) {
+                        trace.push_back(timestep[it->second]);
+                    }
+                    h5.createDataSet(group + "/voltage", trace);
+                }
+            }
+            h5.flush();
+        } catch (const std::exception& exception) {
+            return "Couldn't write " + file.string() + ": " + exception.what();
+        }
+
+        return neurons.size();
+    }
+} // namespace mindset
@@ -22,7 +22,10 @@
     #include <mindset/util/MorphologyUtils.h>
     #include <mindset/util/NeuronTransform.h>
     #include <mindset/loader/BlueConfigLoader.h>
+    #include <mindset/loader/LoaderProgress.h>
     #include <mindset/DefaultProperties.h>
+    #include <mindset/util/Trace.h>
+    #include <mindset/util/MemoryTracker.h>
 
     #include <brain/brain.h>
     #include <rush/rush.h>
@@ -46,17 +49,15 @@ namespace
         }
     }
 
-    std::optional<RequiredSynapsePositionData> getNeuriteAndChild(const mindset::Dataset& dataset,
+    std::optional<RequiredSynapsePositionData> getNeuriteAndChild(const mindset::Neuron* neuron,
                                                                   const mindset::BlueConfigLoaderProperties& properties,
-                                                                  mindset::UID neuronId, mindset::UID sectionId,
-                                                                  size_t index)
+                                                                  mindset::UID sectionId, size_t index)
     {
-        auto neuron = dataset.getNeuron(neuronId);
-        if (!neuron) {
+        if (neuron == nullptr) {
             return {};
         }
 
-        auto morphology = getMorphology(dataset, neuronId);
+        auto morphology = neuron->getMorphology();
 
         if (!morphology) {
             return {};
@@ -67,7 +68,7 @@ namespace
             return {};
         }
 
-        auto transform = neuron.value()->getProperty<mindset::NeuronTransform>(properties.neuronTransform);
+        auto transform = neuron->getProperty<mindset::NeuronTransform>(properties.neuronTransform);
 
         auto neurites = section.value()->getNeurites();
         if (neurites.size() - 1 < index) {
@@ -160,43 +161,41 @@ namespace mindset
         return result;
     }
 
-    void BlueConfigLoader::loadNeurons(Dataset& dataset, const BlueConfigLoaderProperties& properties,
-                                       const brion::GIDSet& ids, const brain::Circuit& circuit,
-                                       const std::map<std::string, std::shared_ptr<Morphology>>& morphologies)
+    std::vector<Neuron> BlueConfigLoader::loadNeurons(
+        const BlueConfigLoaderProperties& properties, const brion::GIDSet& ids, const brain::Circuit& circuit,
+        const std::map<std::string, std::shared_ptr<Morphology>>& morphologies,
+        const Dataset::allocator_type& allocator)
     {
+        MINDSET_TRACE_SCOPE("BlueConfigLoader::loadNeurons");
         auto transforms = circuit.getTransforms(ids);
         auto layers = circuit.getLayers(ids);
         auto uris = circuit.getMorphologyURIs(ids);
 
+        std::vector<Neuron> neurons;
+        neurons.reserve(ids.size());
+
         size_t index = 0;
-        auto lock = dataset.writeLock();
         for (UID id : ids) {
             UID layer = std::stoi(layers[index]);
-            if (auto presentNeuron = dataset.getNeuron(id)) {
-                auto neuronLock = presentNeuron.value()->writeLock();
-                presentNeuron.value()->setProperty(properties.neuronTransform, NeuronTransform(transforms[index]));
-                presentNeuron.value()->setProperty(properties.neuronLayer, layer);
-
-                if (auto morphology = morphologies.find(uris[index].getPath()); morphology != morphologies.end()) {
-                    presentNeuron.value()->setMorphology(morphology->second);
-                }
-            } else {
-                auto neuron = Neuron(id);
-                neuron.setProperty(properties.neuronTransform, NeuronTransform(transforms[index]));
-                neuron.setProperty(properties.neuronLayer, layer);
+            auto neuron = Neuron(id, nullptr, allocator);
+            neuron.setProperty(properties.neuronTransform, NeuronTransform(transforms[index]));
+            neuron.setProperty(properties.neuronLayer, layer);
 
-                if (auto morphology = morphologies.find(uris[index].getPath()); morphology != morphologies.end()) {
-                    neuron.setMorphology(morphology->second);
-                }
-                dataset.addNeuron(std::move(neuron));
+            if (auto morphology = morphologies.find(uris[index].getPath()); morphology != morphologies.end()) {
+                neuron.setMorphology(morphology->second);
             }
+            neurons.push_back(std::move(neuron));
             ++index;
         }
+
+        return neurons;
     }
 
     std::map<std::string, std::shared_ptr<Morphology>> BlueConfigLoader::loadMorphologies(
-        const BlueConfigLoaderProperties& properties, const brion::GIDSet& ids, const brain::Circuit& circuit)
+        const BlueConfigLoaderProperties& properties, const brion::GIDSet& ids, const brain::Circuit& circuit,
+        LoaderProgress& progress)
     {
+        MINDSET_TRACE_SCOPE("BlueConfigLoader::loadMorphologies");
         auto uris = circuit.getMorphologyURIs(ids);
         auto transforms = circuit.getTransforms(ids);
         auto layers = circuit.getLayers(ids);
@@ -209,33 +208,78 @@ namespace mindset
 
         std::map<std::string, std::shared_ptr<Morphology>> morphologies;
         for (auto& [file, uri] : files) {
+            if (progress.checkCancelled()) {
+                return {};
+            }
             morphologies[file] = loadMorphology(properties, brion::Morphology(uri));
+            progress.addProgress(1);
         }
 
         return morphologies;
     }
 
-    void BlueConfigLoader::loadSynapses(Dataset& dataset, const BlueConfigLoaderProperties& properties,
-                                        const brion::GIDSet& ids, const brain::Circuit& circuit)
+    std::vector<Synapse> BlueConfigLoader::loadSynapses(const std::vector<Neuron>& neurons,
+                                                        const BlueConfigLoaderProperties& properties,
+                                                        const brion::GIDSet& ids, const brain::Circuit& circuit,
+                                                        const Dataset& dataset, LoaderProgress& progress)
     {
+        MINDSET_TRACE_SCOPE("BlueConfigLoader::loadSynapses");
+        constexpr size_t CANCELLATION_CHECK_INTERVAL = 4096;
+
         auto brainSynapses = circuit.getAfferentSynapses(ids, brain::SynapsePrefetch::attributes);
         auto future = brainSynapses.read(brainSynapses.getRemaining());
         auto synapses = future.get();
 
-        auto& outCircuit = dataset.getCircuit();
+        if (progress.checkCancelled()) {
+            return {};
+        }
+
+        // The loaded neurons are not in the dataset yet, but the other end of a synapse may already be there.
+        // The candidate with a morphology is preferred, so reloads without morphologies keep the neurites.
+        std::unordered_map<UID, const Neuron*> neuronsByUID;
+        neuronsByUID.reserve(neurons.size());
+        for (auto& neuron : neurons) {
+            neuronsByUID.emplace(neuron.getUID(), &neuron);
+        }
+        auto findNeuron = [&](UID uid) -> const Neuron* {
+            const Neuron* loaded = nullptr;
+            if (auto found = neuronsByUID.find(uid); found != neuronsByUID.end()) {
+                loaded = found->second;
+                if (loaded->getMorphology().has_value()) {
+                    return loaded;
+                }
+            }
+            const Neuron* present = dataset.getNeuron(uid).value_or(nullptr);
+            if (present != nullptr && (loaded == nullptr || present->getMorphology().has_value())) {
+                return present;
+            }
+            return loaded;
+        };
+        auto allocator = dataset.getAllocator();
+        auto datasetLock = dataset.readLock();
+
+        std::vector<Synapse> results;
+        results.reserve(synapses.size());
 
         UID uidGenerator = 0;
 
         bool usePositions = hasPositions(synapses);
 
         for (auto synapse : synapses) {
-            Synapse result(uidGenerator++, synapse.getPresynapticGID(), synapse.getPostsynapticGID());
+            if (uidGenerator % CANCELLATION_CHECK_INTERVAL == 0 && uidGenerator > 0) {
+                if (progress.checkCancelled()) {
+                    return {};
+                }
+                progress.addProgress(CANCELLATION_CHECK_INTERVAL);
+            }
+
+            Synapse result(uidGenerator++, synapse.getPresynapticGID(), synapse.getPostsynapticGID(), allocator);
 
-            auto preNeurites = getNeuriteAndChild(dataset, properties, synapse.getPresynapticGID(),
+            auto preNeurites = getNeuriteAndChild(findNeuron(synapse.getPresynapticGID()), properties,
                                                   synapse.getPresynapticSectionID(), synapse.getPresynapticSegmentID());
 
             auto postNeurites =
-                getNeuriteAndChild(dataset, properties, synapse.getPostsynapticGID(),
+                getNeuriteAndChild(findNeuron(synapse.getPostsynapticGID()), properties,
                                    synapse.getPostsynapticSectionID(), synapse.getPostsynapticSegmentID());
 
             if (preNeurites) {
@@ -291,43 +335,91 @@ namespace mindset
             result.setProperty(properties.synapseDecay, synapse.getDecay());
             result.setProperty(properties.synapseEfficacy, synapse.getEfficacy());
 
-            auto lock = outCircuit.writeLock();
-            outCircuit.addSynapse(std::move(result));
+            results.push_back(std::move(result));
         }
+
+        return results;
     }
 
-    void BlueConfigLoader::loadHierarchy(Dataset& dataset, const BlueConfigLoaderProperties& properties,
-                                         const brion::GIDSet& ids, const brion::Circuit& circuit)
+    std::vector<BlueConfigLoader::HierarchyEntry> BlueConfigLoader::loadHierarchy(
+        std::vector<Neuron>& neurons, const BlueConfigLoaderProperties& properties, const brion::GIDSet& ids,
+        const brion::Circuit& circuit)
     {
+        MINDSET_TRACE_SCOPE("BlueConfigLoader::loadHierarchy");
         auto data = circuit.get(ids, brion::NEURON_COLUMN_GID | brion::NEURON_MINICOLUMN_GID);
 
-        Node* root = dataset.getHierarchy().value_or(nullptr);
-        if (root == nullptr) {
-            root = dataset.createHierarchy(0, "mindset:root");
-        }
+        std::vector<HierarchyEntry> entries;
+        entries.reserve(ids.size());
 
+        // Neurons are generated in the same order as the GIDSet.
         size_t index = 0;
         for (UID id : ids) {
-            if (auto neuron = dataset.getNeuron(id); neuron.has_value()) {
-                auto sub = data[index];
+            auto sub = data[index];
 
-                UID column = boost::lexical_cast<UID>(sub[0]);
-                UID miniColumn = boost::lexical_cast<UID>(sub[1]);
+            UID column = boost::lexical_cast<UID>(sub[0]);
+            UID miniColumn = boost::lexical_cast<UID>(sub[1]);
 
-                if (auto columnResult = root->getOrCreateNode(column, "mindset:column"); columnResult.isOk()) {
-                    if (auto miniColumnResult =
-                            columnResult.getResult()->getOrCreateNode(miniColumn, "mindset:mini_column");
-                        miniColumnResult.isOk()) {
-                        miniColumnResult.getResult()->addNeuron(id);
-                    }
-                }
+            entries.push_back({id, column, miniColumn});
 
-                auto lock = neuron.value()->writeLock();
-                neuron.value()->setProperty(properties.neuronColumn, column);
-                neuron.value()->setProperty(properties.neuronMiniColumn, miniColumn);
+            if (index < neurons.size()) {
+                neurons[index].setProperty(properties.neuronColumn, column);
+                neurons[index].setProperty(properties.neuronMiniColumn, miniColumn);
             }
             ++index;
         }
+
+        return entries;
+    }
+
+    void BlueConfigLoader::commit(Dataset& dataset, std::vector<Neuron> neurons, std::vector<Synapse> synapses,
+                                  const std::vector<HierarchyEntry>& hierarchy)
+    {
+        MINDSET_TRACE_SCOPE("BlueConfigLoader::commit");
+        std::unique_lock<std::shared_mutex> lock;
+        {
+            MINDSET_TRACE_SCOPE("BlueConfigLoader::commit: waiting for the dataset lock");
+            lock = dataset.writeLock();
+        }
+
+        for (auto& neuron : neurons) {
+            auto presentNeuron = dataset.getNeuron(neuron.getUID());
+            if (!presentNeuron.has_value()) {
+                dataset.addNeuron(std::move(neuron));
+                continue;
+            }
+
+            auto neuronLock = presentNeuron.value()->writeLock();
+            for (auto& [uid, value] : neuron.getProperties()) {
+                presentNeuron.value()->setProperty(uid, value);
+            }
+            if (auto& morphology = neuron.getMorphologyPtr()) {
+                presentNeuron.value()->setMorphology(morphology);
+            }
+        }
+
+        if (!synapses.empty()) {
+            auto& circuit = dataset.getCircuit();
+            auto circuitLock = circuit.writeLock();
+            circuit.addSynapses(std::move(synapses));
+        }
+
+        if (hierarchy.empty()) {
+            return;
+        }
+
+        Node* root = dataset.getHierarchy().value_or(nullptr);
+        if (root == nullptr) {
+            root = dataset.createHierarchy(0, "mindset:root");
+        }
+
+        for (auto& [id, column, miniColumn] : hierarchy) {
+            if (auto columnResult = root->getOrCreateNode(column, "mindset:column"); columnResult.isOk()) {
+                if (auto miniColumnResult = columnResult.getResult()->getOrCreateNode(miniColumn, "mindset:mini_column");
+                    miniColumnResult.isOk()) {
+                    miniColumnResult.getResult()->addNeuron(id);
+                }
+            }
+        }
     }
 
     std::shared_ptr<Morphology> BlueConfigLoader::loadMorphology(const BlueConfigLoaderProperties& properties,
@@ -407,7 +499,10 @@ namespace mindset
 
     void BlueConfigLoader::load(Dataset& dataset) const
     {
-        constexpr size_t STAGES = 5;
+        MINDSET_TRACE_SCOPE("BlueConfigLoader::load");
+        AllocationScope allocationScope("BlueConfigLoader");
+        constexpr size_t STAGES = 7;
+        LoaderProgress progress(*this, STAGES);
 
         bool shouldLoadMorphologies = getEnvironmentEntryOr(BLUE_CONFIG_LOADER_ENTRY_LOAD_MORPHOLOGY, false);
         bool shouldLoadSynapses = getEnvironmentEntryOr(BLUE_CONFIG_LOADER_ENTRY_LOAD_SYNAPSES, false);
@@ -415,26 +510,33 @@ namespace mindset
 
         auto targets = getEnvironmentEntry<std::vector<std::string>>(BLUE_CONFIG_LOADER_ENTRY_TARGETS);
         if (!targets.has_value() || targets.value()->empty()) {
-            invoke({LoaderStatusType::LOADING_ERROR, "No targets found", STAGES, 0});
+            progress.reportError("No targets found");
+            return;
         }
 
-        invoke({LoaderStatusType::LOADING, "Loading targets", STAGES, 0});
+        progress.startStage(0, "Loading targets", targets.value()->size());
 
         brion::GIDSet ids;
         for (auto& target : *targets.value()) {
+            if (progress.checkCancelled()) {
+                return;
+            }
             brion::GIDSet targetSet = _blueConfig.parseTarget(target);
             ids.insert(targetSet.begin(), targetSet.end());
+            progress.addProgress(1);
         }
         if (ids.empty()) {
-            invoke({LoaderStatusType::LOADING_ERROR, "No neurons found", STAGES, 0});
+            progress.reportError("No neurons found");
             return;
         }
 
-        invoke({LoaderStatusType::LOADING, "Defining properties", STAGES, 1});
+        progress.startStage(1, "Defining properties");
 
         auto properties = initProperties(dataset, shouldLoadMorphologies, shouldLoadSynapses, shouldLoadHierarchy);
 
-        invoke({LoaderStatusType::LOADING, "Loading global neuron data", STAGES, 2});
+        std::vector<Neuron> neurons;
+        std::vector<Synapse> synapses;
+        std::vector<HierarchyEntry> hierarchy;
 
         {
             auto circuit = brain::Circuit(_blueConfig);
@@ -442,24 +544,41 @@ namespace mindset
             std::map<std::string, std::shared_ptr<Morphology>> morphologies;
 
             if (shouldLoadMorphologies) {
-                invoke({LoaderStatusType::LOADING, "Loading morphologies", STAGES, 3});
-                morphologies = loadMorphologies(properties, ids, circuit);
+                progress.startStage(2, "Loading morphologies");
+                morphologies = loadMorphologies(properties, ids, circuit, progress);
+                if (progress.checkCancelled()) {
+                    return;
+                }
             }
 
-            loadNeurons(dataset, properties, ids, circuit, morphologies);
+            progress.startStage(3, "Loading global neuron data", ids.size());
+            neurons = loadNeurons(properties, ids, circuit, morphologies, dataset.getAllocator());
+            if (progress.checkCancelled()) {
+                return;
+            }
 
             if (shouldLoadSynapses) {
-                loadSynapses(dataset, properties, ids, circuit);
+                progress.startStage(4, "Loading synapses");
+                synapses = loadSynapses(neurons, properties, ids, circuit, dataset, progress);
+                if (progress.checkCancelled()) {
+                    return;
+                }
             }
         }
 
         if (shouldLoadHierarchy) {
-            invoke({LoaderStatusType::LOADING, "Loading hierarchy", STAGES, 4});
+            progress.startStage(5, "Loading hierarchy", ids.size());
             auto circuit = brion::Circuit(_blueConfig.getCircuitSource());
-            loadHierarchy(dataset, properties, ids, circuit);
+            hierarchy = loadHierarchy(neurons, properties, ids, circuit);
+            if (progress.checkCancelled()) {
+                return;
+            }
         }
 
-        invoke({LoaderStatusType::DONE, "Done", STAGES, 5});
+        progress.startStage(6, "Committing data");
+        commit(dataset, std::move(neurons), std::move(synapses), hierarchy);
+
+        progress.reportDone();
     }
 
     LoaderFactory BlueConfigLoader::createFactory()
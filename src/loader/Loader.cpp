@@ -19,6 +19,7 @@
 
 #include <mindset/loader/Loader.h>
 
+#include <mutex>
 #include <utility>
 
 namespace mindset
@@ -51,6 +52,38 @@ namespace mindset
         return {};
     }
 
+    std::future<LoaderStatus> Loader::loadAsync(Dataset& dataset, std::stop_token stopToken)
+    {
+        _stopToken = std::move(stopToken);
+        return std::async(std::launch::async, [this, &dataset] {
+            // Progress may be reported concurrently from the loader's worker threads.
+            std::mutex mutex;
+            LoaderStatus last;
+            auto listener = createListener([&](const LoaderStatus& status) {
+                std::lock_guard lock(mutex);
+                last = status;
+            });
+            load(dataset);
+            std::lock_guard lock(mutex);
+            return last;
+        });
+    }
+
+    void Loader::setStopToken(std::stop_token stopToken)
+    {
+        _stopToken = std::move(stopToken);
+    }
+
+    const std::stop_token& Loader::getStopToken() const
+    {
+        return _stopToken;
+    }
+
+    bool Loader::isCancelled() const
+    {
+        return _stopToken.stop_requested();
+    }
+
     void Loader::addUIDProvider(std::function<UID()>)
     {
     }
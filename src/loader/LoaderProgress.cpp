@@ -0,0 +1,185 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <mindset/loader/LoaderProgress.h>
+
+#include <mindset/loader/Loader.h>
+#include <mindset/util/Trace.h>
+
+namespace mindset
+{
+    LoaderStatus LoaderProgress::buildStatus(LoaderStatusType type) const
+    {
+        size_t items = _items.load(std::memory_order_relaxed);
+        size_t bytes = _bytes.load(std::memory_order_relaxed);
+        double seconds = std::chrono::duration<double>(Clock::now() - _stageStart).count();
+
+        LoaderStatus status;
+        status.status = type;
+        status.currentTask = _task;
+        status.stages = _stages;
+        status.stagesCompleted = _stage;
+        status.itemsProcessed = items;
+        status.itemsTotal = _itemsTotal;
+        status.bytesProcessed = bytes;
+        if (seconds > 0.0) {
+            status.itemsPerSecond = static_cast<double>(items) / seconds;
+            status.bytesPerSecond = static_cast<double>(bytes) / seconds;
+        }
+        return status;
+    }
+
+    void LoaderProgress::finishStage()
+    {
+        if (!_stageRunning) {
+            return;
+        }
+        _stageRunning = false;
+
+        LoaderStageTiming timing;
+        timing.task = _task;
+        timing.seconds = std::chrono::duration<double>(Clock::now() - _stageStart).count();
+        timing.items = _items.load(std::memory_order_relaxed);
+        timing.bytes = _bytes.load(std::memory_order_relaxed);
+
+        auto& tracer = Tracer::getInstance();
+        if (tracer.isEnabled()) {
+            tracer.recordScope("Loader stage: " + _task, _stageStart);
+        }
+
+        _timings.push_back(std::move(timing));
+    }
+
+    LoaderStatus LoaderProgress::buildFinalStatus(LoaderStatusType type, std::string task)
+    {
+        finishStage();
+        LoaderStatus status = buildStatus(type);
+        status.currentTask = std::move(task);
+        status.stageTimings = _timings;
+        return status;
+    }
+
+    void LoaderProgress::notify(const LoaderStatus& status) const
+    {
+        MINDSET_TRACE_SCOPE("LoaderProgress::notify");
+        _loader->invoke(status);
+    }
+
+    void LoaderProgress::notifyFinal(LoaderStatusType type, std::string task)
+    {
+        if (_finished.exchange(true)) {
+            return;
+        }
+        notify(buildFinalStatus(type, std::move(task)));
+    }
+
+    LoaderProgress::LoaderProgress(const Loader& loader, size_t stages) :
+        _loader(&loader),
+        _stages(stages),
+        _stage(0),
+        _itemsTotal(0),
+        _items(0),
+        _bytes(0),
+        _cancelled(false),
+        _finished(false),
+        _stageStart(Clock::now()),
+        _lastReport(_stageStart),
+        _stageRunning(false)
+    {
+    }
+
+    void LoaderProgress::startStage(size_t stage, std::string task, size_t itemsTotal)
+    {
+        std::lock_guard lock(_mutex);
+        if (_finished) {
+            return;
+        }
+        finishStage();
+        _stage = stage;
+        _task = std::move(task);
+        _itemsTotal = itemsTotal;
+        _items = 0;
+        _bytes = 0;
+        _stageStart = Clock::now();
+        _lastReport = _stageStart;
+        _stageRunning = true;
+        notify(buildStatus(LoaderStatusType::LOADING));
+    }
+
+    void LoaderProgress::addProgress(size_t items, size_t bytes)
+    {
+        _items.fetch_add(items, std::memory_order_relaxed);
+        _bytes.fetch_add(bytes, std::memory_order_relaxed);
+        if (_finished.load(std::memory_order_relaxed)) {
+            return;
+        }
+
+        std::unique_lock lock(_mutex, std::try_to_lock);
+        if (!lock.owns_lock()) {
+            return; // Another thread is reporting.
+        }
+        auto now = Clock::now();
+        if (_finished || now - _lastReport < REPORT_INTERVAL) {
+            return;
+        }
+        _lastReport = now;
+        // Sent while holding the mutex, so it cannot reach the listeners after a final status.
+        notify(buildStatus(LoaderStatusType::LOADING));
+    }
+
+    bool LoaderProgress::checkCancelled()
+    {
+        if (!_loader->isCancelled()) {
+            return false;
+        }
+        if (!_cancelled.exchange(true)) {
+            std::lock_guard lock(_mutex);
+            notifyFinal(LoaderStatusType::CANCELLED, "Cancelled");
+        }
+        return true;
+    }
+
+    void LoaderProgress::reportError(const std::string& message)
+    {
+        std::lock_guard lock(_mutex);
+        notifyFinal(LoaderStatusType::LOADING_ERROR, message);
+    }
+
+    void LoaderProgress::reportDone()
+    {
+        std::lock_guard lock(_mutex);
+        if (!_finished) {
+            finishStage();
+            _stage = _stages;
+        }
+        notifyFinal(LoaderStatusType::DONE, "Done");
+    }
+
+    LoaderStatus LoaderProgress::getStatus()
+    {
+        std::lock_guard lock(_mutex);
+        return buildStatus(LoaderStatusType::LOADING);
+    }
+
+    std::vector<LoaderStageTiming> LoaderProgress::getStageTimings()
+    {
+        std::lock_guard lock(_mutex);
+        return _timings;
+    }
+} // namespace mindset
@@ -21,6 +21,7 @@
 #include <mindset/loader/LoaderRegistry.h>
 #include <mindset/loader/MorphoIOLoader.h>
 #include <mindset/loader/SnuddaLoader.h>
+#include <mindset/loader/SWCBatchLoader.h>
 #include <mindset/loader/SWCLoader.h>
 #include <mindset/loader/XMLLoader.h>
 
@@ -34,6 +35,7 @@ namespace mindset
             add(MorphoIOLoader::createFactory());
 #endif
             add(SWCLoader::createFactory());
+            add(SWCBatchLoader::createFactory());
             add(XMLLoader::createFactory());
             add(SnuddaLoader::createFactory());
         }
@@ -20,7 +20,9 @@
 #ifdef MINDSET_BRION
 
     #include <mindset/loader/MorphoIOLoader.h>
+    #include <mindset/loader/LoaderProgress.h>
     #include <mindset/DefaultProperties.h>
+    #include <mindset/util/MemoryTracker.h>
 
     #include <brain/neuron/morphology.h>
     #include <brain/circuit.h>
@@ -41,14 +43,20 @@ namespace mindset
 
     void MorphoIOLoader::load(Dataset& dataset) const
     {
+        AllocationScope allocationScope("MorphoIOLoader");
         constexpr size_t STAGES = 5;
-        invoke({LoaderStatusType::LOADING, "Loading morphology", STAGES, 0});
+        LoaderProgress progress(*this, STAGES);
+        progress.startStage(0, "Loading morphology");
         brain::neuron::Morphology morphology(brion::URI(absolute(_path).string()));
         auto& points = morphology.getPoints();
         auto& sections = morphology.getSections();
         auto& types = morphology.getSectionTypes();
 
-        invoke({LoaderStatusType::LOADING, "Defining properties", STAGES, 1});
+        if (progress.checkCancelled()) {
+            return;
+        }
+
+        progress.startStage(1, "Defining properties");
 
         auto& properties = dataset.getProperties();
         auto propLock = dataset.writeLock();
@@ -58,7 +66,7 @@ namespace mindset
         auto propType = properties.defineProperty(PROPERTY_NEURITE_TYPE);
         propLock.unlock();
 
-        invoke({LoaderStatusType::LOADING, "Parsing neurites", STAGES, 2});
+        progress.startStage(2, "Parsing neurites", sections.size());
 
         auto result = std::make_shared<Morphology>();
 
@@ -67,6 +75,11 @@ namespace mindset
 
         size_t idGenerator = 0;
         for (size_t i = 0; i < sections.size(); ++i) {
+            if (progress.checkCancelled()) {
+                return;
+            }
+            progress.addProgress(1);
+
             int fatherSectionId = sections[i].y;
             auto sectionType = static_cast<NeuriteType>(types[i]);
 
@@ -102,7 +115,7 @@ namespace mindset
             }
         }
 
-        invoke({LoaderStatusType::LOADING, "Creating neuron", STAGES, 4});
+        progress.startStage(4, "Creating neuron");
 
         {
             UID uid = _provider == nullptr ? 0 : _provider();
@@ -111,10 +124,10 @@ namespace mindset
                 auto neuronLock = neuron.value()->writeLock();
                 neuron.value()->setMorphology(std::move(result));
             } else {
-                dataset.addNeuron(Neuron(uid, std::move(result)));
+                dataset.addNeuron(Neuron(uid, std::move(result), dataset.getAllocator()));
             }
         }
-        invoke({LoaderStatusType::DONE, "Done", STAGES, 5});
+        progress.reportDone();
     }
 
     LoaderFactory MorphoIOLoader::createFactory()
@@ -0,0 +1,322 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <mindset/loader/SWCBatchLoader.h>
+
+#include <algorithm>
+#include <charconv>
+#include <iostream>
+#include <unordered_set>
+
+#include <mindset/loader/LoaderProgress.h>
+#include <mindset/loader/SWCLoader.h>
+#include <mindset/util/Parallel.h>
+#include <mindset/util/Trace.h>
+#include <mindset/util/MemoryTracker.h>
+
+namespace
+{
+    bool isSWC(const std::filesystem::path& path)
+    {
+        return path.extension() == ".swc";
+    }
+
+    template<typename Iterator>
+    void collectSWCFiles(Iterator iterator, std::vector<std::filesystem::path>& out)
+    {
+        std::error_code error;
+        for (const auto& entry : iterator) {
+            if (entry.is_regular_file(error) && isSWC(entry.path())) {
+                out.push_back(entry.path());
+            }
+        }
+    }
+} // namespace
+
+namespace mindset
+{
+    SWCBatchLoader::SWCBatchLoader(const LoaderCreateInfo& info, std::vector<std::filesystem::path> paths) :
+        Loader(info),
+        _paths(std::move(paths))
+    {
+        std::ranges::sort(_paths);
+    }
+
+    SWCBatchLoader::SWCBatchLoader(const LoaderCreateInfo& info, const std::filesystem::path& path) :
+        Loader(info)
+    {
+        std::error_code error;
+        bool recursive = getEnvironmentEntryOr(SWC_BATCH_LOADER_ENTRY_RECURSIVE, false);
+
+        if (std::filesystem::is_directory(path, error)) {
+            auto options = std::filesystem::directory_options::skip_permission_denied;
+            if (recursive) {
+                collectSWCFiles(std::filesystem::recursive_directory_iterator(path, options, error), _paths);
+            } else {
+                collectSWCFiles(std::filesystem::directory_iterator(path, options, error), _paths);
+            }
+        } else if (isGlobPattern(path.filename().string())) {
+            auto directory = path.has_parent_path() ? path.parent_path() : std::filesystem::path(".");
+            auto pattern = path.filename().string();
+            for (const auto& entry : std::filesystem::directory_iterator(directory, error)) {
+                if (entry.is_regular_file(error) && matchesGlob(entry.path().filename().string(), pattern)) {
+                    _paths.push_back(entry.path());
+                }
+            }
+        } else {
+            _paths.push_back(path);
+        }
+
+        std::ranges::sort(_paths);
+    }
+
+    SWCBatchLoader::SWCBatchLoader(const LoaderCreateInfo& info, const std::vector<std::string>& lines) :
+        Loader(info)
+    {
+        _paths.reserve(lines.size());
+        for (const auto& line : lines) {
+            if (!line.empty() && !line.starts_with("#")) {
+                _paths.emplace_back(line);
+            }
+        }
+        std::ranges::sort(_paths);
+    }
+
+    const std::vector<std::filesystem::path>& SWCBatchLoader::getPaths() const
+    {
+        return _paths;
+    }
+
+    void SWCBatchLoader::addUIDProvider(std::function<UID()> provider)
+    {
+        _provider = std::move(provider);
+    }
+
+    void SWCBatchLoader::setUIDMapping(SWCBatchUIDMapping mapping)
+    {
+        _mapping = std::move(mapping);
+    }
+
+    void SWCBatchLoader::load(Dataset& dataset) const
+    {
+        MINDSET_TRACE_SCOPE("SWCBatchLoader::load");
+        AllocationScope allocationScope("SWCBatchLoader");
+        constexpr size_t STAGES = 3;
+        LoaderProgress progress(*this, STAGES);
+
+        progress.startStage(0, "Defining properties");
+        auto properties = SWCLoader::initProperties(dataset);
+
+        progress.startStage(1, "Parsing SWC files", _paths.size());
+
+        auto& provider = getFileProvider();
+        size_t threads = getEnvironmentEntryOr(SWC_BATCH_LOADER_ENTRY_THREADS, static_cast<size_t>(0));
+
+        std::vector<std::shared_ptr<Morphology>> morphologies(_paths.size());
+        std::vector<std::string> errors(_paths.size());
+
+        parallelFor(
+            _paths.size(),
+            [&](size_t i) {
+                if (progress.checkCancelled()) {
+                    return;
+                }
+
+                auto& path = _paths[i];
+                std::optional<SWCLoader> loader;
+                size_t bytes = 0;
+
+                if (provider) {
+                    auto lines = provider(path);
+                    if (!lines.has_value()) {
+                        errors[i] = "File not found.";
+                        progress.addProgress(1);
+                        return;
+                    }
+                    for (auto& line : lines.value()) {
+                        bytes += line.size() + 1;
+                    }
+                    loader.emplace(LoaderCreateInfo(), std::move(lines.value()));
+                } else {
+                    std::error_code error;
+                    bytes = std::filesystem::file_size(path, error);
+                    if (error) {
+                        errors[i] = error.message();
+                        progress.addProgress(1);
+                        return;
+                    }
+                    loader.emplace(LoaderCreateInfo(), path);
+                }
+
+                loader->setStopToken(getStopToken());
+                auto result = loader->loadMorphology(properties);
+                if (result.isOk()) {
+                    morphologies[i] = std::move(result.getResult());
+                } else {
+                    errors[i] = std::move(result).getError();
+                }
+                progress.addProgress(1, bytes);
+            },
+            threads);
+
+        if (progress.checkCancelled()) {
+            return;
+        }
+
+        for (size_t i = 0; i < _paths.size(); ++i) {
+            if (!errors[i].empty()) {
+                std::cerr << "Error loading SWC file '" << _paths[i].string() << "': " << errors[i] << std::endl;
+            }
+        }
+
+        progress.startStage(2, "Committing neurons", _paths.size());
+
+        bool useFilenames = getEnvironmentEntryOr(SWC_BATCH_LOADER_ENTRY_UID_FROM_FILENAME, true);
+
+        std::unique_lock<std::shared_mutex> lock;
+        {
+            MINDSET_TRACE_SCOPE("SWCBatchLoader::load: waiting for the dataset lock");
+            lock = dataset.writeLock();
+        }
+
+        std::vector<Neuron> neurons;
+        neurons.reserve(_paths.size());
+        std::unordered_set<UID> used;
+        used.reserve(_paths.size());
+
+        UID nextFree = dataset.findSmallestAvailableNeuronUID();
+        auto findFreeUID = [&] {
+            while (used.contains(nextFree) || dataset.getNeuron(nextFree).has_value()) {
+                ++nextFree;
+            }
+            return nextFree;
+        };
+
+        for (size_t i = 0; i < _paths.size(); ++i) {
+            if (morphologies[i] == nullptr) {
+                continue;
+            }
+
+            std::optional<UID> uid;
+            if (_provider != nullptr) {
+                uid = _provider();
+            } else if (_mapping != nullptr) {
+                uid = _mapping(_paths[i]);
+            } else if (useFilenames) {
+                uid = uidFromFilename(_paths[i]);
+            }
+
+            if (!uid.has_value() || used.contains(uid.value())) {
+                uid = findFreeUID();
+            }
+            used.insert(uid.value());
+
+            if (auto neuron = dataset.getNeuron(uid.value())) {
+                auto neuronLock = neuron.value()->writeLock();
+                neuron.value()->setMorphology(std::move(morphologies[i]));
+            } else {
+                neurons.emplace_back(uid.value(), std::move(morphologies[i]), dataset.getAllocator());
+            }
+        }
+
+        dataset.addNeurons(std::move(neurons));
+        lock.unlock();
+
+        progress.reportDone();
+    }
+
+    std::optional<UID> SWCBatchLoader::uidFromFilename(const std::filesystem::path& path)
+    {
+        auto stem = path.stem().string();
+        UID uid;
+        auto [ptr, ec] = std::from_chars(stem.data(), stem.data() + stem.size(), uid);
+        if (ec != std::errc() || ptr != stem.data() + stem.size()) {
+            return {};
+        }
+        return uid;
+    }
+
+    bool SWCBatchLoader::isGlobPattern(const std::string& pattern)
+    {
+        return pattern.find_first_of("*?") != std::string::npos;
+    }
+
+    bool SWCBatchLoader::matchesGlob(std::string_view name, std::string_view pattern)
+    {
+        // Iterative wildcard matching with backtracking to the last '*'.
+        size_t n = 0, p = 0;
+        size_t starPattern = std::string_view::npos, starName = 0;
+        while (n < name.size()) {
+            if (p < pattern.size() && (pattern[p] == '?' || pattern[p] == name[n])) {
+                ++n;
+                ++p;
+            } else if (p < pattern.size() && pattern[p] == '*') {
+                starPattern = p++;
+                starName = n;
+            } else if (starPattern != std::string_view::npos) {
+                p = starPattern + 1;
+                n = ++starName;
+            } else {
+                return false;
+            }
+        }
+        while (p < pattern.size() && pattern[p] == '*') {
+            ++p;
+        }
+        return p == pattern.size();
+    }
+
+    LoaderFactory SWCBatchLoader::createFactory()
+    {
+        std::vector<LoaderEnvironmentEntry> entries = {
+            {           .name = SWC_BATCH_LOADER_ENTRY_THREADS,
+             .displayName = "Threads",
+             .type = typeid(size_t),
+             .defaultValue = static_cast<size_t>(0),
+             .hint = "Zero uses all available cores."},
+            {         .name = SWC_BATCH_LOADER_ENTRY_RECURSIVE,
+             .displayName = "Recursive",
+             .type = typeid(bool),
+             .defaultValue = false,
+             .hint = {}},
+            {.name = SWC_BATCH_LOADER_ENTRY_UID_FROM_FILENAME,
+             .displayName = "UIDs from filenames",
+             .type = typeid(bool),
+             .defaultValue = true,
+             .hint = {}},
+        };
+
+        return LoaderFactory(
+            SWC_BATCH_LOADER_ID, SWC_BATCH_LOADER_NAME, true, entries,
+            [](const std::string& name) {
+                std::error_code error;
+                std::filesystem::path path(name);
+                if (std::filesystem::is_directory(path, error)) {
+                    return true;
+                }
+                return isGlobPattern(path.filename().string()) && path.extension() == ".swc";
+            },
+            [](const LoaderCreateInfo& info, const std::filesystem::path& path) {
+                return FactoryResult(std::make_unique<SWCBatchLoader>(info, path));
+            },
+            [](const LoaderCreateInfo& info, const std::vector<std::string>& lines) {
+                return FactoryResult(std::make_unique<SWCBatchLoader>(info, lines));
+            });
+    }
+} // namespace mindset
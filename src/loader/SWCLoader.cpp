@@ -19,8 +19,38 @@
 
 #include <mindset/loader/SWCLoader.h>
 
+#include <charconv>
 #include <fstream>
+#include <string_view>
 #include <mindset/DefaultProperties.h>
+#include <mindset/loader/LoaderProgress.h>
+#include <mindset/util/Trace.h>
+#include <mindset/util/MemoryTracker.h>
+
+namespace
+{
+    bool isSpace(char c)
+    {
+        return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+    }
+
+    /**
+     * Parses the next whitespace-separated number of a line, advancing the cursor past it.
+     */
+    template<typename T>
+    bool parseNext(const char*& current, const char* end, T& value)
+    {
+        while (current != end && isSpace(*current)) {
+            ++current;
+        }
+        auto [ptr, error] = std::from_chars(current, end, value);
+        if (error != std::errc() || (ptr != end && !isSpace(*ptr))) {
+            return false;
+        }
+        current = ptr;
+        return true;
+    }
+} // namespace
 
 namespace mindset
 {
@@ -28,18 +58,18 @@ namespace mindset
     {
         SWCSegment segment;
 
-        std::stringstream ss(_lines[lineIndex]);
-        ss >> segment.id;
-        ss >> segment.type;
-        ss >> segment.end.x();
-        ss >> segment.end.y();
-        ss >> segment.end.z();
-        ss >> segment.radius;
-        ss >> segment.parent;
+        std::string_view line = _lines[lineIndex];
+        const char* current = line.data();
+        const char* end = line.data() + line.size();
 
-        if (ss.fail()) {
-            return "StringStream error while parsing segment " + std::to_string(lineIndex) +
-                   ". Bits: " + std::to_string(ss.rdstate()) + ".";
+        bool valid = parseNext(current, end, segment.id) && parseNext(current, end, segment.type) &&
+                     parseNext(current, end, segment.end.x()) && parseNext(current, end, segment.end.y()) &&
+                     parseNext(current, end, segment.end.z()) && parseNext(current, end, segment.radius) &&
+                     parseNext(current, end, segment.parent);
+
+        if (!valid) {
+            return "Invalid number while parsing segment " + std::to_string(lineIndex) + ": '" + std::string(line) +
+                   "'.";
         }
 
         return segment;
@@ -82,48 +112,51 @@ namespace mindset
         _provider = provider;
     }
 
-    Result<std::shared_ptr<Morphology>, std::string> SWCLoader::loadMorphology(Dataset& dataset) const
+    Result<std::shared_ptr<Morphology>, std::string> SWCLoader::parseMorphology(
+        const SWCLoaderProperties& properties, LoaderProgress& progress, size_t firstStage) const
     {
-        constexpr size_t STAGES = 3;
+        MINDSET_TRACE_SCOPE("SWCLoader::parseMorphology");
+        constexpr size_t CANCELLATION_CHECK_INTERVAL = 4096;
 
         std::unordered_map<UID, SWCSegment> prototypes;
 
-        invoke({LoaderStatusType::LOADING, "Defining properties", STAGES, 0});
-
-        // Define properties
-        auto lock = dataset.writeLock();
-        auto& properties = dataset.getProperties();
-        auto propPosition = properties.defineProperty(PROPERTY_POSITION);
-        auto propRadius = properties.defineProperty(PROPERTY_RADIUS);
-        auto propParent = properties.defineProperty(PROPERTY_PARENT);
-        auto propType = properties.defineProperty(PROPERTY_NEURITE_TYPE);
-        auto propPath = properties.defineProperty(PROPERTY_PATH);
-        lock.unlock();
-
-        invoke({LoaderStatusType::LOADING, "Parsing SWC file", STAGES, 1});
+        progress.startStage(firstStage, "Parsing SWC file", _lines.size());
 
         prototypes.reserve(_lines.size());
+        size_t reported = 0;
         for (size_t i = 0; i < _lines.size(); ++i) {
-            auto line = _lines[i];
+            if (i % CANCELLATION_CHECK_INTERVAL == 0) {
+                if (progress.checkCancelled()) {
+                    return std::string("Loading cancelled.");
+                }
+                progress.addProgress(i - reported);
+                reported = i;
+            }
+            auto& line = _lines[i];
             if (line.starts_with("#") || line.empty()) {
                 continue;
             }
             auto result = toSegment(i);
             if (!result.isOk()) {
                 std::string error = "Error while converting segment " + std::to_string(i) + ". " + result.getError();
-                invoke({LoaderStatusType::LOADING_ERROR, error, STAGES, 1});
+                progress.reportError(error);
                 return error;
             }
             prototypes.emplace(result.getResult().id, result.getResult());
         }
+        progress.addProgress(_lines.size() - reported);
+
+        if (progress.checkCancelled()) {
+            return std::string("Loading cancelled.");
+        }
 
         auto morphology = std::make_shared<Morphology>();
         if (_path) {
-            morphology->setProperty(propPath, _path->string());
+            morphology->setProperty(properties.path, _path->string());
         }
         morphology->reserveSpaceForNeurites(_lines.size());
 
-        invoke({LoaderStatusType::LOADING, "Parsing neurites", STAGES, 2});
+        progress.startStage(firstStage + 1, "Parsing neurites", prototypes.size());
 
         std::optional<Soma> soma;
         std::unordered_set<UID> somaUIDs;
@@ -140,11 +173,13 @@ namespace mindset
             somaUIDs.insert(id);
         }
 
-        rush::Sphere somaBB(soma->getCenter(), soma->getBestMeanRadius() * 1.2f);
+        if (soma.has_value()) {
+            rush::Sphere somaBB(soma->getCenter(), soma->getBestMeanRadius() * 1.2f);
 
-        for (auto& [id, prototype] : prototypes) {
-            if (intersects(somaBB, prototype.end)) {
-                somaUIDs.insert(id);
+            for (auto& [id, prototype] : prototypes) {
+                if (intersects(somaBB, prototype.end)) {
+                    somaUIDs.insert(id);
+                }
             }
         }
 
@@ -155,15 +190,15 @@ namespace mindset
             }
 
             Neurite neurite(id);
-            neurite.setProperty(propType, type);
-            neurite.setProperty(propPosition, prototype.end);
-            neurite.setProperty(propRadius, prototype.radius);
+            neurite.setProperty(properties.neuriteType, type);
+            neurite.setProperty(properties.position, prototype.end);
+            neurite.setProperty(properties.radius, prototype.radius);
             if (prototype.parent >= 0) {
                 UID parentUID = static_cast<UID>(prototype.parent);
                 if (somaUIDs.contains(parentUID)) {
-                    neurite.setProperty(propParent, soma.value().getUID());
+                    neurite.setProperty(properties.parent, soma.value().getUID());
                 } else {
-                    neurite.setProperty(propParent, parentUID);
+                    neurite.setProperty(properties.parent, parentUID);
                 }
             }
             morphology->addNeurite(std::move(neurite));
@@ -178,27 +213,89 @@ namespace mindset
             morphology->setSoma(std::move(soma.value()));
         }
 
-        invoke({LoaderStatusType::DONE, "Done", STAGES, 3});
-
         return morphology;
     }
 
+    SWCLoaderProperties SWCLoader::initProperties(Dataset& dataset)
+    {
+        auto lock = dataset.writeLock();
+        auto& properties = dataset.getProperties();
+
+        SWCLoaderProperties result{};
+        result.position = properties.defineProperty(PROPERTY_POSITION);
+        result.radius = properties.defineProperty(PROPERTY_RADIUS);
+        result.parent = properties.defineProperty(PROPERTY_PARENT);
+        result.neuriteType = properties.defineProperty(PROPERTY_NEURITE_TYPE);
+        result.path = properties.defineProperty(PROPERTY_PATH);
+        return result;
+    }
+
+    Result<std::shared_ptr<Morphology>, std::string> SWCLoader::loadMorphology(Dataset& dataset) const
+    {
+        constexpr size_t STAGES = 3;
+        LoaderProgress progress(*this, STAGES);
+
+        progress.startStage(0, "Defining properties");
+        auto properties = initProperties(dataset);
+
+        auto result = parseMorphology(properties, progress, 1);
+        if (result.isOk()) {
+            progress.reportDone();
+        }
+        return result;
+    }
+
+    Result<std::shared_ptr<Morphology>, std::string> SWCLoader::loadMorphology(
+        const SWCLoaderProperties& properties) const
+    {
+        constexpr size_t STAGES = 2;
+        LoaderProgress progress(*this, STAGES);
+
+        auto result = parseMorphology(properties, progress, 0);
+        if (result.isOk()) {
+            progress.reportDone();
+        }
+        return result;
+    }
+
     void SWCLoader::load(Dataset& dataset) const
     {
-        auto result = loadMorphology(dataset);
+        MINDSET_TRACE_SCOPE("SWCLoader::load");
+        AllocationScope allocationScope("SWCLoader");
+        constexpr size_t STAGES = 4;
+        LoaderProgress progress(*this, STAGES);
+
+        progress.startStage(0, "Defining properties");
+        auto properties = initProperties(dataset);
+
+        auto result = parseMorphology(properties, progress, 1);
         if (!result.isOk()) {
-            std::cerr << result.getError() << std::endl;
+            if (!isCancelled()) {
+                std::cerr << result.getError() << std::endl;
+            }
+            return;
+        }
+
+        // The dataset is only modified once the load can no longer be cancelled.
+        progress.startStage(3, "Committing neuron");
+        if (progress.checkCancelled()) {
             return;
         }
 
         UID uid = _provider == nullptr ? 0 : _provider();
-        auto lock = dataset.writeLock();
+        std::unique_lock<std::shared_mutex> lock;
+        {
+            MINDSET_TRACE_SCOPE("SWCLoader::load: waiting for the dataset lock");
+            lock = dataset.writeLock();
+        }
         if (auto neuron = dataset.getNeuron(uid)) {
             auto neuronLock = neuron.value()->writeLock();
             neuron.value()->setMorphology(result.getResult());
         } else {
-            dataset.addNeuron(Neuron(uid, result.getResult()));
+            dataset.addNeuron(Neuron(uid, result.getResult(), dataset.getAllocator()));
         }
+        lock.unlock();
+        progress.reportDone();
     }
 
     LoaderFactory SWCLoader::createFactory()
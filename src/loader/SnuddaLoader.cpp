@@ -20,11 +20,17 @@
 #include "mindset/EventSequence.h"
 #include "mindset/TimeGrid.h"
 
+#include <unordered_set>
+
 #include <mindset/DefaultProperties.h>
 #include <mindset/loader/SnuddaLoader.h>
 #include <mindset/loader/SWCLoader.h>
+#include <mindset/loader/LoaderProgress.h>
 #include <mindset/util/NeuronTransform.h>
+#include <mindset/util/Parallel.h>
 #include <mindset/util/MorphologyUtils.h>
+#include <mindset/util/Trace.h>
+#include <mindset/util/MemoryTracker.h>
 #include <rush/matrix/mat.h>
 #include <rush/vector/vec.h>
 
@@ -149,10 +155,12 @@ namespace mindset
         return result;
     }
 
-    void SnuddaLoader::loadNeurons(Dataset& dataset,
-                                   const std::unordered_map<std::string, std::shared_ptr<Morphology>>& morphologies,
-                                   const SnuddaLoaderProperties& properties) const
+    std::vector<Neuron> SnuddaLoader::loadNeurons(
+        const std::unordered_map<std::string, std::shared_ptr<Morphology>>& morphologies,
+        const SnuddaLoaderProperties& properties, const Dataset::allocator_type& allocator,
+        LoaderProgress& progress) const
     {
+        MINDSET_TRACE_SCOPE("SnuddaLoader::loadNeurons");
         auto& ids = properties.ids;
         std::vector<std::array<double, 3>> positions;
         std::vector<std::array<double, 9>> rotations;
@@ -168,13 +176,27 @@ namespace mindset
             morphologiesNames = readMorphologies(_file, properties.morphologyGroup.value());
         }
 
+        std::vector<Neuron> neurons;
+        neurons.reserve(ids.size());
+
         for (size_t i = 0; i < ids.size(); ++i) {
+            if (progress.checkCancelled()) {
+                return {};
+            }
+
             bool hasPosition = i < positions.size();
             bool hasRotation = i < rotations.size();
             bool hasMorphology = i < morphologiesNames.size();
 
-            std::optional<NeuronTransform> transform = {};
             std::shared_ptr<Morphology> morphology = nullptr;
+            if (hasMorphology) {
+                if (auto it = morphologies.find(std::string(morphologiesNames[i])); it != morphologies.end()) {
+                    morphology = it->second;
+                }
+            }
+
+            Neuron neuron(ids[i], morphology, allocator);
+
             if (hasPosition || hasRotation) {
                 rush::Mat4f model(1.0f);
                 if (hasRotation) {
@@ -187,76 +209,90 @@ namespace mindset
                     rush::Vec3f pos(positions[i][0], positions[i][1], positions[i][2]); // Position in meters
                     model[3] = rush::Vec4f(pos * METER_MICROMETER_RATIO, 1.0f);
                 }
-                transform = NeuronTransform(model);
-            }
-
-            if (hasMorphology) {
-                if (auto it = morphologies.find(std::string(morphologiesNames[i])); it != morphologies.end()) {
-                    morphology = it->second;
-                }
+                neuron.setProperty(properties.neuronTransform, NeuronTransform(model));
             }
 
-            auto lock = dataset.writeLock();
-            auto presentNeuron = dataset.getNeuron(ids[i]);
-            if (presentNeuron.has_value()) {
-                auto neuronLock = presentNeuron.value()->writeLock();
-                if (morphology != nullptr) {
-                    presentNeuron.value()->setMorphology(morphology);
-                }
-                if (transform.has_value()) {
-                    presentNeuron.value()->setProperty(properties.neuronTransform, transform.value());
-                }
-            } else {
-                Neuron neuron(ids[i], morphology);
-                if (transform.has_value()) {
-                    neuron.setProperty(properties.neuronTransform, transform.value());
-                }
-                dataset.addNeuron(std::move(neuron));
-            }
+            neurons.push_back(std::move(neuron));
+            progress.addProgress(1);
         }
+
+        return neurons;
     }
 
     Result<std::unordered_map<std::string, std::shared_ptr<Morphology>>, std::string> SnuddaLoader::loadMorphologies(
-        const SnuddaLoaderProperties& properties, Dataset& dataset) const
+        const SnuddaLoaderProperties& properties, Dataset& dataset, LoaderProgress& progress) const
     {
+        MINDSET_TRACE_SCOPE("SnuddaLoader::loadMorphologies");
         static constexpr std::string SNUDDA_PREFIX = "$SNUDDA_DATA";
 
         std::unordered_map<std::string, std::shared_ptr<Morphology>> loaded;
         if (!properties.morphologyGroup.has_value()) {
             // This is not an error; it just happens that the dataset doesn't have morphologies!
-            return std::move(loaded);
+            return loaded;
         }
 
         auto morphologies = readMorphologies(_file, properties.morphologyGroup.value());
+        std::vector<std::string> names;
+        {
+            std::unordered_set<std::string> unique;
+            for (auto& name : morphologies) {
+                if (unique.insert(name).second) {
+                    names.push_back(name);
+                }
+            }
+        }
 
-        for (size_t i = 0; i < morphologies.size(); ++i) {
-            auto name = morphologies[i];
-            if (loaded.contains(name)) {
-                continue;
+        // The SWC properties are defined once, so the workers never touch the dataset.
+        auto swcProperties = SWCLoader::initProperties(dataset);
+
+        std::vector<std::shared_ptr<Morphology>> parsed(names.size());
+        std::vector<std::string> errors(names.size());
+        parallelFor(names.size(), [&](size_t i) {
+            if (progress.checkCancelled()) {
+                return;
             }
 
-            std::string modified = name;
+            std::string modified = names[i];
             modified.replace(0, SNUDDA_PREFIX.length(), properties.snuddaPath);
             std::filesystem::path path(modified);
 
             SWCLoader loader(LoaderCreateInfo(), path);
+            loader.setStopToken(getStopToken());
 
-            auto swc = loader.loadMorphology(dataset);
-            if (!swc.isOk()) {
-                return swc.getError();
+            auto swc = loader.loadMorphology(swcProperties);
+            if (swc.isOk()) {
+                parsed[i] = std::move(swc.getResult());
+                parsed[i]->setProperty(properties.morphologyPath, names[i]);
+            } else {
+                errors[i] = std::move(swc).getError();
+            }
+            progress.addProgress(1);
+        });
+
+        if (progress.checkCancelled()) {
+            return std::string("Loading cancelled.");
+        }
+
+        for (size_t i = 0; i < names.size(); ++i) {
+            if (!errors[i].empty()) {
+                return errors[i];
             }
-            swc.getResult()->setProperty(properties.morphologyPath, name);
-            loaded[name] = swc.getResult();
+            loaded[names[i]] = std::move(parsed[i]);
         }
 
-        return std::move(loaded);
+        return loaded;
     }
 
-    void SnuddaLoader::loadSynapses(Dataset& dataset, const SnuddaLoaderProperties& properties) const
+    std::vector<Synapse> SnuddaLoader::loadSynapses(const Dataset& dataset, const std::vector<Neuron>& neurons,
+                                                    const SnuddaLoaderProperties& properties,
+                                                    LoaderProgress& progress) const
     {
+        MINDSET_TRACE_SCOPE("SnuddaLoader::loadSynapses");
+        constexpr size_t CANCELLATION_CHECK_INTERVAL = 65536;
+
         if (!properties.voxelSizeGroup.has_value() || !properties.synapsesGroup.has_value() ||
             !properties.simulationOrigoGroup.has_value()) {
-            return;
+            return {};
         }
 
         using Syn = std::array<int32_t, 13>;
@@ -264,6 +300,10 @@ namespace mindset
         auto synapses = _file.getDataSet(properties.synapsesGroup.value()).read<std::vector<Syn>>();
         auto origo = _file.getDataSet(properties.simulationOrigoGroup.value()).read<std::array<double, 3>>();
 
+        if (progress.checkCancelled()) {
+            return {};
+        }
+
         auto origin = rush::Vec3f(origo[0], origo[1], origo[2]);
 
         std::unordered_map<UID, Synapse> _synapses;
@@ -271,7 +311,15 @@ namespace mindset
 
         UID uidGenerator = 0;
 
-        for (const auto& synapse : synapses) {
+        for (size_t i = 0; i < synapses.size(); ++i) {
+            if (i % CANCELLATION_CHECK_INTERVAL == 0 && i > 0) {
+                if (progress.checkCancelled()) {
+                    return {};
+                }
+                progress.addProgress(CANCELLATION_CHECK_INTERVAL, CANCELLATION_CHECK_INTERVAL * sizeof(Syn));
+            }
+
+            const auto& synapse = synapses[i];
             UID sourceId = synapse[0];
             UID destId = synapse[1];
             int32_t destSegId = synapse[9];
@@ -279,7 +327,7 @@ namespace mindset
             rush::Vec3f position =
                 (rush::Vec3f(synapse[2], synapse[3], synapse[4]) * voxelSize + origin) * METER_MICROMETER_RATIO;
 
-            Synapse syn(uidGenerator++, sourceId, destId);
+            Synapse syn(uidGenerator++, sourceId, destId, dataset.getAllocator());
             syn.setProperty(properties.position, position);
             syn.setProperty(properties.synapsePostPosition, position);
 
@@ -293,13 +341,39 @@ namespace mindset
             _synapses.insert({syn.getUID(), std::move(syn)});
         }
 
+        // The loaded neurons are not in the dataset yet, but pre-synaptic neurons may already be there.
+        // The candidate with a morphology is preferred, so reloads without morphologies keep the positions.
+        std::unordered_map<UID, const Neuron*> neuronsByUID;
+        neuronsByUID.reserve(neurons.size());
+        for (auto& neuron : neurons) {
+            neuronsByUID.emplace(neuron.getUID(), &neuron);
+        }
+        auto findNeuron = [&](UID uid) -> const Neuron* {
+            const Neuron* loaded = nullptr;
+            if (auto found = neuronsByUID.find(uid); found != neuronsByUID.end()) {
+                loaded = found->second;
+                if (loaded->getMorphology().has_value()) {
+                    return loaded;
+                }
+            }
+            const Neuron* present = dataset.getNeuron(uid).value_or(nullptr);
+            if (present != nullptr && (loaded == nullptr || present->getMorphology().has_value())) {
+                return present;
+            }
+            return loaded;
+        };
+        auto datasetLock = dataset.readLock();
+
         for (auto it = synapsesMap.begin(); it != synapsesMap.end();) {
+            if (progress.checkCancelled()) {
+                return {};
+            }
+
             const UID neuronUID = it->first;
             auto range = synapsesMap.equal_range(neuronUID);
-            auto neuronOpt = dataset.getNeuron(neuronUID);
+            auto neuron = findNeuron(neuronUID);
 
-            if (neuronOpt.has_value() && neuronOpt.value()->getMorphology().has_value()) {
-                auto neuron = neuronOpt.value();
+            if (neuron != nullptr && neuron->getMorphology().has_value()) {
                 std::vector<rush::Vec3f> points;
                 auto transformOpt = neuron->getProperty<NeuronTransform>(properties.neuronTransform);
 
@@ -329,17 +403,21 @@ namespace mindset
             it = range.second;
         }
 
-        auto& circuit = dataset.getCircuit();
-        auto lock = circuit.writeLock();
+        std::vector<Synapse> result;
+        result.reserve(_synapses.size());
         for (auto& synapse : _synapses | std::views::values) {
-            circuit.addSynapse(std::move(synapse));
+            result.push_back(std::move(synapse));
         }
+        MINDSET_TRACE_COUNTER("SnuddaLoader synapses", result.size());
+        return result;
     }
 
-    void SnuddaLoader::loadOutputActivity(Dataset& dataset, const SnuddaLoaderProperties& properties) const
+    std::optional<SnuddaLoader::SnuddaActivity> SnuddaLoader::loadOutputActivity(
+        const SnuddaLoaderProperties& properties, LoaderProgress& progress) const
     {
+        MINDSET_TRACE_SCOPE("SnuddaLoader::loadOutputActivity");
         if (!_file.exist("neurons")) {
-            return;
+            return {};
         }
         EventSequence<std::monostate> spikes;
         TimeGrid<double> voltage(std::chrono::nanoseconds(25000));
@@ -351,6 +429,10 @@ namespace mindset
         rawVoltage.reserve(400001);
 
         for (UID id : properties.ids) {
+            if (progress.checkCancelled()) {
+                return {};
+            }
+
             std::string spikesDataset = std::format("neurons/{}/spikes", id);
             std::string voltageDataset = std::format("neurons/{}/voltage", id);
 
@@ -365,28 +447,31 @@ namespace mindset
                 _file.getDataSet(voltageDataset).read(rawVoltage);
                 voltage.addTimeline(id, rawVoltage);
             }
+
+            progress.addProgress(1, (rawSpikes.size() + rawVoltage.size()) * sizeof(double));
         }
 
-        auto lock = dataset.writeLock();
-        Activity activity(dataset.findSmallestAvailableActivityUID());
-        activity.setProperty(properties.activitySpikes, std::move(spikes));
-        activity.setProperty(properties.activityVoltage, std::move(voltage));
-        dataset.addActivity(std::move(activity));
+        return SnuddaActivity{std::move(spikes), std::move(voltage)};
     }
 
-    void SnuddaLoader::loadInputActivity(Dataset& dataset, const SnuddaLoaderProperties& properties) const
+    std::optional<SnuddaLoader::SnuddaActivity> SnuddaLoader::loadInputActivity(
+        const SnuddaLoaderProperties& properties, LoaderProgress& progress) const
     {
+        MINDSET_TRACE_SCOPE("SnuddaLoader::loadInputActivity");
         if (!_file.exist("input")) {
-            return;
+            return {};
         }
         EventSequence<std::monostate> spikes;
-        TimeGrid<double> voltage(std::chrono::nanoseconds(25000));
 
         std::vector<double> rawSpikes;
 
         rawSpikes.reserve(1000);
 
         for (UID id : properties.ids) {
+            if (progress.checkCancelled()) {
+                return {};
+            }
+
             std::string spikesDataset = std::format("input/{}/activity/spikes", id);
 
             std::array tableSpikes = {std::format("input/{}/cortical/spikes", id),
@@ -412,12 +497,53 @@ namespace mindset
                     }
                 }
             }
+
+            progress.addProgress(1);
         }
 
-        auto lock = dataset.writeLock();
-        Activity activity(dataset.findSmallestAvailableActivityUID());
-        activity.setProperty(properties.activitySpikes, std::move(spikes));
-        dataset.addActivity(std::move(activity));
+        return SnuddaActivity{std::move(spikes), {}};
+    }
+
+    void SnuddaLoader::commit(Dataset& dataset, std::vector<Neuron> neurons, std::vector<Synapse> synapses,
+                              std::vector<SnuddaActivity> activities, const SnuddaLoaderProperties& properties) const
+    {
+        MINDSET_TRACE_SCOPE("SnuddaLoader::commit");
+        std::unique_lock<std::shared_mutex> lock;
+        {
+            MINDSET_TRACE_SCOPE("SnuddaLoader::commit: waiting for the dataset lock");
+            lock = dataset.writeLock();
+        }
+
+        for (auto& neuron : neurons) {
+            auto presentNeuron = dataset.getNeuron(neuron.getUID());
+            if (!presentNeuron.has_value()) {
+                dataset.addNeuron(std::move(neuron));
+                continue;
+            }
+
+            auto neuronLock = presentNeuron.value()->writeLock();
+            if (auto morphology = neuron.getMorphologyPtr()) {
+                presentNeuron.value()->setMorphology(std::move(morphology));
+            }
+            if (auto transform = neuron.getProperty<NeuronTransform>(properties.neuronTransform)) {
+                presentNeuron.value()->setProperty(properties.neuronTransform, transform.value());
+            }
+        }
+
+        if (!synapses.empty()) {
+            auto& circuit = dataset.getCircuit();
+            auto circuitLock = circuit.writeLock();
+            circuit.addSynapses(std::move(synapses));
+        }
+
+        for (auto& data : activities) {
+            Activity activity(dataset.findSmallestAvailableActivityUID(), dataset.getAllocator());
+            activity.setProperty(properties.activitySpikes, std::move(data.spikes));
+            if (data.voltage.has_value()) {
+                activity.setProperty(properties.activityVoltage, std::move(data.voltage.value()));
+            }
+            dataset.addActivity(std::move(activity));
+        }
     }
 
     SnuddaLoader::SnuddaLoader(const LoaderCreateInfo& info, const std::filesystem::path& path) :
@@ -428,18 +554,21 @@ namespace mindset
 
     void SnuddaLoader::load(Dataset& dataset) const
     {
-        constexpr size_t STAGES = 6;
-        invoke({LoaderStatusType::LOADING, "Fetching properties", STAGES, 0});
+        MINDSET_TRACE_SCOPE("SnuddaLoader::load");
+        AllocationScope allocationScope("SnuddaLoader");
+        constexpr size_t STAGES = 7;
+        LoaderProgress progress(*this, STAGES);
+        progress.startStage(0, "Fetching properties");
 
         auto path = getEnvironmentEntry<std::string>(SNUDDA_LOADER_ENTRY_SNUDDA_DATA_PATH);
         if (!path.has_value()) {
-            invoke({LoaderStatusType::LOADING_ERROR, "Snudda path not set.", STAGES, 0});
+            progress.reportError("Snudda path not set.");
             return;
         }
 
         auto ids = tryFetchUIDs(_file, fetchValidGroup(_file, SNUDDA_LOADER_VALID_ID_GROUPS));
         if (!ids.has_value()) {
-            invoke({LoaderStatusType::LOADING_ERROR, "Neuron ids not present.", STAGES, 0});
+            progress.reportError("Neuron ids not present.");
             return;
         }
 
@@ -447,32 +576,57 @@ namespace mindset
 
         std::unordered_map<std::string, std::shared_ptr<Morphology>> morphologies;
         if (properties.loadMorphologies) {
-            invoke({LoaderStatusType::LOADING, "Loading morphologies", STAGES, 1});
-            auto result = loadMorphologies(properties, dataset);
+            progress.startStage(1, "Loading morphologies");
+            auto result = loadMorphologies(properties, dataset, progress);
+            if (progress.checkCancelled()) {
+                return;
+            }
             if (!result.isOk()) {
                 std::cerr << result.getError() << std::endl;
+                progress.reportError(result.getError());
                 return;
             }
 
-            morphologies = std::move(result.getResult());
+            morphologies.swap(result.getResult());
         }
 
-        invoke({LoaderStatusType::LOADING, "Loading neurons", STAGES, 2});
-        loadNeurons(dataset, morphologies, properties);
+        progress.startStage(2, "Loading neurons", properties.ids.size());
+        auto neurons = loadNeurons(morphologies, properties, dataset.getAllocator(), progress);
+        if (progress.checkCancelled()) {
+            return;
+        }
 
+        std::vector<Synapse> synapses;
         if (properties.loadSynapses) {
-            invoke({LoaderStatusType::LOADING, "Loading synapses", STAGES, 3});
-            loadSynapses(dataset, properties);
+            progress.startStage(3, "Loading synapses");
+            synapses = loadSynapses(dataset, neurons, properties, progress);
+            if (progress.checkCancelled()) {
+                return;
+            }
         }
 
+        std::vector<SnuddaActivity> activities;
         if (properties.loadActivity) {
-            invoke({LoaderStatusType::LOADING, "Loading input activity", STAGES, 4});
-            loadInputActivity(dataset, properties);
-            invoke({LoaderStatusType::LOADING, "Loading output activity", STAGES, 5});
-            loadOutputActivity(dataset, properties);
+            progress.startStage(4, "Loading input activity", properties.ids.size());
+            if (auto activity = loadInputActivity(properties, progress)) {
+                activities.push_back(std::move(activity.value()));
+            }
+            if (progress.checkCancelled()) {
+                return;
+            }
+            progress.startStage(5, "Loading output activity", properties.ids.size());
+            if (auto activity = loadOutputActivity(properties, progress)) {
+                activities.push_back(std::move(activity.value()));
+            }
+            if (progress.checkCancelled()) {
+                return;
+            }
         }
 
-        invoke({LoaderStatusType::DONE, "Done", STAGES, STAGES});
+        progress.startStage(6, "Committing data");
+        commit(dataset, std::move(neurons), std::move(synapses), std::move(activities), properties);
+
+        progress.reportDone();
     }
 
     LoaderFactory SnuddaLoader::createFactory()
@@ -17,11 +17,18 @@
 // along with this library; if not, write to the Free Software Foundation, Inc.,
 // 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
 
+#include <algorithm>
+#include <charconv>
 #include <fstream>
+#include <iterator>
 
 #include <mindset/DefaultProperties.h>
 #include <mindset/loader/XMLLoader.h>
 #include <mindset/loader/SWCLoader.h>
+#include <mindset/loader/LoaderProgress.h>
+#include <mindset/util/Parallel.h>
+#include <mindset/util/Trace.h>
+#include <mindset/util/MemoryTracker.h>
 
 namespace
 {
@@ -43,42 +50,45 @@ namespace
         return attr.as_string();
     }
 
-    mindset::Result<std::vector<float>, std::string> split(const std::string& string, char delimiter)
+    bool isSpace(char c)
     {
-        std::vector<float> tokens;
-        std::stringstream ss(string);
-
-        std::string token;
-        while (std::getline(ss, token, delimiter)) {
-            try {
-                tokens.push_back(std::stof(token));
-            } catch (const std::invalid_argument& e) {
-                return {"Invalid float! " + std::string(token)};
-            } catch (const std::out_of_range& e) {
-                return {"Number out of range! " + std::string(token)};
-            }
-        }
-
-        return tokens;
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r';
     }
 
-    mindset::Result<std::vector<mindset::UID>, std::string> splitUID(const std::string& string, char delimiter)
+    /**
+     * Parses a delimited list of numbers directly from the given text.
+     * The values are stored in the given vector, which is cleared first, so it can be reused between calls.
+     */
+    template<typename T>
+    mindset::Result<size_t, std::string> parseList(std::string_view text, char delimiter, std::vector<T>& out)
     {
-        std::vector<mindset::UID> tokens;
-        std::stringstream ss(string);
-
-        std::string token;
-        while (std::getline(ss, token, delimiter)) {
-            try {
-                tokens.push_back(std::stoi(token));
-            } catch (const std::invalid_argument& e) {
-                return {"Invalid int! " + std::string(token)};
-            } catch (const std::out_of_range& e) {
-                return {"Number out of range! " + std::string(token)};
+        out.clear();
+        const char* current = text.data();
+        const char* end = text.data() + text.size();
+
+        while (current != end) {
+            while (current != end && isSpace(*current)) {
+                ++current;
+            }
+            const char* tokenEnd = std::find(current, end, delimiter);
+
+            T value;
+            auto [ptr, error] = std::from_chars(current, tokenEnd, value);
+            if (error == std::errc::result_out_of_range) {
+                return "Number out of range! " + std::string(current, tokenEnd);
+            }
+            while (ptr != tokenEnd && isSpace(*ptr)) {
+                ++ptr;
+            }
+            if (error != std::errc() || ptr != tokenEnd) {
+                return "Invalid number! " + std::string(current, tokenEnd);
             }
+            out.push_back(value);
+
+            current = tokenEnd == end ? end : tokenEnd + 1;
         }
 
-        return tokens;
+        return out.size();
     }
 } // namespace
 
@@ -92,101 +102,99 @@ namespace mindset
     }
 
     XMLLoader::XMLLoader(const LoaderCreateInfo& info, std::istream& stream) :
-        Loader(info)
+        Loader(info),
+        _buffer(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>())
     {
-        auto result = _doc.load(stream);
+        auto result = _doc.load_buffer_inplace(_buffer.data(), _buffer.size());
         _valid = result.status == pugi::status_ok;
     }
 
     XMLLoader::XMLLoader(const LoaderCreateInfo& info, std::filesystem::path path) :
         Loader(info)
     {
-        std::ifstream stream(path);
-        auto result = _doc.load(stream);
+        std::ifstream stream(path, std::ios::binary);
+        std::error_code error;
+        auto size = std::filesystem::file_size(path, error);
+        if (error || !stream) {
+            _valid = false;
+            return;
+        }
+
+        // The document is parsed in place, so the file is copied only once.
+        _buffer.resize(size);
+        stream.read(_buffer.data(), static_cast<std::streamsize>(size));
+        _buffer.resize(static_cast<size_t>(stream.gcount()));
+
+        auto result = _doc.load_buffer_inplace(_buffer.data(), _buffer.size());
         _valid = result.status == pugi::status_ok;
     }
 
     void XMLLoader::load(Dataset& dataset) const
     {
-        constexpr size_t STAGES = 3;
-        invoke({LoaderStatusType::LOADING, "Validating XML file", STAGES, 0});
+        MINDSET_TRACE_SCOPE("XMLLoader::load");
+        AllocationScope allocationScope("XMLLoader");
+        constexpr size_t STAGES = 4;
+        LoaderProgress progress(*this, STAGES);
+        progress.startStage(0, "Validating XML file");
 
         if (!_valid) {
             std::cerr << "Parser is not valid" << std::endl;
-            invoke({LoaderStatusType::LOADING_ERROR, "Parser is not valid", STAGES, 0});
+            progress.reportError("Parser is not valid");
             return;
         }
         if (!getFileProvider()) {
             std::cerr << "Filesystem is not set" << std::endl;
-            invoke({LoaderStatusType::LOADING_ERROR, "Filesystem is not set", STAGES, 0});
+            progress.reportError("Filesystem is not set");
             return;
         }
         auto scene = _doc.child("scene").child("morphology");
         if (!scene) {
             std::cerr << "Scene not found" << std::endl;
-            invoke({LoaderStatusType::LOADING_ERROR, "Scene not found", STAGES, 0});
+            progress.reportError("Scene not found");
             return;
         };
 
-        UID transformProp = dataset.getProperties().defineProperty(PROPERTY_TRANSFORM);
         std::unordered_map<UID, XMLNeuron> xmlNeurons;
+        std::vector<float> floats;
 
-        invoke({LoaderStatusType::LOADING, "Loading hierarchy", STAGES, 1});
-
-        Node* root = dataset.getHierarchy().value_or(nullptr);
-        if (root == nullptr) {
-            root = dataset.createHierarchy(0, "mindset:root");
-        }
+        progress.startStage(1, "Loading hierarchy");
 
         for (auto column : scene.child("columns").children("column")) {
-            auto columnId = asUID(column.attribute("id"));
-
-            Node* columnNode = nullptr;
-            if (columnId.has_value()) {
-                if (auto result = root->getOrCreateNode(columnId.value(), "mindset:column"); result.isOk()) {
-                    columnNode = result.getResult();
-                }
+            if (progress.checkCancelled()) {
+                return;
             }
 
+            auto columnId = asUID(column.attribute("id"));
+
             for (auto miniColumn : column.children("minicolumn")) {
                 auto miniColumnId = asUID(miniColumn.attribute("id"));
 
-                Node* miniColumnNode = nullptr;
-                if (columnNode != nullptr && columnId.has_value()) {
-                    auto result = columnNode->getOrCreateNode(columnId.value(), "mindset:mini_column");
-                    if (result.isOk()) {
-                        miniColumnNode = result.getResult();
-                    }
-                }
-
                 for (auto neuron : miniColumn.children("neuron")) {
                     auto gid = asUID(neuron.attribute("gid"));
                     if (!gid.has_value()) {
                         std::cerr << "Neuron GID not found!" << std::endl;
-                        invoke({LoaderStatusType::LOADING_ERROR, "Neuron GID not found", STAGES, 1});
+                        progress.reportError("Neuron GID not found");
                         return;
                     };
 
                     XMLNeuron xmlNeuron = {.id = gid.value(),
                                            .column = columnId,
                                            .miniColumn = miniColumnId,
-                                           .layer = asUID(neuron.append_attribute("layer")),
+                                           .layer = asUID(neuron.attribute("layer")),
                                            .neuronType = asString(neuron.attribute("type")),
                                            .transform = {},
-                                           .node = miniColumnNode};
+                                           .node = nullptr};
 
                     if (auto transform = neuron.child("transform").first_child()) {
-                        std::string string = transform.value();
-                        auto result = split(string, ',');
+                        auto result = parseList(transform.value(), ',', floats);
                         if (!result.isOk()) {
                             std::cerr << result.getError() << std::endl;
-                            invoke({LoaderStatusType::LOADING_ERROR, result.getError(), STAGES, 1});
+                            progress.reportError(result.getError());
                             return;
                         };
-                        auto floats = std::move(result.getResult());
                         if (floats.size() != 16) {
                             std::cerr << "Invalid matrix size." << std::endl;
-                            invoke({LoaderStatusType::LOADING_ERROR, "Invalid matrix size", STAGES, 1});
+                            progress.reportError("Invalid matrix size");
                             return;
                         };
 
@@ -196,50 +204,132 @@ namespace mindset
                     }
 
                     xmlNeurons.insert({gid.value(), std::move(xmlNeuron)});
+                    progress.addProgress(1);
                 }
             }
         }
 
-        invoke({LoaderStatusType::LOADING, "Load morphology", STAGES, 2});
+        // Collects the referenced SWC files first, so each file is parsed once even if several entries list it.
+        std::vector<std::pair<std::vector<UID>, size_t>> entries;
+        std::vector<std::string> files;
+        {
+            MINDSET_TRACE_SCOPE("XMLLoader::load: collecting morphologies");
+            std::unordered_map<std::string_view, size_t> fileIndices;
+            std::vector<UID> uids;
+            for (auto morpho : scene.child("neuronmorphologies").children("neuronmorphology")) {
+                auto att = morpho.attribute("neurons");
+                if (att.empty()) {
+                    continue;
+                }
 
-        for (auto morpho : scene.child("neuronmorphologies").children("neuronmorphology")) {
-            auto att = morpho.attribute("neurons");
-            if (att.empty()) {
-                continue;
-            }
+                auto fileAtt = morpho.attribute("swc");
+                if (fileAtt.empty()) {
+                    continue;
+                }
 
-            auto fileAtt = morpho.attribute("swc");
-            if (fileAtt.empty()) {
-                continue;
-            }
+                auto result = parseList(att.as_string(""), ',', uids);
+                if (!result.isOk()) {
+                    std::cerr << result.getError() << std::endl;
+                    continue;
+                }
+                if (uids.empty()) {
+                    continue;
+                }
 
-            auto result = splitUID(att.as_string(""), ',');
-            if (!result.isOk()) {
-                std::cerr << result.getError() << std::endl;
-            }
-            auto uids = std::move(result.getResult());
-            if (uids.empty()) {
-                continue;
+                // Attribute values live in the document, so they can be used as keys without copying them.
+                std::string_view fileName = fileAtt.as_string("");
+                auto [it, inserted] = fileIndices.try_emplace(fileName, files.size());
+                if (inserted) {
+                    files.emplace_back(fileName);
+                }
+                entries.emplace_back(uids, it->second);
             }
+        }
+
+        progress.startStage(2, "Load morphology", files.size());
+
+        auto properties = SWCLoader::initProperties(dataset);
+        auto& provider = getFileProvider();
+        size_t threads = getEnvironmentEntryOr(XML_LOADER_ENTRY_THREADS, static_cast<size_t>(0));
+
+        std::vector<std::shared_ptr<Morphology>> morphologies(files.size());
+        std::vector<std::string> errors(files.size());
+
+        parallelFor(
+            files.size(),
+            [&](size_t i) {
+                if (progress.checkCancelled()) {
+                    return;
+                }
 
-            auto fileName = std::string(fileAtt.as_string(""));
-            auto lines = getFileProvider()(fileName);
+                auto lines = provider(files[i]);
+                if (!lines.has_value()) {
+                    errors[i] = "File not found: " + files[i];
+                    progress.addProgress(1);
+                    return;
+                }
+                size_t bytes = 0;
+                for (auto& line : lines.value()) {
+                    bytes += line.size() + 1;
+                }
+
+                auto loader = SWCLoader(LoaderCreateInfo(), std::move(lines.value()));
+                loader.setStopToken(getStopToken());
+                auto result = loader.loadMorphology(properties);
+                if (result.isOk()) {
+                    morphologies[i] = std::move(result).getResult();
+                } else {
+                    errors[i] = "Error loading SWC file '" + files[i] + "': " + result.getError();
+                }
+                progress.addProgress(1, bytes);
+            },
+            threads);
 
-            if (!lines.has_value()) {
-                std::cerr << "File not found: " << fileName << std::endl;
-            };
+        if (progress.checkCancelled()) {
+            return;
+        }
 
-            auto loader = SWCLoader(LoaderCreateInfo(), lines.value());
-            auto swcResult = loader.loadMorphology(dataset);
-            if (!swcResult.isOk()) {
-                auto error = "Error loading SWC file '" + fileName + "': " + swcResult.getError();
+        for (auto& error : errors) {
+            if (!error.empty()) {
                 std::cerr << error << std::endl;
-                invoke({LoaderStatusType::LOADING_ERROR, error, STAGES, 2});
+                progress.reportError(error);
                 return;
-            };
+            }
+        }
 
-            auto swc = std::move(swcResult.getResult());
+        progress.startStage(3, "Committing neurons", xmlNeurons.size());
 
+        std::unique_lock<std::shared_mutex> lock;
+        {
+            MINDSET_TRACE_SCOPE("XMLLoader::load: waiting for the dataset lock");
+            lock = dataset.writeLock();
+        }
+        UID transformProp = dataset.getProperties().defineProperty(PROPERTY_TRANSFORM);
+
+        Node* root = dataset.getHierarchy().value_or(nullptr);
+        if (root == nullptr) {
+            root = dataset.createHierarchy(0, "mindset:root");
+        }
+
+        for (auto& [id, xml] : xmlNeurons) {
+            if (!xml.column.has_value()) {
+                continue;
+            }
+            auto columnResult = root->getOrCreateNode(xml.column.value(), "mindset:column");
+            if (!columnResult.isOk() || !xml.miniColumn.has_value()) {
+                continue;
+            }
+            auto result = columnResult.getResult()->getOrCreateNode(xml.miniColumn.value(), "mindset:mini_column");
+            if (result.isOk()) {
+                xml.node = result.getResult();
+            }
+        }
+
+        for (auto& [uids, file] : entries) {
+            auto& swc = morphologies[file];
+            if (swc == nullptr) {
+                continue;
+            }
             for (UID id : uids) {
                 auto it = xmlNeurons.find(id);
                 if (it == xmlNeurons.end()) {
@@ -247,7 +337,6 @@ namespace mindset
                 }
                 auto& xml = it->second;
 
-                auto lock = dataset.writeLock();
                 if (auto presentNeuron = dataset.getNeuron(xml.id)) {
                     auto neuronLock = presentNeuron.value()->writeLock();
                     presentNeuron.value()->setMorphology(swc);
@@ -258,7 +347,7 @@ namespace mindset
                         xml.node->addNeuron(xml.id);
                     }
                 } else {
-                    Neuron neuron(xml.id, swc);
+                    Neuron neuron(xml.id, swc, dataset.getAllocator());
                     if (xml.transform.has_value()) {
                         neuron.setProperty(transformProp, xml.transform.value());
                     }
@@ -268,16 +357,26 @@ namespace mindset
                         xml.node->addNeuron(neuronInDataset->getUID());
                     }
                 }
+                progress.addProgress(1);
             }
         }
 
-        invoke({LoaderStatusType::DONE, "Done", STAGES, 3});
+        lock.unlock();
+        progress.reportDone();
     }
 
     LoaderFactory XMLLoader::createFactory()
     {
+        std::vector<LoaderEnvironmentEntry> entries = {
+            {.name = XML_LOADER_ENTRY_THREADS,
+             .displayName = "Threads",
+             .type = typeid(size_t),
+             .defaultValue = static_cast<size_t>(0),
+             .hint = "Zero uses all available cores."},
+        };
+
         return LoaderFactory(
-            SWC_LOADER_ID, SWC_LOADER_NAME, true, {},
+            XML_LOADER_ID, XML_LOADER_NAME, true, entries,
             [](const std::string& name) {
                 std::string extension = std::filesystem::path(name).extension().string();
                 return extension == ".xml";
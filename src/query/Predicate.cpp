@@ -0,0 +1,231 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <mindset/query/Predicate.h>
+
+#include <mindset/DefaultProperties.h>
+
+namespace
+{
+    template<typename T>
+    bool tryInteger(const std::any& value, int64_t& out)
+    {
+        if (auto* v = std::any_cast<T>(&value)) {
+            out = static_cast<int64_t>(*v);
+            return true;
+        }
+        return false;
+    }
+} // namespace
+
+namespace mindset
+{
+    std::optional<int64_t> propertyAsInteger(const std::any& value)
+    {
+        int64_t result;
+        if (tryInteger<UID>(value, result) || tryInteger<int32_t>(value, result) ||
+            tryInteger<int64_t>(value, result) || tryInteger<uint64_t>(value, result) ||
+            tryInteger<NeuriteType>(value, result) || tryInteger<uint8_t>(value, result) ||
+            tryInteger<int8_t>(value, result) || tryInteger<uint16_t>(value, result) ||
+            tryInteger<int16_t>(value, result) || tryInteger<bool>(value, result)) {
+            return result;
+        }
+        return {};
+    }
+
+    std::optional<double> propertyAsNumber(const std::any& value)
+    {
+        if (auto* v = std::any_cast<float>(&value)) {
+            return *v;
+        }
+        if (auto* v = std::any_cast<double>(&value)) {
+            return *v;
+        }
+        if (auto integer = propertyAsInteger(value)) {
+            return static_cast<double>(*integer);
+        }
+        return {};
+    }
+
+    bool propertyEquals(const std::any& value, const PredicateValue& constant)
+    {
+        if (auto* integer = std::get_if<int64_t>(&constant)) {
+            if (auto v = propertyAsInteger(value)) {
+                return *v == *integer;
+            }
+            auto v = propertyAsNumber(value);
+            return v.has_value() && *v == static_cast<double>(*integer);
+        }
+        if (auto* number = std::get_if<double>(&constant)) {
+            auto v = propertyAsNumber(value);
+            return v.has_value() && *v == *number;
+        }
+        auto* string = std::any_cast<std::string>(&value);
+        return string != nullptr && *string == std::get<std::string>(constant);
+    }
+
+    Predicate::Predicate(PredicateType type) :
+        _type(type),
+        _min(-std::numeric_limits<double>::infinity()),
+        _max(std::numeric_limits<double>::infinity())
+    {
+    }
+
+    Predicate Predicate::always()
+    {
+        return Predicate(PredicateType::ALWAYS);
+    }
+
+    Predicate Predicate::equals(std::string property, PredicateValue value)
+    {
+        Predicate predicate(PredicateType::EQUALS);
+        predicate._property = std::move(property);
+        predicate._values.push_back(std::move(value));
+        return predicate;
+    }
+
+    Predicate Predicate::in(std::string property, std::vector<PredicateValue> values)
+    {
+        Predicate predicate(PredicateType::IN);
+        predicate._property = std::move(property);
+        predicate._values = std::move(values);
+        return predicate;
+    }
+
+    Predicate Predicate::range(std::string property, double min, double max)
+    {
+        Predicate predicate(PredicateType::RANGE);
+        predicate._property = std::move(property);
+        predicate._min = min;
+        predicate._max = max;
+        return predicate;
+    }
+
+    Predicate Predicate::atLeast(std::string property, double min)
+    {
+        return range(std::move(property), min, std::numeric_limits<double>::infinity());
+    }
+
+    Predicate Predicate::atMost(std::string property, double max)
+    {
+        return range(std::move(property), -std::numeric_limits<double>::infinity(), max);
+    }
+
+    Predicate Predicate::exists(std::string property)
+    {
+        Predicate predicate(PredicateType::EXISTS);
+        predicate._property = std::move(property);
+        return predicate;
+    }
+
+    Predicate Predicate::custom(Custom function)
+    {
+        Predicate predicate(PredicateType::CUSTOM);
+        predicate._custom = std::make_shared<const Custom>(std::move(function));
+        return predicate;
+    }
+
+    Predicate Predicate::all(std::vector<Predicate> predicates)
+    {
+        Predicate predicate(PredicateType::AND);
+        predicate._children = std::move(predicates);
+        return predicate;
+    }
+
+    Predicate Predicate::any(std::vector<Predicate> predicates)
+    {
+        Predicate predicate(PredicateType::OR);
+        predicate._children = std::move(predicates);
+        return predicate;
+    }
+
+    Predicate Predicate::negate(Predicate predicate)
+    {
+        Predicate result(PredicateType::NOT);
+        result._children.push_back(std::move(predicate));
+        return result;
+    }
+
+    PredicateType Predicate::getType() const
+    {
+        return _type;
+    }
+
+    const std::string& Predicate::getProperty() const
+    {
+        return _property;
+    }
+
+    const std::vector<PredicateValue>& Predicate::getValues() const
+    {
+        return _values;
+    }
+
+    double Predicate::getMin() const
+    {
+        return _min;
+    }
+
+    double Predicate::getMax() const
+    {
+        return _max;
+    }
+
+    const std::vector<Predicate>& Predicate::getChildren() const
+    {
+        return _children;
+    }
+
+    const Predicate::Custom* Predicate::getCustom() const
+    {
+        return _custom.get();
+    }
+
+    Predicate Predicate::operator&&(const Predicate& other) const
+    {
+        // Flatten chains of && to make index planning easier.
+        std::vector<Predicate> children;
+        for (const Predicate* p : {this, &other}) {
+            if (p->_type == PredicateType::AND) {
+                children.insert(children.end(), p->_children.begin(), p->_children.end());
+            } else {
+                children.push_back(*p);
+            }
+        }
+        return all(std::move(children));
+    }
+
+    Predicate Predicate::operator||(const Predicate& other) const
+    {
+        std::vector<Predicate> children;
+        for (const Predicate* p : {this, &other}) {
+            if (p->_type == PredicateType::OR) {
+                children.insert(children.end(), p->_children.begin(), p->_children.end());
+            } else {
+                children.push_back(*p);
+            }
+        }
+        return any(std::move(children));
+    }
+
+    Predicate Predicate::operator!() const
+    {
+        return negate(*this);
+    }
+} // namespace mindset
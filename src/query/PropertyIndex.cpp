@@ -0,0 +1,217 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <mindset/query/PropertyIndex.h>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <ranges>
+
+#include <mindset/util/Parallel.h>
+
+namespace
+{
+    constexpr size_t CHUNK_SIZE = 4096;
+
+    /// Integers below this magnitude are exactly representable as doubles.
+    constexpr double EXACT_INTEGER_LIMIT = 9007199254740992.0;
+
+    /**
+     * Returns the category of a floating-point number, matching propertyEquals():
+     * an integral number is equal to exactly one integer constant, and a non-integral one to none.
+     * Numbers too large to compare exactly have no category.
+     */
+    std::optional<int64_t> integralCategory(double number)
+    {
+        if (std::trunc(number) != number || std::abs(number) >= EXACT_INTEGER_LIMIT) {
+            return {};
+        }
+        return static_cast<int64_t>(number);
+    }
+} // namespace
+
+namespace mindset
+{
+    void CategoricalIndex::decode(const std::vector<uint64_t>& bitmap, std::vector<UID>& out) const
+    {
+        for (size_t word = 0; word < bitmap.size(); ++word) {
+            uint64_t bits = bitmap[word];
+            while (bits != 0) {
+                size_t bit = std::countr_zero(bits);
+                out.push_back(_elements[word * 64 + bit]);
+                bits &= bits - 1;
+            }
+        }
+    }
+
+    CategoricalIndex::CategoricalIndex(IndexedElements elements, UID property, size_t threads)
+    {
+        // Bits are assigned in UID order, so decoded bitmaps are already sorted.
+        std::ranges::sort(elements, {}, [](const auto& pair) { return pair.first; });
+
+        // Floating-point values are indexed by the integer they are equal to, so indexed lookups match scans.
+        std::vector<std::optional<int64_t>> values(elements.size());
+        std::atomic_bool exact = true;
+        parallelForChunks(
+            elements.size(), CHUNK_SIZE,
+            [&](size_t, size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    auto value = elements[i].second->getPropertyAsAnyPtr(property);
+                    if (!value.has_value()) {
+                        continue;
+                    }
+                    if (auto integer = propertyAsInteger(*value.value())) {
+                        values[i] = integer;
+                    } else if (auto number = propertyAsNumber(*value.value())) {
+                        values[i] = integralCategory(*number);
+                        if (!values[i].has_value() && std::trunc(*number) == *number) {
+                            exact.store(false, std::memory_order_relaxed);
+                        }
+                    }
+                }
+            },
+            threads);
+        _exact = exact.load();
+
+        size_t words = (elements.size() + 63) / 64;
+        _elements.reserve(elements.size());
+        for (size_t i = 0; i < elements.size(); ++i) {
+            _elements.push_back(elements[i].first);
+            if (!values[i].has_value()) {
+                continue;
+            }
+            auto& bitmap = _bitmaps[values[i].value()];
+            if (bitmap.empty()) {
+                bitmap.resize(words, 0);
+            }
+            bitmap[i / 64] |= uint64_t(1) << (i % 64);
+        }
+    }
+
+    std::vector<int64_t> CategoricalIndex::getCategories() const
+    {
+        std::vector<int64_t> result;
+        result.reserve(_bitmaps.size());
+        for (auto category : _bitmaps | std::views::keys) {
+            result.push_back(category);
+        }
+        std::ranges::sort(result);
+        return result;
+    }
+
+    UIDSet CategoricalIndex::find(int64_t value) const
+    {
+        auto it = _bitmaps.find(value);
+        if (it == _bitmaps.end()) {
+            return {};
+        }
+        std::vector<UID> result;
+        decode(it->second, result);
+        return UIDSet::fromSorted(std::move(result));
+    }
+
+    std::optional<UIDSet> CategoricalIndex::find(const std::vector<PredicateValue>& values) const
+    {
+        if (!_exact) {
+            return {};
+        }
+
+        std::vector<const std::vector<uint64_t>*> bitmaps;
+        for (auto& value : values) {
+            std::optional<int64_t> category;
+            if (auto* integer = std::get_if<int64_t>(&value)) {
+                category = *integer;
+            } else if (auto* number = std::get_if<double>(&value)) {
+                category = integralCategory(*number);
+            }
+            if (!category.has_value()) {
+                return {};
+            }
+            if (auto it = _bitmaps.find(category.value()); it != _bitmaps.end()) {
+                bitmaps.push_back(&it->second);
+            }
+        }
+
+        if (bitmaps.empty()) {
+            return UIDSet();
+        }
+        if (bitmaps.size() == 1) {
+            std::vector<UID> result;
+            decode(*bitmaps.front(), result);
+            return UIDSet::fromSorted(std::move(result));
+        }
+
+        std::vector<uint64_t> merged(bitmaps.front()->size(), 0);
+        for (auto* bitmap : bitmaps) {
+            for (size_t i = 0; i < merged.size(); ++i) {
+                merged[i] |= (*bitmap)[i];
+            }
+        }
+
+        std::vector<UID> result;
+        decode(merged, result);
+        return UIDSet::fromSorted(std::move(result));
+    }
+
+    RangeIndex::RangeIndex(const IndexedElements& elements, UID property, size_t threads)
+    {
+        std::vector<std::optional<double>> values(elements.size());
+        parallelForChunks(
+            elements.size(), CHUNK_SIZE,
+            [&](size_t, size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    if (auto value = elements[i].second->getPropertyAsAnyPtr(property)) {
+                        values[i] = propertyAsNumber(*value.value());
+                    }
+                }
+            },
+            threads);
+
+        _entries.reserve(elements.size());
+        for (size_t i = 0; i < elements.size(); ++i) {
+            if (values[i].has_value()) {
+                _entries.emplace_back(values[i].value(), elements[i].first);
+            }
+        }
+        std::ranges::sort(_entries);
+    }
+
+    UIDSet RangeIndex::find(double min, double max) const
+    {
+        auto begin = std::ranges::lower_bound(_entries, min, {}, [](const auto& entry) { return entry.first; });
+        auto end = std::ranges::upper_bound(_entries, max, {}, [](const auto& entry) { return entry.first; });
+        if (begin >= end) {
+            return {};
+        }
+
+        std::vector<UID> result;
+        result.reserve(end - begin);
+        for (auto it = begin; it != end; ++it) {
+            result.push_back(it->second);
+        }
+        return UIDSet(std::move(result));
+    }
+
+    size_t RangeIndex::size() const
+    {
+        return _entries.size();
+    }
+} // namespace mindset
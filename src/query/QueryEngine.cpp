@@ -0,0 +1,390 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <mindset/query/QueryEngine.h>
+
+#include <algorithm>
+#include <ranges>
+
+#include <mindset/util/Parallel.h>
+#include <mindset/util/Trace.h>
+
+namespace
+{
+    using namespace mindset;
+
+    constexpr size_t CHUNK_SIZE = 1024;
+
+    /**
+     * A predicate whose property names have been resolved to UIDs.
+     */
+    struct ResolvedPredicate
+    {
+        const Predicate* predicate;
+        std::optional<UID> property;
+        std::vector<ResolvedPredicate> children;
+    };
+
+    ResolvedPredicate resolve(const Predicate& predicate, const Properties& properties)
+    {
+        ResolvedPredicate result{&predicate, {}, {}};
+        if (!predicate.getProperty().empty()) {
+            result.property = properties.getPropertyUID(predicate.getProperty());
+        }
+        result.children.reserve(predicate.getChildren().size());
+        for (auto& child : predicate.getChildren()) {
+            result.children.push_back(resolve(child, properties));
+        }
+        return result;
+    }
+
+    bool matches(const ResolvedPredicate& resolved, UID uid, const PropertyHolder& holder)
+    {
+        auto& predicate = *resolved.predicate;
+        switch (predicate.getType()) {
+            case PredicateType::ALWAYS:
+                return true;
+            case PredicateType::EQUALS:
+            case PredicateType::IN: {
+                if (!resolved.property) {
+                    return false;
+                }
+                auto value = holder.getPropertyAsAnyPtr(resolved.property.value());
+                if (!value) {
+                    return false;
+                }
+                return std::ranges::any_of(predicate.getValues(), [&](const PredicateValue& constant) {
+                    return propertyEquals(*value.value(), constant);
+                });
+            }
+            case PredicateType::RANGE: {
+                if (!resolved.property) {
+                    return false;
+                }
+                auto value = holder.getPropertyAsAnyPtr(resolved.property.value());
+                if (!value) {
+                    return false;
+                }
+                auto number = propertyAsNumber(*value.value());
+                return number && number.value() >= predicate.getMin() && number.value() <= predicate.getMax();
+            }
+            case PredicateType::EXISTS:
+                return resolved.property && holder.hasProperty(resolved.property.value());
+            case PredicateType::AND:
+                return std::ranges::all_of(resolved.children,
+                                           [&](const ResolvedPredicate& child) { return matches(child, uid, holder); });
+            case PredicateType::OR:
+                return std::ranges::any_of(resolved.children,
+                                           [&](const ResolvedPredicate& child) { return matches(child, uid, holder); });
+            case PredicateType::NOT:
+                return !matches(resolved.children.front(), uid, holder);
+            case PredicateType::CUSTOM:
+                return (*predicate.getCustom())(uid, holder);
+        }
+        return false;
+    }
+
+    /**
+     * Evaluates the given conditions over the elements in parallel.
+     * An element matches if it matches every condition.
+     */
+    UIDSet scan(const std::vector<const ResolvedPredicate*>& conditions, const IndexedElements& elements,
+                size_t threads)
+    {
+        size_t workers = std::min(threads == 0 ? defaultThreadCount() : threads,
+                                  std::max<size_t>(1, (elements.size() + CHUNK_SIZE - 1) / CHUNK_SIZE));
+        std::vector<std::vector<UID>> partial(workers);
+
+        parallelForChunks(
+            elements.size(), CHUNK_SIZE,
+            [&](size_t thread, size_t begin, size_t end) {
+                auto& out = partial[thread];
+                for (size_t i = begin; i < end; ++i) {
+                    auto [uid, holder] = elements[i];
+                    bool match = std::ranges::all_of(conditions, [&](const ResolvedPredicate* condition) {
+                        return matches(*condition, uid, *holder);
+                    });
+                    if (match) {
+                        out.push_back(uid);
+                    }
+                }
+            },
+            workers);
+
+        std::vector<UID> result;
+        size_t total = 0;
+        for (auto& part : partial) {
+            total += part.size();
+        }
+        result.reserve(total);
+        for (auto& part : partial) {
+            result.insert(result.end(), part.begin(), part.end());
+        }
+        return UIDSet(std::move(result));
+    }
+
+    struct Planner
+    {
+        const std::unordered_map<UID, CategoricalIndex>* categorical;
+        const std::unordered_map<UID, RangeIndex>* range;
+        std::function<const IndexedElements&()> elements;
+        const QueryEngine::Lookup& lookup;
+        size_t threads;
+        std::optional<UIDSet> all;
+
+        const UIDSet& getAll()
+        {
+            if (!all) {
+                auto& source = elements();
+                std::vector<UID> uids;
+                uids.reserve(source.size());
+                for (auto uid : source | std::views::keys) {
+                    uids.push_back(uid);
+                }
+                all = UIDSet(std::move(uids));
+            }
+            return all.value();
+        }
+
+        /**
+         * Answers the predicate using the indexes, if possible.
+         */
+        std::optional<UIDSet> plan(const ResolvedPredicate& resolved)
+        {
+            auto& predicate = *resolved.predicate;
+            switch (predicate.getType()) {
+                case PredicateType::ALWAYS:
+                    return getAll();
+                case PredicateType::EQUALS:
+                case PredicateType::IN: {
+                    if (!resolved.property) {
+                        return UIDSet();
+                    }
+                    auto it = categorical->find(resolved.property.value());
+                    if (it == categorical->end()) {
+                        return {};
+                    }
+                    return it->second.find(predicate.getValues());
+                }
+                case PredicateType::RANGE: {
+                    if (!resolved.property) {
+                        return UIDSet();
+                    }
+                    auto it = range->find(resolved.property.value());
+                    if (it == range->end()) {
+                        return {};
+                    }
+                    return it->second.find(predicate.getMin(), predicate.getMax());
+                }
+                case PredicateType::AND:
+                    return planAnd(resolved);
+                case PredicateType::OR: {
+                    UIDSet result;
+                    for (auto& child : resolved.children) {
+                        auto set = plan(child);
+                        if (!set) {
+                            return {};
+                        }
+                        result = result.unite(set.value());
+                    }
+                    return result;
+                }
+                case PredicateType::NOT: {
+                    auto set = plan(resolved.children.front());
+                    if (!set) {
+                        return {};
+                    }
+                    return getAll().subtract(set.value());
+                }
+                default:
+                    return {};
+            }
+        }
+
+        std::optional<UIDSet> planAnd(const ResolvedPredicate& resolved)
+        {
+            std::optional<UIDSet> candidates;
+            std::vector<const ResolvedPredicate*> remaining;
+            for (auto& child : resolved.children) {
+                // Once the candidates are empty, nothing else needs to be evaluated.
+                if (candidates && candidates->empty()) {
+                    return candidates;
+                }
+                if (auto set = plan(child)) {
+                    candidates = candidates ? candidates->intersect(set.value()) : std::move(set);
+                } else {
+                    remaining.push_back(&child);
+                }
+            }
+
+            if (!candidates) {
+                return {};
+            }
+            if (remaining.empty() || candidates->empty()) {
+                return candidates;
+            }
+
+            IndexedElements filtered;
+            filtered.reserve(candidates->size());
+            for (UID uid : candidates.value()) {
+                if (auto holder = lookup(uid)) {
+                    filtered.emplace_back(uid, holder.value());
+                }
+            }
+
+            return scan(remaining, filtered, threads);
+        }
+    };
+} // namespace
+
+namespace mindset
+{
+    QueryEngine::QueryEngine(const Dataset& dataset) :
+        _dataset(&dataset)
+    {
+    }
+
+    IndexedElements QueryEngine::neuronElements() const
+    {
+        IndexedElements elements;
+        elements.reserve(_dataset->getNeuronsAmount());
+        for (const Neuron* neuron : _dataset->getNonContextualizedNeurons()) {
+            elements.emplace_back(neuron->getUID(), neuron);
+        }
+        return elements;
+    }
+
+    IndexedElements QueryEngine::synapseElements() const
+    {
+        IndexedElements elements;
+        for (const Synapse* synapse : _dataset->getCircuit().getSynapses()) {
+            elements.emplace_back(synapse->getUID(), synapse);
+        }
+        return elements;
+    }
+
+    void QueryEngine::rebuild(Indexes& indexes, const IndexedElements& elements, uint64_t version,
+                              size_t threads) const
+    {
+        indexes.categorical.clear();
+        indexes.range.clear();
+
+        auto& properties = _dataset->getProperties();
+        for (auto& [name, type] : indexes.requested) {
+            auto uid = properties.getPropertyUID(name);
+            if (!uid) {
+                continue;
+            }
+            switch (type) {
+                case IndexType::CATEGORICAL:
+                    indexes.categorical.emplace(uid.value(), CategoricalIndex(elements, uid.value(), threads));
+                    break;
+                case IndexType::RANGE:
+                    indexes.range.emplace(uid.value(), RangeIndex(elements, uid.value(), threads));
+                    break;
+            }
+        }
+
+        indexes.version = version;
+        indexes.built = true;
+    }
+
+    void QueryEngine::addNeuronIndex(std::string property, IndexType type)
+    {
+        _neuronIndexes.requested[std::move(property)] = type;
+    }
+
+    void QueryEngine::addSynapseIndex(std::string property, IndexType type)
+    {
+        _synapseIndexes.requested[std::move(property)] = type;
+    }
+
+    void QueryEngine::rebuildIndexes(size_t threads)
+    {
+        MINDSET_TRACE_SCOPE("QueryEngine::rebuildIndexes");
+        if (!_neuronIndexes.requested.empty()) {
+            rebuild(_neuronIndexes, neuronElements(), _dataset->getVersion(), threads);
+        }
+        if (!_synapseIndexes.requested.empty()) {
+            rebuild(_synapseIndexes, synapseElements(), _dataset->getCircuit().getVersion(), threads);
+        }
+    }
+
+    bool QueryEngine::areNeuronIndexesUpToDate() const
+    {
+        return _neuronIndexes.built && _neuronIndexes.version == _dataset->getVersion();
+    }
+
+    bool QueryEngine::areSynapseIndexesUpToDate() const
+    {
+        return _synapseIndexes.built && _synapseIndexes.version == _dataset->getCircuit().getVersion();
+    }
+
+    UIDSet QueryEngine::query(const Indexes& indexes, const Collector& collector, const Lookup& lookup,
+                              uint64_t version, const Predicate& predicate, size_t threads) const
+    {
+        static const std::unordered_map<UID, CategoricalIndex> NO_CATEGORICAL;
+        static const std::unordered_map<UID, RangeIndex> NO_RANGE;
+
+        auto resolved = resolve(predicate, _dataset->getProperties());
+
+        // Elements are only collected if the indexes can't answer the query by themselves.
+        std::optional<IndexedElements> elements;
+        auto getElements = [&]() -> const IndexedElements& {
+            if (!elements) {
+                elements = collector();
+            }
+            return elements.value();
+        };
+
+        bool upToDate = indexes.built && indexes.version == version;
+        Planner planner{
+            upToDate ? &indexes.categorical : &NO_CATEGORICAL,
+            upToDate ? &indexes.range : &NO_RANGE,
+            getElements,
+            lookup,
+            threads,
+            {}
+        };
+        if (auto result = planner.plan(resolved)) {
+            return std::move(result.value());
+        }
+        return scan({&resolved}, getElements(), threads);
+    }
+
+    UIDSet QueryEngine::queryNeurons(const Predicate& predicate, size_t threads) const
+    {
+        MINDSET_TRACE_SCOPE("QueryEngine::queryNeurons");
+        Lookup lookup = [this](UID uid) -> std::optional<const PropertyHolder*> {
+            return _dataset->getNeuron(uid);
+        };
+        return query(_neuronIndexes, [this] { return neuronElements(); }, lookup, _dataset->getVersion(), predicate,
+                     threads);
+    }
+
+    UIDSet QueryEngine::querySynapses(const Predicate& predicate, size_t threads) const
+    {
+        MINDSET_TRACE_SCOPE("QueryEngine::querySynapses");
+        Lookup lookup = [this](UID uid) -> std::optional<const PropertyHolder*> {
+            return _dataset->getCircuit().getSynapse(uid);
+        };
+        return query(_synapseIndexes, [this] { return synapseElements(); }, lookup,
+                     _dataset->getCircuit().getVersion(), predicate, threads);
+    }
+} // namespace mindset
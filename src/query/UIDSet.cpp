@@ -0,0 +1,99 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <mindset/query/UIDSet.h>
+
+#include <iterator>
+
+namespace mindset
+{
+    UIDSet::UIDSet(std::vector<UID> uids) :
+        _uids(std::move(uids))
+    {
+        std::ranges::sort(_uids);
+        auto [first, last] = std::ranges::unique(_uids);
+        _uids.erase(first, last);
+    }
+
+    UIDSet::UIDSet(std::initializer_list<UID> uids) :
+        UIDSet(std::vector<UID>(uids))
+    {
+    }
+
+    UIDSet UIDSet::fromSorted(std::vector<UID> uids)
+    {
+        UIDSet set;
+        set._uids = std::move(uids);
+        return set;
+    }
+
+    bool UIDSet::contains(UID uid) const
+    {
+        return std::ranges::binary_search(_uids, uid);
+    }
+
+    size_t UIDSet::size() const
+    {
+        return _uids.size();
+    }
+
+    bool UIDSet::empty() const
+    {
+        return _uids.empty();
+    }
+
+    UIDSet::const_iterator UIDSet::begin() const
+    {
+        return _uids.begin();
+    }
+
+    UIDSet::const_iterator UIDSet::end() const
+    {
+        return _uids.end();
+    }
+
+    const std::vector<UID>& UIDSet::getUIDs() const
+    {
+        return _uids;
+    }
+
+    UIDSet UIDSet::intersect(const UIDSet& other) const
+    {
+        std::vector<UID> result;
+        result.reserve(std::min(size(), other.size()));
+        std::ranges::set_intersection(_uids, other._uids, std::back_inserter(result));
+        return fromSorted(std::move(result));
+    }
+
+    UIDSet UIDSet::unite(const UIDSet& other) const
+    {
+        std::vector<UID> result;
+        result.reserve(size() + other.size());
+        std::ranges::set_union(_uids, other._uids, std::back_inserter(result));
+        return fromSorted(std::move(result));
+    }
+
+    UIDSet UIDSet::subtract(const UIDSet& other) const
+    {
+        std::vector<UID> result;
+        result.reserve(size());
+        std::ranges::set_difference(_uids, other._uids, std::back_inserter(result));
+        return fromSorted(std::move(result));
+    }
+} // namespace mindset
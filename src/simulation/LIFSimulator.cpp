@@ -0,0 +1,329 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <mindset/simulation/LIFSimulator.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <optional>
+
+#include <mindset/Activity.h>
+#include <mindset/query/Predicate.h>
+#include <mindset/util/Parallel.h>
+#include <mindset/util/Trace.h>
+
+namespace
+{
+    constexpr size_t CHUNK_SIZE = 1024;
+
+    struct PackedSynapse
+    {
+        uint32_t target;
+        float weight;
+        uint32_t delay;
+    };
+
+    uint64_t mix(uint64_t value)
+    {
+        // SplitMix64 finalizer.
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+        return value ^ (value >> 31);
+    }
+
+    /**
+     * Returns a uniform number in [0, 1) that only depends on its arguments.
+     */
+    double uniform(uint64_t seed, uint64_t step, uint64_t neuron)
+    {
+        uint64_t bits = mix(seed + mix(step + mix(neuron)));
+        return static_cast<double>(bits >> 11) * 0x1.0p-53;
+    }
+
+    uint64_t toSteps(std::chrono::nanoseconds duration, std::chrono::nanoseconds timestep)
+    {
+        if (duration <= std::chrono::nanoseconds::zero()) {
+            return 0;
+        }
+        return static_cast<uint64_t>((duration + timestep / 2) / timestep);
+    }
+
+    std::optional<double> getNumber(const mindset::Synapse& synapse, std::optional<mindset::UID> property)
+    {
+        if (!property.has_value()) {
+            return {};
+        }
+        auto value = synapse.getPropertyAsAnyPtr(property.value());
+        if (!value.has_value()) {
+            return {};
+        }
+        return mindset::propertyAsNumber(*value.value());
+    }
+} // namespace
+
+namespace mindset
+{
+    LIFSimulator::LIFSimulator(const Dataset& dataset, const LIFSimulationSettings& settings) :
+        _settings(settings),
+        _ringSize(0),
+        _step(0)
+    {
+        MINDSET_TRACE_SCOPE("LIFSimulator::LIFSimulator");
+        _settings.timestep = std::max(_settings.timestep, std::chrono::nanoseconds(1));
+
+        _neurons.reserve(dataset.getNeuronsAmount());
+        for (UID uid : dataset.getNeuronsUIDs()) {
+            _neurons.push_back(uid);
+        }
+        std::ranges::sort(_neurons);
+        std::unordered_map<UID, uint32_t> indices;
+        indices.reserve(_neurons.size());
+        for (size_t i = 0; i < _neurons.size(); ++i) {
+            indices.emplace(_neurons[i], static_cast<uint32_t>(i));
+        }
+
+        auto weightProperty = dataset.getProperties().getPropertyUID(_settings.weightProperty);
+        auto delayProperty = dataset.getProperties().getPropertyUID(_settings.delayProperty);
+        auto defaultDelay = static_cast<uint32_t>(toSteps(_settings.defaultDelay, _settings.timestep));
+
+        size_t neurons = _neurons.size();
+        const Circuit& circuit = dataset.getCircuit();
+        std::vector<std::vector<PackedSynapse>> chunks((neurons + CHUNK_SIZE - 1) / CHUNK_SIZE);
+        _offsets.assign(neurons + 1, 0);
+        parallelForChunks(
+            neurons, CHUNK_SIZE,
+            [&](size_t, size_t begin, size_t end) {
+                auto& packed = chunks[begin / CHUNK_SIZE];
+                for (size_t row = begin; row < end; ++row) {
+                    size_t first = packed.size();
+                    for (const Synapse& synapse : circuit.getPreSynapses(_neurons[row])) {
+                        auto it = indices.find(synapse.getPostSynapticNeuron());
+                        if (it == indices.end()) {
+                            continue;
+                        }
+
+                        uint32_t delay = defaultDelay;
+                        auto milliseconds = getNumber(synapse, delayProperty);
+                        if (milliseconds.has_value() && !std::isnan(milliseconds.value())) {
+                            delay = static_cast<uint32_t>(toSteps(
+                                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                    std::chrono::duration<double, std::milli>(milliseconds.value())),
+                                _settings.timestep));
+                        }
+                        auto weight = getNumber(synapse, weightProperty);
+                        packed.push_back({it->second, static_cast<float>(weight.value_or(_settings.defaultWeight)),
+                                          std::max<uint32_t>(delay, 1)});
+                    }
+                    std::sort(packed.begin() + first, packed.end(),
+                              [](const auto& a, const auto& b) { return a.target < b.target; });
+                    _offsets[row + 1] = packed.size() - first;
+                }
+            },
+            _settings.threads);
+
+        std::partial_sum(_offsets.begin(), _offsets.end(), _offsets.begin());
+        size_t synapses = _offsets.back();
+        _targets.resize(synapses);
+        _weights.resize(synapses);
+        _delays.resize(synapses);
+        parallelFor(
+            chunks.size(),
+            [&](size_t chunk) {
+                uint64_t offset = _offsets[chunk * CHUNK_SIZE];
+                for (const auto& synapse : chunks[chunk]) {
+                    _targets[offset] = synapse.target;
+                    _weights[offset] = synapse.weight;
+                    _delays[offset] = synapse.delay;
+                    ++offset;
+                }
+                chunks[chunk] = {};
+            },
+            _settings.threads);
+
+        // Spikes land at most the longest delay ahead of the current step.
+        uint32_t maxDelay = _delays.empty() ? 1 : std::ranges::max(_delays);
+        _ringSize = maxDelay + 1;
+        _ring.assign(_ringSize * neurons, 0.0f);
+        _voltages.assign(neurons, _settings.neuron.restingPotential);
+        _currents.assign(neurons, 0.0);
+        _refractoryUntil.assign(neurons, 0);
+    }
+
+    size_t LIFSimulator::getNeuronsAmount() const
+    {
+        return _neurons.size();
+    }
+
+    size_t LIFSimulator::getSynapsesAmount() const
+    {
+        return _targets.size();
+    }
+
+    std::span<const UID> LIFSimulator::getNeurons() const
+    {
+        return _neurons;
+    }
+
+    std::chrono::nanoseconds LIFSimulator::getTime() const
+    {
+        return _settings.timestep * static_cast<int64_t>(_step);
+    }
+
+    std::span<const double> LIFSimulator::getVoltages() const
+    {
+        return _voltages;
+    }
+
+    void LIFSimulator::run(std::chrono::nanoseconds duration)
+    {
+        MINDSET_TRACE_SCOPE("LIFSimulator::run");
+        auto& neuron = _settings.neuron;
+        auto timestep = _settings.timestep;
+        uint64_t steps = duration <= std::chrono::nanoseconds::zero()
+                             ? 0
+                             : static_cast<uint64_t>((duration + timestep - std::chrono::nanoseconds(1)) / timestep);
+        size_t neurons = _neurons.size();
+
+        // Exact propagators of the linear dynamics over one timestep.
+        double h = std::chrono::duration<double>(timestep).count();
+        double tauM = std::chrono::duration<double>(neuron.membraneTimeConstant).count();
+        double tauS = std::chrono::duration<double>(neuron.synapticTimeConstant).count();
+        double decayM = std::exp(-h / tauM);
+        double decayS = std::exp(-h / tauS);
+        double currentToVoltage =
+            std::abs(tauS - tauM) < 1e-12 ? h / tauM * decayM : tauS / (tauS - tauM) * (decayS - decayM);
+        double drive = (neuron.restingPotential + neuron.externalInput) * (1.0 - decayM);
+
+        uint64_t refractory = toSteps(neuron.refractoryPeriod, timestep);
+        double backgroundProbability = std::min(1.0, _settings.backgroundRate * h);
+        uint64_t sampleEvery = _settings.voltageDelta > std::chrono::nanoseconds::zero()
+                                   ? std::max<uint64_t>(1, toSteps(_settings.voltageDelta, timestep))
+                                   : 0;
+
+        // Steps take microseconds: the workers are created once for the whole run.
+        ThreadPool pool(_settings.threads);
+        std::vector<std::vector<uint32_t>> chunkSpikes((neurons + CHUNK_SIZE - 1) / CHUNK_SIZE);
+        for (uint64_t end = _step + steps; _step < end; ++_step) {
+            uint64_t step = _step;
+            double* sample = nullptr;
+            if (sampleEvery != 0 && step % sampleEvery == 0) {
+                sample = _voltageSamples.emplace_back(neurons).data();
+            }
+            float* arriving = _ring.data() + (step % _ringSize) * neurons;
+
+            pool.forChunks(neurons, CHUNK_SIZE, [&](size_t, size_t begin, size_t end) {
+                // Delivers the spikes of the previous step to the neurons of this partition.
+                // Rows are sorted by target, so the partition's synapses are contiguous.
+                for (uint32_t pre : _spiking) {
+                    auto first = _targets.begin() + static_cast<ptrdiff_t>(_offsets[pre]);
+                    auto last = _targets.begin() + static_cast<ptrdiff_t>(_offsets[pre + 1]);
+                    for (auto it = std::lower_bound(first, last, begin); it != last && *it < end; ++it) {
+                        auto synapse = static_cast<size_t>(it - _targets.begin());
+                        size_t slot = (step - 1 + _delays[synapse]) % _ringSize;
+                        _ring[slot * neurons + *it] += _weights[synapse];
+                    }
+                }
+
+                auto& spikes = chunkSpikes[begin / CHUNK_SIZE];
+                spikes.clear();
+                for (size_t i = begin; i < end; ++i) {
+                    if (sample != nullptr) {
+                        sample[i] = _voltages[i];
+                    }
+
+                    double input = arriving[i];
+                    arriving[i] = 0.0f;
+                    if (backgroundProbability > 0.0 && uniform(_settings.seed, step, i) < backgroundProbability) {
+                        input += _settings.backgroundWeight;
+                    }
+
+                    double voltage = _voltages[i] * decayM + drive + _currents[i] * currentToVoltage;
+                    _currents[i] = _currents[i] * decayS + input;
+                    if (step < _refractoryUntil[i]) {
+                        voltage = neuron.resetPotential;
+                    } else if (voltage >= neuron.threshold) {
+                        voltage = neuron.resetPotential;
+                        _refractoryUntil[i] = step + 1 + refractory;
+                        spikes.push_back(static_cast<uint32_t>(i));
+                    }
+                    _voltages[i] = voltage;
+                }
+            });
+
+            // Spikes happen at the end of the step.
+            _spiking.clear();
+            for (auto& spikes : chunkSpikes) {
+                for (uint32_t index : spikes) {
+                    _spiking.push_back(index);
+                    _spikes.emplace_back(step + 1, index);
+                }
+            }
+        }
+    }
+
+    size_t LIFSimulator::getSpikesAmount() const
+    {
+        return _spikes.size();
+    }
+
+    EventSequence<std::monostate> LIFSimulator::getSpikes() const
+    {
+        EventSequence<std::monostate> sequence;
+        auto& events = sequence.getEvents();
+        // Spikes are recorded in chronological order, so every event goes at the end.
+        for (auto [step, index] : _spikes) {
+            events.insert(events.end(),
+                          {_neurons[index], _settings.timestep * static_cast<int64_t>(step), std::monostate()});
+        }
+        sequence.incrementVersion();
+        return sequence;
+    }
+
+    TimeGrid<double> LIFSimulator::getVoltageGrid() const
+    {
+        uint64_t sampleEvery = std::max<uint64_t>(1, toSteps(_settings.voltageDelta, _settings.timestep));
+        TimeGrid<double> grid(_settings.timestep * static_cast<int64_t>(sampleEvery));
+        grid.defineUIDs(_neurons);
+        for (const auto& sample : _voltageSamples) {
+            grid.addTimestep(sample);
+        }
+        return grid;
+    }
+
+    UID LIFSimulator::writeActivity(Dataset& dataset) const
+    {
+        auto spikes = getSpikes();
+        std::optional<TimeGrid<double>> voltages;
+        if (!_voltageSamples.empty()) {
+            voltages = getVoltageGrid();
+        }
+
+        auto lock = dataset.writeLock();
+        auto& properties = dataset.getProperties();
+        Activity activity(dataset.findSmallestAvailableActivityUID(), dataset.getAllocator());
+        activity.setProperty(properties.defineProperty(PROPERTY_ACTIVITY_SPIKES), std::move(spikes));
+        if (voltages) {
+            activity.setProperty(properties.defineProperty(PROPERTY_ACTIVITY_VOLTAGE), std::move(voltages.value()));
+        }
+        UID uid = activity.getUID();
+        dataset.addActivity(std::move(activity));
+        return uid;
+    }
+} // namespace mindset
@@ -0,0 +1,277 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <mindset/simulation/SpikePropagation.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <optional>
+
+#include <mindset/query/Predicate.h>
+#include <mindset/util/Parallel.h>
+#include <mindset/util/Trace.h>
+
+namespace
+{
+    constexpr size_t CHUNK_SIZE = 256;
+    constexpr size_t SPIKE_CHUNK_SIZE = 64;
+
+    struct PackedSynapse
+    {
+        mindset::UID synapse;
+        uint32_t target;
+        std::chrono::nanoseconds delay;
+        float efficacy;
+    };
+
+    int64_t floorDivide(int64_t value, int64_t divisor)
+    {
+        int64_t quotient = value / divisor;
+        return quotient * divisor > value ? quotient - 1 : quotient;
+    }
+
+    std::optional<double> getNumber(const mindset::Synapse& synapse, std::optional<mindset::UID> property)
+    {
+        if (!property.has_value()) {
+            return {};
+        }
+        auto value = synapse.getPropertyAsAnyPtr(property.value());
+        if (!value.has_value()) {
+            return {};
+        }
+        return mindset::propertyAsNumber(*value.value());
+    }
+} // namespace
+
+namespace mindset
+{
+    SpikePropagator::SpikePropagator(const Dataset& dataset, const SpikePropagationSettings& settings) :
+        _maxDelay(std::chrono::nanoseconds::zero()),
+        _window(std::max(settings.window, std::chrono::nanoseconds(1))),
+        _threads(settings.threads)
+    {
+        MINDSET_TRACE_SCOPE("SpikePropagator::SpikePropagator");
+        _neurons.reserve(dataset.getNeuronsAmount());
+        for (UID uid : dataset.getNeuronsUIDs()) {
+            _neurons.push_back(uid);
+        }
+        std::ranges::sort(_neurons);
+        _indices.reserve(_neurons.size());
+        for (size_t i = 0; i < _neurons.size(); ++i) {
+            _indices.emplace(_neurons[i], static_cast<uint32_t>(i));
+        }
+
+        auto delayProperty = dataset.getProperties().getPropertyUID(settings.delayProperty);
+        auto efficacyProperty = dataset.getProperties().getPropertyUID(settings.efficacyProperty);
+        auto defaultDelay = std::max(settings.defaultDelay, std::chrono::nanoseconds::zero());
+
+        size_t neurons = _neurons.size();
+        const Circuit& circuit = dataset.getCircuit();
+        std::vector<std::vector<PackedSynapse>> chunks((neurons + CHUNK_SIZE - 1) / CHUNK_SIZE);
+        _offsets.assign(neurons + 1, 0);
+        parallelForChunks(
+            neurons, CHUNK_SIZE,
+            [&](size_t, size_t begin, size_t end) {
+                auto& packed = chunks[begin / CHUNK_SIZE];
+                for (size_t row = begin; row < end; ++row) {
+                    size_t first = packed.size();
+                    for (const Synapse& synapse : circuit.getPreSynapses(_neurons[row])) {
+                        auto it = _indices.find(synapse.getPostSynapticNeuron());
+                        if (it == _indices.end()) {
+                            continue;
+                        }
+
+                        auto delay = defaultDelay;
+                        auto milliseconds = getNumber(synapse, delayProperty);
+                        if (milliseconds.has_value() && !std::isnan(milliseconds.value())) {
+                            delay = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::duration<double, std::milli>(std::max(milliseconds.value(), 0.0)));
+                        }
+                        auto efficacy = getNumber(synapse, efficacyProperty);
+                        packed.push_back({synapse.getUID(), it->second, delay,
+                                          static_cast<float>(efficacy.value_or(settings.defaultEfficacy))});
+                    }
+                    std::sort(packed.begin() + first, packed.end(),
+                              [](const auto& a, const auto& b) { return a.synapse < b.synapse; });
+                    _offsets[row + 1] = packed.size() - first;
+                }
+            },
+            settings.threads);
+
+        std::partial_sum(_offsets.begin(), _offsets.end(), _offsets.begin());
+        size_t synapses = _offsets.back();
+        _synapses.resize(synapses);
+        _targets.resize(synapses);
+        _delays.resize(synapses);
+        _efficacies.resize(synapses);
+        parallelFor(
+            chunks.size(),
+            [&](size_t chunk) {
+                uint64_t offset = _offsets[chunk * CHUNK_SIZE];
+                for (const auto& synapse : chunks[chunk]) {
+                    _synapses[offset] = synapse.synapse;
+                    _targets[offset] = synapse.target;
+                    _delays[offset] = synapse.delay;
+                    _efficacies[offset] = synapse.efficacy;
+                    ++offset;
+                }
+                chunks[chunk] = {};
+            },
+            settings.threads);
+
+        if (!_delays.empty()) {
+            _maxDelay = std::ranges::max(_delays);
+        }
+    }
+
+    std::span<const UID> SpikePropagator::getNeurons() const
+    {
+        return _neurons;
+    }
+
+    size_t SpikePropagator::getSynapsesAmount() const
+    {
+        return _synapses.size();
+    }
+
+    std::chrono::nanoseconds SpikePropagator::getMaxDelay() const
+    {
+        return _maxDelay;
+    }
+
+    void SpikePropagator::propagate(const EventSequence<std::monostate>& spikes,
+                                    const std::function<void(std::span<const SpikeArrival>)>& callback) const
+    {
+        MINDSET_TRACE_SCOPE("SpikePropagator::propagate");
+        auto& events = spikes.getEvents();
+        if (events.empty()) {
+            return;
+        }
+
+        int64_t window = _window.count();
+        auto getWindow = [window](std::chrono::nanoseconds time) { return floorDivide(time.count(), window); };
+
+        // Arrivals land at most _maxDelay after the window of their spike, so the ring never wraps onto
+        // a bucket still waiting to be delivered. Each worker has its own ring.
+        auto ring = static_cast<size_t>(_maxDelay.count() / window + 2);
+        auto getSlot = [ring](int64_t index) {
+            auto slot = static_cast<int64_t>(index % static_cast<int64_t>(ring));
+            return static_cast<size_t>(slot < 0 ? slot + static_cast<int64_t>(ring) : slot);
+        };
+        // Windows usually hold few spikes: the workers are created once instead of once per window.
+        ThreadPool pool(_threads);
+        size_t threads = pool.getThreadsAmount();
+        std::vector<std::vector<SpikeArrival>> buckets(threads * ring);
+
+        std::vector<std::pair<uint32_t, std::chrono::nanoseconds>> windowSpikes;
+        std::vector<SpikeArrival> ready;
+        uint64_t pending = 0;
+
+        auto next = events.begin();
+        for (int64_t current = getWindow(next->timepoint);; ++current) {
+            if (pending == 0) {
+                // Nothing is scheduled: jump over the windows without spikes.
+                if (next == events.end()) {
+                    break;
+                }
+                current = std::max(current, getWindow(next->timepoint));
+            }
+
+            windowSpikes.clear();
+            while (next != events.end() && getWindow(next->timepoint) == current) {
+                auto it = _indices.find(next->uid);
+                if (it != _indices.end() && _offsets[it->second] != _offsets[it->second + 1]) {
+                    windowSpikes.emplace_back(it->second, next->timepoint);
+                    pending += _offsets[it->second + 1] - _offsets[it->second];
+                }
+                ++next;
+            }
+
+            pool.forChunks(windowSpikes.size(), SPIKE_CHUNK_SIZE, [&](size_t thread, size_t begin, size_t end) {
+                auto* ownRing = buckets.data() + thread * ring;
+                for (size_t i = begin; i < end; ++i) {
+                    auto [neuron, time] = windowSpikes[i];
+                    for (uint64_t synapse = _offsets[neuron]; synapse < _offsets[neuron + 1]; ++synapse) {
+                        auto arrival = time + _delays[synapse];
+                        uint32_t target = _targets[synapse];
+                        ownRing[getSlot(getWindow(arrival))].push_back(
+                            {arrival, _synapses[synapse], _neurons[target], target, _efficacies[synapse]});
+                    }
+                }
+            });
+
+            // No later spike can arrive before the end of this window: deliver it.
+            size_t slot = getSlot(current);
+            ready.clear();
+            for (size_t thread = 0; thread < threads; ++thread) {
+                auto& bucket = buckets[thread * ring + slot];
+                ready.insert(ready.end(), bucket.begin(), bucket.end());
+                bucket.clear();
+            }
+            if (!ready.empty()) {
+                pending -= ready.size();
+                std::ranges::sort(ready, [](const SpikeArrival& a, const SpikeArrival& b) {
+                    return a.time != b.time ? a.time < b.time : a.synapse < b.synapse;
+                });
+                callback(ready);
+            }
+        }
+    }
+
+    EventSequence<float> SpikePropagator::computeArrivals(const EventSequence<std::monostate>& spikes) const
+    {
+        EventSequence<float> arrivals;
+        auto& events = arrivals.getEvents();
+        propagate(spikes, [&events](std::span<const SpikeArrival> window) {
+            // Windows come in chronological order, so every arrival goes at the end.
+            for (const auto& arrival : window) {
+                events.insert(events.end(), {arrival.synapse, arrival.time, arrival.efficacy});
+            }
+        });
+        arrivals.incrementVersion();
+        return arrivals;
+    }
+
+    TimeGrid<double> SpikePropagator::computeInput(const EventSequence<std::monostate>& spikes,
+                                                   std::chrono::nanoseconds bin) const
+    {
+        TimeGrid<double> grid(bin);
+        grid.defineUIDs(_neurons);
+        if (bin <= std::chrono::nanoseconds::zero()) {
+            return grid;
+        }
+
+        auto& data = grid.getData();
+        std::vector<double> empty(_neurons.size(), 0.0);
+        propagate(spikes, [&](std::span<const SpikeArrival> window) {
+            for (const auto& arrival : window) {
+                if (arrival.time < std::chrono::nanoseconds::zero()) {
+                    continue;
+                }
+                auto step = static_cast<size_t>(arrival.time / bin);
+                while (data.size() <= step) {
+                    grid.addTimestep(empty);
+                }
+                data[step][arrival.target] += arrival.efficacy;
+            }
+        });
+        return grid;
+    }
+} // namespace mindset
@@ -0,0 +1,122 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <mindset/spatial/AABB.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace mindset
+{
+    AABB AABB::empty()
+    {
+        constexpr float INF = std::numeric_limits<float>::infinity();
+        return {rush::Vec3f(INF), rush::Vec3f(-INF)};
+    }
+
+    AABB AABB::fromPoint(const rush::Vec3f& point)
+    {
+        return {point, point};
+    }
+
+    AABB AABB::fromSphere(const rush::Vec3f& center, float radius)
+    {
+        return {center - rush::Vec3f(radius), center + rush::Vec3f(radius)};
+    }
+
+    bool AABB::isEmpty() const
+    {
+        return min.x() > max.x() || min.y() > max.y() || min.z() > max.z();
+    }
+
+    rush::Vec3f AABB::getCenter() const
+    {
+        return (min + max) / 2.0f;
+    }
+
+    rush::Vec3f AABB::getSize() const
+    {
+        return max - min;
+    }
+
+    void AABB::expand(const rush::Vec3f& point)
+    {
+        for (size_t i = 0; i < 3; ++i) {
+            min[i] = std::min(min[i], point[i]);
+            max[i] = std::max(max[i], point[i]);
+        }
+    }
+
+    void AABB::expand(const AABB& other)
+    {
+        for (size_t i = 0; i < 3; ++i) {
+            min[i] = std::min(min[i], other.min[i]);
+            max[i] = std::max(max[i], other.max[i]);
+        }
+    }
+
+    bool AABB::contains(const rush::Vec3f& point) const
+    {
+        for (size_t i = 0; i < 3; ++i) {
+            if (point[i] < min[i] || point[i] > max[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool AABB::intersects(const AABB& other) const
+    {
+        for (size_t i = 0; i < 3; ++i) {
+            if (other.max[i] < min[i] || other.min[i] > max[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool AABB::intersectsSphere(const rush::Vec3f& center, float radius) const
+    {
+        return squaredDistance(center) <= radius * radius;
+    }
+
+    float AABB::squaredDistance(const rush::Vec3f& point) const
+    {
+        float result = 0.0f;
+        for (size_t i = 0; i < 3; ++i) {
+            float d = std::max({min[i] - point[i], 0.0f, point[i] - max[i]});
+            result += d * d;
+        }
+        return result;
+    }
+
+    AABB AABB::transformed(const NeuronTransform& transform) const
+    {
+        if (isEmpty()) {
+            return *this;
+        }
+        AABB result = empty();
+        for (int corner = 0; corner < 8; ++corner) {
+            rush::Vec3f point((corner & 1) ? max.x() : min.x(), (corner & 2) ? max.y() : min.y(),
+                              (corner & 4) ? max.z() : min.z());
+            result.expand(transform.positionToGlobalCoordinates(point));
+        }
+        return result;
+    }
+} // namespace mindset
@@ -0,0 +1,71 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <mindset/spatial/Frustum.h>
+
+#include <cmath>
+
+namespace mindset
+{
+    Frustum Frustum::fromMatrix(const rush::Mat4f& viewProjection)
+    {
+        auto row = [&viewProjection](size_t i) {
+            return rush::Vec4f(viewProjection[0][i], viewProjection[1][i], viewProjection[2][i],
+                               viewProjection[3][i]);
+        };
+
+        auto r0 = row(0);
+        auto r1 = row(1);
+        auto r2 = row(2);
+        auto r3 = row(3);
+
+        Frustum frustum{{r3 + r0, r3 - r0, r3 + r1, r3 - r1, r3 + r2, r3 - r2}};
+        for (auto& plane : frustum.planes) {
+            float length = std::sqrt(plane.x() * plane.x() + plane.y() * plane.y() + plane.z() * plane.z());
+            if (length > 0.0f) {
+                plane /= length;
+            }
+        }
+        return frustum;
+    }
+
+    bool Frustum::contains(const rush::Vec3f& point) const
+    {
+        for (auto& plane : planes) {
+            if (plane.x() * point.x() + plane.y() * point.y() + plane.z() * point.z() + plane.w() < 0.0f) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool Frustum::intersects(const AABB& box) const
+    {
+        for (auto& plane : planes) {
+            // The corner of the box furthest along the plane normal.
+            rush::Vec3f positive(plane.x() >= 0.0f ? box.max.x() : box.min.x(),
+                                 plane.y() >= 0.0f ? box.max.y() : box.min.y(),
+                                 plane.z() >= 0.0f ? box.max.z() : box.min.z());
+            if (plane.x() * positive.x() + plane.y() * positive.y() + plane.z() * positive.z() + plane.w() < 0.0f) {
+                return false;
+            }
+        }
+        return true;
+    }
+} // namespace mindset
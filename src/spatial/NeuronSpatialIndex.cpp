@@ -0,0 +1,417 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <mindset/spatial/NeuronSpatialIndex.h>
+
+#include <algorithm>
+#include <cmath>
+#include <queue>
+
+#include <mindset/DefaultProperties.h>
+#include <mindset/util/Trace.h>
+
+namespace
+{
+    constexpr uint32_t LEAF_SIZE = 4;
+    constexpr size_t MIN_CHANGES_BEFORE_REBUILD = 64;
+
+    bool matchesBox(const mindset::NeuronSpatialEntry& entry, const mindset::AABB& box, mindset::SpatialTarget target)
+    {
+        return target == mindset::SpatialTarget::SOMA ? box.contains(entry.soma) : box.intersects(entry.bounds);
+    }
+
+    bool matchesSphere(const mindset::NeuronSpatialEntry& entry, const rush::Vec3f& center, float radius,
+                       mindset::SpatialTarget target)
+    {
+        if (target == mindset::SpatialTarget::SOMA) {
+            return (entry.soma - center).squaredLength() <= radius * radius;
+        }
+        return entry.bounds.intersectsSphere(center, radius);
+    }
+} // namespace
+
+namespace mindset
+{
+    NeuronSpatialIndex::PropertyUIDs NeuronSpatialIndex::getPropertyUIDs() const
+    {
+        auto& properties = _dataset->getProperties();
+        return {
+            properties.getPropertyUID(PROPERTY_POSITION),
+            properties.getPropertyUID(PROPERTY_RADIUS),
+            properties.getPropertyUID(PROPERTY_TRANSFORM),
+        };
+    }
+
+    NeuronSpatialEntry NeuronSpatialIndex::computeEntry(const Neuron& neuron, const PropertyUIDs& properties) const
+    {
+        rush::Vec3f soma(0.0f);
+        AABB local = AABB::empty();
+
+        if (auto morphology = neuron.getMorphology()) {
+            if (auto somaOptional = morphology.value()->getSoma()) {
+                soma = somaOptional.value()->getCenter();
+                for (auto& node : somaOptional.value()->getNodes()) {
+                    local.expand(AABB::fromSphere(node.position, node.radius));
+                }
+            }
+
+            if (properties.position) {
+                for (const Neurite* neurite : morphology.value()->getNeurites()) {
+                    auto position = neurite->getProperty<rush::Vec3f>(properties.position.value());
+                    if (!position) {
+                        continue;
+                    }
+                    float radius = 0.0f;
+                    if (properties.radius) {
+                        radius = neurite->getProperty<float>(properties.radius.value()).value_or(0.0f);
+                    }
+                    local.expand(AABB::fromSphere(position.value(), radius));
+                }
+            }
+        }
+
+        local.expand(soma);
+
+        NeuronSpatialEntry entry{neuron.getUID(), soma, local, neuron.getVersion()};
+        if (properties.transform) {
+            if (auto transform = neuron.getProperty<NeuronTransform>(properties.transform.value())) {
+                entry.soma = transform->positionToGlobalCoordinates(soma);
+                entry.bounds = local.transformed(transform.value());
+            }
+        }
+        return entry;
+    }
+
+    uint32_t NeuronSpatialIndex::build(uint32_t begin, uint32_t end)
+    {
+        auto index = static_cast<uint32_t>(_nodes.size());
+        _nodes.emplace_back();
+
+        AABB bounds = AABB::empty();
+        AABB somaBounds = AABB::empty();
+        for (uint32_t i = begin; i < end; ++i) {
+            bounds.expand(_entries[i].bounds);
+            somaBounds.expand(_entries[i].soma);
+        }
+
+        if (end - begin <= LEAF_SIZE) {
+            _nodes[index] = {bounds, somaBounds, begin, end - begin};
+            return index;
+        }
+
+        // Median split along the longest axis of the soma centers.
+        auto size = somaBounds.getSize();
+        size_t axis = 0;
+        if (size[1] > size[axis]) {
+            axis = 1;
+        }
+        if (size[2] > size[axis]) {
+            axis = 2;
+        }
+
+        uint32_t middle = begin + (end - begin) / 2;
+        std::nth_element(_entries.begin() + begin, _entries.begin() + middle, _entries.begin() + end,
+                         [axis](const auto& a, const auto& b) { return a.soma[axis] < b.soma[axis]; });
+
+        build(begin, middle);
+        uint32_t right = build(middle, end);
+        _nodes[index] = {bounds, somaBounds, right, 0};
+        return index;
+    }
+
+    void NeuronSpatialIndex::onNeuronAdded(const Neuron& neuron)
+    {
+        if (_removed.erase(neuron.getUID()) > 0) {
+            // The old entry is still in the hierarchy: force a rebuild to drop it.
+            std::erase_if(_entries, [uid = neuron.getUID()](const auto& entry) { return entry.uid == uid; });
+            _nodes.clear();
+        }
+        auto entry = computeEntry(neuron, getPropertyUIDs());
+        _versions[entry.uid] = entry.version;
+        _pending.push_back(entry);
+        rebuildIfRequired();
+    }
+
+    void NeuronSpatialIndex::onNeuronRemoved(UID uid)
+    {
+        if (_versions.erase(uid) == 0) {
+            return;
+        }
+        auto it = std::ranges::find(_pending, uid, &NeuronSpatialEntry::uid);
+        if (it != _pending.end()) {
+            *it = _pending.back();
+            _pending.pop_back();
+        } else {
+            _removed.insert(uid);
+        }
+        rebuildIfRequired();
+    }
+
+    void NeuronSpatialIndex::clear()
+    {
+        _entries.clear();
+        _nodes.clear();
+        _pending.clear();
+        _removed.clear();
+        _versions.clear();
+    }
+
+    void NeuronSpatialIndex::rebuildIfRequired()
+    {
+        size_t changes = _pending.size() + _removed.size();
+        bool invalid = _nodes.empty() && !_entries.empty();
+        if (!invalid && changes < std::max(MIN_CHANGES_BEFORE_REBUILD, _entries.size() / 4)) {
+            return;
+        }
+
+        if (!_removed.empty()) {
+            std::erase_if(_entries, [this](const auto& entry) { return _removed.contains(entry.uid); });
+            _removed.clear();
+        }
+        _entries.insert(_entries.end(), _pending.begin(), _pending.end());
+        _pending.clear();
+
+        _nodes.clear();
+        if (!_entries.empty()) {
+            _nodes.reserve(2 * (_entries.size() / LEAF_SIZE + 1));
+            build(0, static_cast<uint32_t>(_entries.size()));
+        }
+    }
+
+    template<typename NodeTest, typename LeafTest>
+    void NeuronSpatialIndex::traverse(NodeTest nodeTest, LeafTest leafTest) const
+    {
+        if (_nodes.empty()) {
+            return;
+        }
+        std::vector<uint32_t> stack = {0};
+        while (!stack.empty()) {
+            auto& node = _nodes[stack.back()];
+            uint32_t index = stack.back();
+            stack.pop_back();
+            if (!nodeTest(node)) {
+                continue;
+            }
+            if (node.count == 0) {
+                stack.push_back(node.offset);
+                stack.push_back(index + 1);
+                continue;
+            }
+            for (uint32_t i = node.offset; i < node.offset + node.count; ++i) {
+                if (!_removed.contains(_entries[i].uid)) {
+                    leafTest(_entries[i]);
+                }
+            }
+        }
+    }
+
+    NeuronSpatialIndex::NeuronSpatialIndex(Dataset& dataset) :
+        _dataset(&dataset)
+    {
+        _neuronAddedListener =
+            dataset.getNeuronAddedEvent().createListener([this](Neuron* neuron) { onNeuronAdded(*neuron); });
+        _neuronRemovedListener =
+            dataset.getNeuronRemovedEvent().createListener([this](UID uid) { onNeuronRemoved(uid); });
+        _clearListener = dataset.getClearEvent().createListener([this](void*) { clear(); });
+        rebuild();
+    }
+
+    void NeuronSpatialIndex::rebuild()
+    {
+        MINDSET_TRACE_SCOPE("NeuronSpatialIndex::rebuild");
+        clear();
+        auto properties = getPropertyUIDs();
+        _entries.reserve(_dataset->getNeuronsAmount());
+        for (const Neuron* neuron : _dataset->getNonContextualizedNeurons()) {
+            auto entry = computeEntry(*neuron, properties);
+            _versions[entry.uid] = entry.version;
+            _entries.push_back(entry);
+        }
+        rebuildIfRequired();
+    }
+
+    size_t NeuronSpatialIndex::refresh()
+    {
+        MINDSET_TRACE_SCOPE("NeuronSpatialIndex::refresh");
+        auto properties = getPropertyUIDs();
+        size_t updated = 0;
+        for (const Neuron* neuron : _dataset->getNonContextualizedNeurons()) {
+            auto it = _versions.find(neuron->getUID());
+            if (it != _versions.end() && it->second == neuron->getVersion()) {
+                continue;
+            }
+            auto entry = computeEntry(*neuron, properties);
+            if (it != _versions.end()) {
+                auto pending = std::ranges::find(_pending, entry.uid, &NeuronSpatialEntry::uid);
+                if (pending != _pending.end()) {
+                    *pending = entry;
+                } else {
+                    _removed.insert(entry.uid);
+                    _pending.push_back(entry);
+                }
+            } else {
+                _pending.push_back(entry);
+            }
+            _versions[entry.uid] = entry.version;
+            ++updated;
+        }
+        if (updated > 0) {
+            // Replaced entries are both tombstoned and pending: a rebuild is required to resolve them.
+            _nodes.clear();
+            rebuildIfRequired();
+        }
+        return updated;
+    }
+
+    size_t NeuronSpatialIndex::size() const
+    {
+        return _versions.size();
+    }
+
+    std::optional<NeuronSpatialEntry> NeuronSpatialIndex::getEntry(UID uid) const
+    {
+        if (!_versions.contains(uid)) {
+            return {};
+        }
+        auto pending = std::ranges::find(_pending, uid, &NeuronSpatialEntry::uid);
+        if (pending != _pending.end()) {
+            return *pending;
+        }
+        auto it = std::ranges::find(_entries, uid, &NeuronSpatialEntry::uid);
+        if (it != _entries.end()) {
+            return *it;
+        }
+        return {};
+    }
+
+    AABB NeuronSpatialIndex::getBounds() const
+    {
+        AABB result = _nodes.empty() ? AABB::empty() : _nodes.front().bounds;
+        for (auto& entry : _pending) {
+            result.expand(entry.bounds);
+        }
+        return result;
+    }
+
+    std::vector<UID> NeuronSpatialIndex::queryBox(const AABB& box, SpatialTarget target) const
+    {
+        std::vector<UID> result;
+        traverse(
+            [&](const BVHNode& node) {
+                return box.intersects(target == SpatialTarget::SOMA ? node.somaBounds : node.bounds);
+            },
+            [&](const NeuronSpatialEntry& entry) {
+                if (matchesBox(entry, box, target)) {
+                    result.push_back(entry.uid);
+                }
+            });
+
+        for (auto& entry : _pending) {
+            if (matchesBox(entry, box, target)) {
+                result.push_back(entry.uid);
+            }
+        }
+
+        std::ranges::sort(result);
+        return result;
+    }
+
+    std::vector<UID> NeuronSpatialIndex::querySphere(const rush::Vec3f& center, float radius,
+                                                     SpatialTarget target) const
+    {
+        std::vector<UID> result;
+        traverse(
+            [&](const BVHNode& node) {
+                return (target == SpatialTarget::SOMA ? node.somaBounds : node.bounds).intersectsSphere(center, radius);
+            },
+            [&](const NeuronSpatialEntry& entry) {
+                if (matchesSphere(entry, center, radius, target)) {
+                    result.push_back(entry.uid);
+                }
+            });
+
+        for (auto& entry : _pending) {
+            if (matchesSphere(entry, center, radius, target)) {
+                result.push_back(entry.uid);
+            }
+        }
+
+        std::ranges::sort(result);
+        return result;
+    }
+
+    std::vector<std::pair<UID, float>> NeuronSpatialIndex::queryNearest(const rush::Vec3f& point, size_t k) const
+    {
+        if (k == 0) {
+            return {};
+        }
+
+        // Max-heap of the best candidates found so far, by squared distance.
+        std::priority_queue<std::pair<float, UID>> best;
+        auto consider = [&](const NeuronSpatialEntry& entry) {
+            float distance = (entry.soma - point).squaredLength();
+            if (best.size() < k) {
+                best.emplace(distance, entry.uid);
+            } else if (distance < best.top().first) {
+                best.pop();
+                best.emplace(distance, entry.uid);
+            }
+        };
+
+        for (auto& entry : _pending) {
+            consider(entry);
+        }
+
+        // Best-first traversal: nodes are visited by increasing distance and pruned once
+        // they can't contain anything closer than the current k-th candidate.
+        using QueueEntry = std::pair<float, uint32_t>;
+        std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<>> queue;
+        if (!_nodes.empty()) {
+            queue.emplace(_nodes.front().somaBounds.squaredDistance(point), 0);
+        }
+
+        while (!queue.empty()) {
+            auto [distance, index] = queue.top();
+            queue.pop();
+            if (best.size() == k && distance > best.top().first) {
+                break;
+            }
+
+            auto& node = _nodes[index];
+            if (node.count == 0) {
+                queue.emplace(_nodes[index + 1].somaBounds.squaredDistance(point), index + 1);
+                queue.emplace(_nodes[node.offset].somaBounds.squaredDistance(point), node.offset);
+                continue;
+            }
+
+            for (uint32_t i = node.offset; i < node.offset + node.count; ++i) {
+                if (!_removed.contains(_entries[i].uid)) {
+                    consider(_entries[i]);
+                }
+            }
+        }
+
+        std::vector<std::pair<UID, float>> result(best.size());
+        for (size_t i = result.size(); i > 0; --i) {
+            result[i - 1] = {best.top().second, std::sqrt(best.top().first)};
+            best.pop();
+        }
+        return result;
+    }
+} // namespace mindset
@@ -0,0 +1,353 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <mindset/spatial/SynapseSpatialIndex.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include <mindset/DefaultProperties.h>
+#include <mindset/util/Parallel.h>
+#include <mindset/util/Trace.h>
+
+namespace
+{
+    constexpr size_t CHUNK_SIZE = 4096;
+
+    enum class Overlap
+    {
+        OUTSIDE,
+        PARTIAL,
+        INSIDE
+    };
+
+    bool lexicographicLess(const rush::Vec3i& a, const rush::Vec3i& b)
+    {
+        if (a.x() != b.x()) {
+            return a.x() < b.x();
+        }
+        if (a.y() != b.y()) {
+            return a.y() < b.y();
+        }
+        return a.z() < b.z();
+    }
+} // namespace
+
+namespace mindset
+{
+    size_t VoxelHash::operator()(const rush::Vec3i& voxel) const
+    {
+        auto h = static_cast<uint64_t>(static_cast<uint32_t>(voxel.x())) * 73856093u;
+        h ^= static_cast<uint64_t>(static_cast<uint32_t>(voxel.y())) * 19349663u;
+        h ^= static_cast<uint64_t>(static_cast<uint32_t>(voxel.z())) * 83492791u;
+        return static_cast<size_t>(h);
+    }
+
+    std::optional<UID> SynapseSpatialIndex::getPositionProperty() const
+    {
+        auto& properties = _dataset->getProperties();
+        switch (_positionType) {
+            case SynapsePositionType::PRE:
+                return properties.getPropertyUID(PROPERTY_SYNAPSE_PRE_POSITION);
+            case SynapsePositionType::POST:
+                return properties.getPropertyUID(PROPERTY_SYNAPSE_POST_POSITION);
+            default:
+                return properties.getPropertyUID(PROPERTY_POSITION);
+        }
+    }
+
+    void SynapseSpatialIndex::onSynapseAdded(const Synapse& synapse)
+    {
+        auto property = getPositionProperty();
+        if (!property) {
+            return;
+        }
+        auto position = synapse.getProperty<rush::Vec3f>(property.value());
+        if (!position) {
+            return;
+        }
+
+        onSynapseRemoved(synapse.getUID());
+        auto voxel = getVoxel(position.value());
+        _voxels[voxel].push_back({synapse.getUID(), position.value()});
+        _locations[synapse.getUID()] = voxel;
+    }
+
+    void SynapseSpatialIndex::onSynapseRemoved(UID uid)
+    {
+        auto location = _locations.find(uid);
+        if (location == _locations.end()) {
+            return;
+        }
+
+        auto voxel = _voxels.find(location->second);
+        auto& items = voxel->second;
+        auto it = std::ranges::find(items, uid, &Item::uid);
+        *it = items.back();
+        items.pop_back();
+        if (items.empty()) {
+            _voxels.erase(voxel);
+        }
+        _locations.erase(location);
+    }
+
+    void SynapseSpatialIndex::clear()
+    {
+        _voxels.clear();
+        _locations.clear();
+    }
+
+    template<typename VoxelTest, typename ItemTest>
+    std::vector<UID> SynapseSpatialIndex::collect(const AABB& region, VoxelTest voxelTest, ItemTest itemTest) const
+    {
+        std::vector<UID> result;
+        auto visit = [&](const rush::Vec3i& voxel, const std::vector<Item>& items) {
+            Overlap overlap = voxelTest(getVoxelBounds(voxel));
+            if (overlap == Overlap::INSIDE) {
+                for (auto& item : items) {
+                    result.push_back(item.uid);
+                }
+            } else if (overlap == Overlap::PARTIAL) {
+                for (auto& item : items) {
+                    if (itemTest(item.position)) {
+                        result.push_back(item.uid);
+                    }
+                }
+            }
+        };
+
+        if (region.isEmpty()) {
+            return result;
+        }
+
+        auto min = getVoxel(region.min);
+        auto max = getVoxel(region.max);
+        double cells = 1.0;
+        for (size_t i = 0; i < 3; ++i) {
+            cells *= static_cast<double>(max[i]) - static_cast<double>(min[i]) + 1.0;
+        }
+
+        // Visit the cells of the region only if there are fewer of them than occupied voxels.
+        // The counters are wider than the voxel coordinates, so regions ending at the last voxel don't overflow.
+        if (cells <= static_cast<double>(_voxels.size())) {
+            for (int64_t x = min.x(); x <= max.x(); ++x) {
+                for (int64_t y = min.y(); y <= max.y(); ++y) {
+                    for (int64_t z = min.z(); z <= max.z(); ++z) {
+                        rush::Vec3i voxel(static_cast<int32_t>(x), static_cast<int32_t>(y), static_cast<int32_t>(z));
+                        if (auto it = _voxels.find(voxel); it != _voxels.end()) {
+                            visit(voxel, it->second);
+                        }
+                    }
+                }
+            }
+        } else {
+            for (auto& [voxel, items] : _voxels) {
+                visit(voxel, items);
+            }
+        }
+
+        std::ranges::sort(result);
+        return result;
+    }
+
+    SynapseSpatialIndex::SynapseSpatialIndex(Dataset& dataset, float voxelSize, SynapsePositionType positionType,
+                                             size_t threads) :
+        _dataset(&dataset),
+        _voxelSize(voxelSize),
+        _positionType(positionType)
+    {
+        if (!std::isfinite(voxelSize) || voxelSize <= 0.0f) {
+            throw std::invalid_argument("The voxel size must be a positive finite number.");
+        }
+
+        auto& circuit = dataset.getCircuit();
+        _synapseAddedListener =
+            circuit.getSynapseAddedEvent().createListener([this](Synapse* synapse) { onSynapseAdded(*synapse); });
+        _synapseRemovedListener =
+            circuit.getSynapseRemovedEvent().createListener([this](UID uid) { onSynapseRemoved(uid); });
+        _clearListener = circuit.getClearEvent().createListener([this](void*) { clear(); });
+        rebuild(threads);
+    }
+
+    void SynapseSpatialIndex::rebuild(size_t threads)
+    {
+        MINDSET_TRACE_SCOPE("SynapseSpatialIndex::rebuild");
+        clear();
+
+        auto property = getPositionProperty();
+        if (!property) {
+            return;
+        }
+
+        std::vector<const Synapse*> synapses;
+        for (const Synapse* synapse : _dataset->getCircuit().getSynapses()) {
+            synapses.push_back(synapse);
+        }
+
+        // Each worker fills its own grid. The grids are merged afterward.
+        size_t workers = std::min(threads == 0 ? defaultThreadCount() : threads,
+                                  std::max<size_t>(1, (synapses.size() + CHUNK_SIZE - 1) / CHUNK_SIZE));
+        std::vector<Voxels> partial(workers);
+
+        parallelForChunks(
+            synapses.size(), CHUNK_SIZE,
+            [&](size_t thread, size_t begin, size_t end) {
+                auto& voxels = partial[thread];
+                for (size_t i = begin; i < end; ++i) {
+                    auto position = synapses[i]->getProperty<rush::Vec3f>(property.value());
+                    if (position) {
+                        voxels[getVoxel(position.value())].push_back({synapses[i]->getUID(), position.value()});
+                    }
+                }
+            },
+            workers);
+
+        _voxels = std::move(partial.front());
+        for (size_t i = 1; i < partial.size(); ++i) {
+            for (auto& [voxel, items] : partial[i]) {
+                auto& destination = _voxels[voxel];
+                if (destination.empty()) {
+                    destination = std::move(items);
+                } else {
+                    destination.insert(destination.end(), items.begin(), items.end());
+                }
+            }
+        }
+
+        _locations.reserve(synapses.size());
+        for (auto& [voxel, items] : _voxels) {
+            for (auto& item : items) {
+                _locations.emplace(item.uid, voxel);
+            }
+        }
+    }
+
+    size_t SynapseSpatialIndex::size() const
+    {
+        return _locations.size();
+    }
+
+    float SynapseSpatialIndex::getVoxelSize() const
+    {
+        return _voxelSize;
+    }
+
+    rush::Vec3i SynapseSpatialIndex::getVoxel(const rush::Vec3f& position) const
+    {
+        auto toCell = [this](float value) {
+            double cell = std::floor(static_cast<double>(value) / _voxelSize);
+            cell = std::clamp(cell, static_cast<double>(std::numeric_limits<int32_t>::min()),
+                              static_cast<double>(std::numeric_limits<int32_t>::max()));
+            return static_cast<int32_t>(cell);
+        };
+        return {toCell(position.x()), toCell(position.y()), toCell(position.z())};
+    }
+
+    AABB SynapseSpatialIndex::getVoxelBounds(const rush::Vec3i& voxel) const
+    {
+        rush::Vec3f min(static_cast<float>(voxel.x()) * _voxelSize, static_cast<float>(voxel.y()) * _voxelSize,
+                        static_cast<float>(voxel.z()) * _voxelSize);
+        return {min, min + rush::Vec3f(_voxelSize)};
+    }
+
+    std::optional<rush::Vec3f> SynapseSpatialIndex::getPosition(UID uid) const
+    {
+        auto location = _locations.find(uid);
+        if (location == _locations.end()) {
+            return {};
+        }
+        auto& items = _voxels.at(location->second);
+        auto it = std::ranges::find(items, uid, &Item::uid);
+        return it->position;
+    }
+
+    std::vector<UID> SynapseSpatialIndex::queryBox(const AABB& box) const
+    {
+        return collect(
+            box,
+            [&box](const AABB& voxel) {
+                if (!box.intersects(voxel)) {
+                    return Overlap::OUTSIDE;
+                }
+                return box.contains(voxel.min) && box.contains(voxel.max) ? Overlap::INSIDE : Overlap::PARTIAL;
+            },
+            [&box](const rush::Vec3f& position) { return box.contains(position); });
+    }
+
+    std::vector<UID> SynapseSpatialIndex::querySphere(const rush::Vec3f& center, float radius) const
+    {
+        float squaredRadius = radius * radius;
+        return collect(
+            AABB::fromSphere(center, radius),
+            [&](const AABB& voxel) {
+                if (!voxel.intersectsSphere(center, radius)) {
+                    return Overlap::OUTSIDE;
+                }
+                // The voxel is inside the sphere if its furthest corner is.
+                float furthest = 0.0f;
+                for (size_t i = 0; i < 3; ++i) {
+                    float d = std::max(std::abs(voxel.min[i] - center[i]), std::abs(voxel.max[i] - center[i]));
+                    furthest += d * d;
+                }
+                return furthest <= squaredRadius ? Overlap::INSIDE : Overlap::PARTIAL;
+            },
+            [&](const rush::Vec3f& position) { return (position - center).squaredLength() <= squaredRadius; });
+    }
+
+    std::vector<UID> SynapseSpatialIndex::queryFrustum(const Frustum& frustum) const
+    {
+        constexpr float INF = std::numeric_limits<float>::infinity();
+        AABB everything{rush::Vec3f(-INF), rush::Vec3f(INF)};
+        return collect(
+            everything,
+            [&frustum](const AABB& voxel) { return frustum.intersects(voxel) ? Overlap::PARTIAL : Overlap::OUTSIDE; },
+            [&frustum](const rush::Vec3f& position) { return frustum.contains(position); });
+    }
+
+    size_t SynapseSpatialIndex::getVoxelCount(const rush::Vec3i& voxel) const
+    {
+        auto it = _voxels.find(voxel);
+        return it == _voxels.end() ? 0 : it->second.size();
+    }
+
+    std::vector<std::pair<rush::Vec3i, size_t>> SynapseSpatialIndex::getVoxelCounts() const
+    {
+        std::vector<std::pair<rush::Vec3i, size_t>> result;
+        result.reserve(_voxels.size());
+        for (auto& [voxel, items] : _voxels) {
+            result.emplace_back(voxel, items.size());
+        }
+        std::ranges::sort(result, lexicographicLess, [](const auto& pair) { return pair.first; });
+        return result;
+    }
+
+    std::vector<std::pair<rush::Vec3i, size_t>> SynapseSpatialIndex::getVoxelCounts(const AABB& box) const
+    {
+        std::vector<std::pair<rush::Vec3i, size_t>> result;
+        for (auto& [voxel, items] : _voxels) {
+            if (box.intersects(getVoxelBounds(voxel))) {
+                result.emplace_back(voxel, items.size());
+            }
+        }
+        std::ranges::sort(result, lexicographicLess, [](const auto& pair) { return pair.first; });
+        return result;
+    }
+} // namespace mindset
@@ -0,0 +1,431 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <mindset/spatial/TouchDetector.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <unordered_map>
+
+#include <mindset/DefaultProperties.h>
+#include <mindset/spatial/AABB.h>
+#include <mindset/util/Parallel.h>
+#include <mindset/util/Trace.h>
+
+namespace
+{
+    using namespace mindset;
+
+    constexpr float EPSILON = 1e-12f;
+
+    struct Segment
+    {
+        UID neuron;
+        UID neurite;
+        rush::Vec3f from;
+        rush::Vec3f to;
+        float radius;
+        /// The segment's bounds, expanded by its radius and half the threshold.
+        AABB bounds;
+    };
+
+    struct CellEntry
+    {
+        int32_t x;
+        int32_t y;
+        int32_t z;
+        uint32_t segment;
+
+        [[nodiscard]] bool sameCell(const CellEntry& other) const
+        {
+            return x == other.x && y == other.y && z == other.z;
+        }
+
+        auto operator<=>(const CellEntry& other) const = default;
+    };
+
+    struct CellJob
+    {
+        size_t axonsBegin;
+        size_t axonsEnd;
+        size_t dendritesBegin;
+        size_t dendritesEnd;
+    };
+
+    struct SegmentLists
+    {
+        std::vector<Segment> axons;
+        std::vector<Segment> dendrites;
+    };
+
+    struct MorphologyProperties
+    {
+        std::optional<UID> position;
+        std::optional<UID> radius;
+        std::optional<UID> parent;
+        std::optional<UID> type;
+        std::optional<UID> transform;
+    };
+
+    void extractSegments(const Neuron& neuron, const MorphologyProperties& properties, float threshold,
+                         SegmentLists& out)
+    {
+        auto morphology = neuron.getMorphology();
+        if (!morphology || !properties.position || !properties.parent || !properties.type) {
+            return;
+        }
+
+        std::optional<NeuronTransform> transform;
+        float radiusScale = 1.0f;
+        if (properties.transform) {
+            transform = neuron.getProperty<NeuronTransform>(properties.transform.value());
+            if (transform) {
+                auto& scale = transform->getScale();
+                radiusScale = std::max({std::abs(scale.x()), std::abs(scale.y()), std::abs(scale.z())});
+            }
+        }
+
+        struct Point
+        {
+            rush::Vec3f position;
+            float radius;
+        };
+
+        std::unordered_map<UID, Point> points;
+        points.reserve(morphology.value()->getNeuritesAmount() + 1);
+        for (const Neurite* neurite : morphology.value()->getNeurites()) {
+            auto position = neurite->getProperty<rush::Vec3f>(properties.position.value());
+            if (!position) {
+                continue;
+            }
+            float radius = 0.0f;
+            if (properties.radius) {
+                radius = neurite->getProperty<float>(properties.radius.value()).value_or(0.0f);
+            }
+            points[neurite->getUID()] = {position.value(), radius};
+        }
+        if (auto soma = morphology.value()->getSoma()) {
+            points.try_emplace(soma.value()->getUID(), Point{soma.value()->getCenter(), 0.0f});
+        }
+
+        for (const Neurite* neurite : morphology.value()->getNeurites()) {
+            auto type = neurite->getProperty<NeuriteType>(properties.type.value());
+            if (!type) {
+                continue;
+            }
+            bool axon = type.value() == NeuriteType::AXON;
+            bool dendrite = type.value() == NeuriteType::BASAL_DENDRITE ||
+                            type.value() == NeuriteType::APICAL_DENDRITE;
+            if (!axon && !dendrite) {
+                continue;
+            }
+
+            auto parent = neurite->getProperty<UID>(properties.parent.value());
+            if (!parent) {
+                continue;
+            }
+            auto distal = points.find(neurite->getUID());
+            auto proximal = points.find(parent.value());
+            if (distal == points.end() || proximal == points.end()) {
+                continue;
+            }
+
+            Segment segment{
+                neuron.getUID(),
+                neurite->getUID(),
+                proximal->second.position,
+                distal->second.position,
+                std::max(proximal->second.radius, distal->second.radius) * radiusScale,
+                {}
+            };
+            if (transform) {
+                segment.from = transform->positionToGlobalCoordinates(segment.from);
+                segment.to = transform->positionToGlobalCoordinates(segment.to);
+            }
+
+            segment.bounds = AABB::fromPoint(segment.from);
+            segment.bounds.expand(segment.to);
+            float margin = segment.radius + threshold / 2.0f;
+            segment.bounds.min -= rush::Vec3f(margin);
+            segment.bounds.max += rush::Vec3f(margin);
+
+            (axon ? out.axons : out.dendrites).push_back(segment);
+        }
+    }
+
+    /**
+     * Returns the parameters of the closest points of the segments p1-q1 and p2-q2.
+     * See Ericson, "Real-Time Collision Detection", section 5.1.9.
+     */
+    std::pair<float, float> closestPoints(const rush::Vec3f& p1, const rush::Vec3f& q1, const rush::Vec3f& p2,
+                                          const rush::Vec3f& q2)
+    {
+        auto d1 = q1 - p1;
+        auto d2 = q2 - p2;
+        auto r = p1 - p2;
+        float a = d1.dot(d1);
+        float e = d2.dot(d2);
+        float f = d2.dot(r);
+
+        if (a <= EPSILON && e <= EPSILON) {
+            return {0.0f, 0.0f};
+        }
+        if (a <= EPSILON) {
+            return {0.0f, std::clamp(f / e, 0.0f, 1.0f)};
+        }
+
+        float c = d1.dot(r);
+        if (e <= EPSILON) {
+            return {std::clamp(-c / a, 0.0f, 1.0f), 0.0f};
+        }
+
+        float b = d1.dot(d2);
+        float denominator = a * e - b * b;
+        float s = denominator != 0.0f ? std::clamp((b * f - c * e) / denominator, 0.0f, 1.0f) : 0.0f;
+        float t = (b * s + f) / e;
+        if (t < 0.0f) {
+            return {std::clamp(-c / a, 0.0f, 1.0f), 0.0f};
+        }
+        if (t > 1.0f) {
+            return {std::clamp((b - c) / a, 0.0f, 1.0f), 1.0f};
+        }
+        return {s, t};
+    }
+
+    int32_t toCell(float value, float cellSize)
+    {
+        double cell = std::floor(static_cast<double>(value) / cellSize);
+        return static_cast<int32_t>(std::clamp(cell, static_cast<double>(std::numeric_limits<int32_t>::min()),
+                                               static_cast<double>(std::numeric_limits<int32_t>::max())));
+    }
+
+    std::vector<CellEntry> hashSegments(const std::vector<Segment>& segments, float cellSize)
+    {
+        std::vector<CellEntry> entries;
+        entries.reserve(segments.size());
+        for (uint32_t i = 0; i < segments.size(); ++i) {
+            auto& bounds = segments[i].bounds;
+            int32_t minX = toCell(bounds.min.x(), cellSize), maxX = toCell(bounds.max.x(), cellSize);
+            int32_t minY = toCell(bounds.min.y(), cellSize), maxY = toCell(bounds.max.y(), cellSize);
+            int32_t minZ = toCell(bounds.min.z(), cellSize), maxZ = toCell(bounds.max.z(), cellSize);
+            for (int64_t x = minX; x <= maxX; ++x) {
+                for (int64_t y = minY; y <= maxY; ++y) {
+                    for (int64_t z = minZ; z <= maxZ; ++z) {
+                        entries.push_back(
+                            {static_cast<int32_t>(x), static_cast<int32_t>(y), static_cast<int32_t>(z), i});
+                    }
+                }
+            }
+        }
+        std::ranges::sort(entries);
+        return entries;
+    }
+} // namespace
+
+namespace mindset
+{
+    TouchDetector::TouchDetector(TouchDetectorSettings settings) :
+        _settings(settings)
+    {
+    }
+
+    const TouchDetectorSettings& TouchDetector::getSettings() const
+    {
+        return _settings;
+    }
+
+    std::vector<TouchCandidate> TouchDetector::detect(const Dataset& dataset) const
+    {
+        MINDSET_TRACE_SCOPE("TouchDetector::detect");
+        auto& properties = dataset.getProperties();
+        MorphologyProperties morphologyProperties{
+            properties.getPropertyUID(PROPERTY_POSITION),
+            properties.getPropertyUID(PROPERTY_RADIUS),
+            properties.getPropertyUID(PROPERTY_PARENT),
+            properties.getPropertyUID(PROPERTY_NEURITE_TYPE),
+            properties.getPropertyUID(PROPERTY_TRANSFORM),
+        };
+
+        std::vector<const Neuron*> neurons;
+        neurons.reserve(dataset.getNeuronsAmount());
+        for (const Neuron* neuron : dataset.getNonContextualizedNeurons()) {
+            neurons.push_back(neuron);
+        }
+        std::ranges::sort(neurons, {}, [](const Neuron* neuron) { return neuron->getUID(); });
+
+        // Extract the segments in parallel. Neurons are split in chunks to keep the output deterministic.
+        constexpr size_t NEURONS_PER_CHUNK = 16;
+        size_t chunks = (neurons.size() + NEURONS_PER_CHUNK - 1) / NEURONS_PER_CHUNK;
+        std::vector<SegmentLists> chunkSegments(chunks);
+        parallelFor(
+            chunks,
+            [&](size_t chunk) {
+                size_t end = std::min(neurons.size(), (chunk + 1) * NEURONS_PER_CHUNK);
+                for (size_t i = chunk * NEURONS_PER_CHUNK; i < end; ++i) {
+                    extractSegments(*neurons[i], morphologyProperties, _settings.threshold, chunkSegments[chunk]);
+                }
+            },
+            _settings.threads);
+
+        SegmentLists segments;
+        for (auto& chunk : chunkSegments) {
+            segments.axons.insert(segments.axons.end(), chunk.axons.begin(), chunk.axons.end());
+            segments.dendrites.insert(segments.dendrites.end(), chunk.dendrites.begin(), chunk.dendrites.end());
+        }
+        chunkSegments.clear();
+
+        if (segments.axons.empty() || segments.dendrites.empty()) {
+            return {};
+        }
+
+        float cellSize = _settings.cellSize;
+        if (cellSize <= 0.0f) {
+            // Twice the mean segment extent keeps most segments inside a few cells.
+            double extent = 0.0;
+            for (auto* list : {&segments.axons, &segments.dendrites}) {
+                for (auto& segment : *list) {
+                    auto size = segment.bounds.getSize();
+                    extent += std::max({size.x(), size.y(), size.z()});
+                }
+            }
+            extent /= static_cast<double>(segments.axons.size() + segments.dendrites.size());
+            cellSize = std::max({static_cast<float>(extent * 2.0), _settings.threshold * 2.0f, 1e-3f});
+        }
+
+        auto axonCells = hashSegments(segments.axons, cellSize);
+        auto dendriteCells = hashSegments(segments.dendrites, cellSize);
+
+        // Pair the cells occupied by both kinds of segments.
+        std::vector<CellJob> jobs;
+        size_t a = 0, d = 0;
+        while (a < axonCells.size() && d < dendriteCells.size()) {
+            auto& axon = axonCells[a];
+            auto& dendrite = dendriteCells[d];
+            auto axonKey = std::tie(axon.x, axon.y, axon.z);
+            auto dendriteKey = std::tie(dendrite.x, dendrite.y, dendrite.z);
+            if (axonKey < dendriteKey) {
+                ++a;
+            } else if (dendriteKey < axonKey) {
+                ++d;
+            } else {
+                CellJob job{a, a, d, d};
+                while (job.axonsEnd < axonCells.size() && axonCells[job.axonsEnd].sameCell(axon)) {
+                    ++job.axonsEnd;
+                }
+                while (job.dendritesEnd < dendriteCells.size() && dendriteCells[job.dendritesEnd].sameCell(dendrite)) {
+                    ++job.dendritesEnd;
+                }
+                jobs.push_back(job);
+                a = job.axonsEnd;
+                d = job.dendritesEnd;
+            }
+        }
+
+        constexpr size_t JOBS_PER_CHUNK = 64;
+        size_t workers = std::min(_settings.threads == 0 ? defaultThreadCount() : _settings.threads,
+                                  std::max<size_t>(1, (jobs.size() + JOBS_PER_CHUNK - 1) / JOBS_PER_CHUNK));
+        std::vector<std::vector<TouchCandidate>> partial(workers);
+
+        parallelForChunks(
+            jobs.size(), JOBS_PER_CHUNK,
+            [&](size_t thread, size_t begin, size_t end) {
+                auto& out = partial[thread];
+                for (size_t j = begin; j < end; ++j) {
+                    auto& job = jobs[j];
+                    auto& cell = axonCells[job.axonsBegin];
+                    for (size_t ai = job.axonsBegin; ai < job.axonsEnd; ++ai) {
+                        auto& axon = segments.axons[axonCells[ai].segment];
+                        for (size_t di = job.dendritesBegin; di < job.dendritesEnd; ++di) {
+                            auto& dendrite = segments.dendrites[dendriteCells[di].segment];
+                            if (!_settings.allowAutapses && axon.neuron == dendrite.neuron) {
+                                continue;
+                            }
+                            if (!axon.bounds.intersects(dendrite.bounds)) {
+                                continue;
+                            }
+
+                            // Only the cell containing the minimum corner of the overlap reports the pair.
+                            if (toCell(std::max(axon.bounds.min.x(), dendrite.bounds.min.x()), cellSize) != cell.x ||
+                                toCell(std::max(axon.bounds.min.y(), dendrite.bounds.min.y()), cellSize) != cell.y ||
+                                toCell(std::max(axon.bounds.min.z(), dendrite.bounds.min.z()), cellSize) != cell.z) {
+                                continue;
+                            }
+
+                            auto [s, t] = closestPoints(axon.from, axon.to, dendrite.from, dendrite.to);
+                            auto pre = axon.from + (axon.to - axon.from) * s;
+                            auto post = dendrite.from + (dendrite.to - dendrite.from) * t;
+                            float gap = (post - pre).length() - axon.radius - dendrite.radius;
+                            if (gap <= _settings.threshold) {
+                                out.push_back({axon.neuron, dendrite.neuron, axon.neurite, dendrite.neurite, pre,
+                                               post, gap});
+                            }
+                        }
+                    }
+                }
+            },
+            workers);
+
+        std::vector<TouchCandidate> result;
+        size_t total = 0;
+        for (auto& part : partial) {
+            total += part.size();
+        }
+        result.reserve(total);
+        for (auto& part : partial) {
+            result.insert(result.end(), part.begin(), part.end());
+        }
+
+        std::ranges::sort(result, {}, [](const TouchCandidate& candidate) {
+            return std::make_tuple(candidate.preNeuron, candidate.postNeuron, candidate.preNeurite,
+                                   candidate.postNeurite);
+        });
+        MINDSET_TRACE_COUNTER("TouchDetector candidates", result.size());
+        return result;
+    }
+
+    size_t TouchDetector::addSynapses(Dataset& dataset, const std::vector<TouchCandidate>& candidates, UID firstUID)
+    {
+        MINDSET_TRACE_SCOPE("TouchDetector::addSynapses");
+        auto& properties = dataset.getProperties();
+        UID preNeurite = properties.defineProperty(PROPERTY_SYNAPSE_PRE_NEURITE);
+        UID postNeurite = properties.defineProperty(PROPERTY_SYNAPSE_POST_NEURITE);
+        UID prePosition = properties.defineProperty(PROPERTY_SYNAPSE_PRE_POSITION);
+        UID postPosition = properties.defineProperty(PROPERTY_SYNAPSE_POST_POSITION);
+        UID position = properties.defineProperty(PROPERTY_POSITION);
+
+        auto& circuit = dataset.getCircuit();
+        size_t added = 0;
+        UID uid = firstUID;
+        for (auto& candidate : candidates) {
+            Synapse synapse(uid++, candidate.preNeuron, candidate.postNeuron, dataset.getAllocator());
+            synapse.setProperty(preNeurite, candidate.preNeurite);
+            synapse.setProperty(postNeurite, candidate.postNeurite);
+            synapse.setProperty(prePosition, candidate.prePosition);
+            synapse.setProperty(postPosition, candidate.postPosition);
+            synapse.setProperty(position, (candidate.prePosition + candidate.postPosition) / 2.0f);
+            if (circuit.addSynapse(std::move(synapse)).second) {
+                ++added;
+            }
+        }
+        return added;
+    }
+} // namespace mindset
@@ -0,0 +1,525 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <mindset/util/MemoryReport.h>
+
+#include <algorithm>
+#include <any>
+#include <iomanip>
+#include <mutex>
+#include <ranges>
+#include <shared_mutex>
+#include <sstream>
+#include <set>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <variant>
+
+#include <mindset/Dataset.h>
+#include <mindset/DefaultProperties.h>
+#include <mindset/EventSequence.h>
+#include <mindset/TimeGrid.h>
+#include <mindset/util/NeuronTransform.h>
+
+namespace mindset
+{
+    namespace
+    {
+        /// Estimated header added by the allocator to each heap allocation.
+        constexpr size_t ALLOCATION_OVERHEAD = 2 * sizeof(void*);
+        /// Size of the links of a node of an unordered container.
+        constexpr size_t HASH_NODE_LINKS = sizeof(void*);
+        /// Size of the links and color of a node of an ordered container.
+        constexpr size_t TREE_NODE_LINKS = 3 * sizeof(void*) + sizeof(void*);
+
+        MemoryUsage heapObject(size_t payload)
+        {
+            return {payload, ALLOCATION_OVERHEAD, 1};
+        }
+
+        /**
+         * Returns the memory used by the nodes and the buckets of an unordered container.
+         * The payload of the values is not included: only the memory a node adds on top of its value.
+         */
+        MemoryUsage hashContainer(size_t size, size_t buckets)
+        {
+            MemoryUsage usage;
+            usage.overhead = size * (HASH_NODE_LINKS + ALLOCATION_OVERHEAD);
+            if (buckets > 1) {
+                usage.overhead += buckets * sizeof(void*) + ALLOCATION_OVERHEAD;
+            }
+            return usage;
+        }
+
+        template<typename Container>
+        MemoryUsage hashContainer(const Container& container)
+        {
+            MemoryUsage usage = hashContainer(container.size(), container.bucket_count());
+            usage.payload = container.size() * sizeof(typename Container::value_type);
+            return usage;
+        }
+
+        template<typename Container>
+        MemoryUsage treeContainer(const Container& container)
+        {
+            MemoryUsage usage;
+            usage.payload = container.size() * sizeof(typename Container::value_type);
+            usage.overhead = container.size() * (TREE_NODE_LINKS + ALLOCATION_OVERHEAD);
+            return usage;
+        }
+
+        template<typename T>
+        MemoryUsage vectorBuffer(const std::vector<T>& vector)
+        {
+            MemoryUsage usage;
+            usage.payload = vector.size() * sizeof(T);
+            usage.overhead = (vector.capacity() - vector.size()) * sizeof(T);
+            if (vector.capacity() > 0) {
+                usage.overhead += ALLOCATION_OVERHEAD;
+            }
+            return usage;
+        }
+
+        MemoryUsage stringBuffer(const std::string& string)
+        {
+            // Short strings are stored inside the string object.
+            if (string.capacity() <= std::string().capacity()) {
+                return {};
+            }
+            return {string.size(), string.capacity() + 1 - string.size() + ALLOCATION_OVERHEAD, 0};
+        }
+
+        MemoryUsage mutexBuffer()
+        {
+            return {0, sizeof(std::shared_mutex) + ALLOCATION_OVERHEAD, 1};
+        }
+
+        // Memory owned by a value outside its own object.
+        // The fallback is used by the types that don't own heap memory.
+
+        template<typename T>
+        MemoryUsage ownedMemory(const T&)
+        {
+            return {};
+        }
+
+        MemoryUsage ownedMemory(const std::string& string)
+        {
+            return stringBuffer(string);
+        }
+
+        template<typename T>
+        MemoryUsage ownedMemory(const std::vector<T>& vector)
+        {
+            return vectorBuffer(vector);
+        }
+
+        template<typename Value>
+        MemoryUsage ownedMemory(const EventSequence<Value>& sequence)
+        {
+            return treeContainer(sequence.getEvents());
+        }
+
+        template<typename Value>
+        MemoryUsage ownedMemory(const TimeGrid<Value>& grid)
+        {
+            MemoryUsage usage = vectorBuffer(grid.getUIDIndices());
+            usage += vectorBuffer(grid.getData());
+            for (const auto& timestep : grid.getData()) {
+                usage += vectorBuffer(timestep);
+            }
+            return usage;
+        }
+
+        template<typename T>
+        constexpr bool isStoredInsideAny()
+        {
+            // Mirrors the small-object optimization of the standard libraries.
+            return sizeof(T) <= sizeof(void*) && alignof(T) <= alignof(void*) &&
+                   std::is_nothrow_move_constructible_v<T>;
+        }
+
+        template<typename T>
+        bool measureAny(const std::any& any, MemoryUsage& usage)
+        {
+            const T* value = std::any_cast<T>(&any);
+            if (value == nullptr) {
+                return false;
+            }
+            usage = ownedMemory(*value);
+            if (!isStoredInsideAny<T>()) {
+                usage += heapObject(sizeof(T));
+            }
+            return true;
+        }
+
+        template<typename... Types>
+        bool measureAnyOf(const std::any& any, MemoryUsage& usage)
+        {
+            return (measureAny<Types>(any, usage) || ...);
+        }
+
+        /**
+         * Measures the heap memory owned by a property value.
+         * @return False if the type of the value is unknown.
+         */
+        bool measureValue(const std::any& any, MemoryUsage& usage)
+        {
+            return measureAnyOf<UID, float, double, bool, int32_t, int64_t, uint64_t, NeuriteType, std::string,
+                                rush::Vec3f, rush::Vec4f, rush::Quatf, NeuronTransform, std::vector<UID>,
+                                std::vector<float>, std::vector<double>, std::vector<rush::Vec3f>,
+                                EventSequence<std::monostate>, EventSequence<double>, EventSequence<float>,
+                                TimeGrid<double>, TimeGrid<float>>(any, usage);
+        }
+
+        class ReportBuilder
+        {
+            const Dataset& _dataset;
+            MemoryReport& _report;
+            std::unordered_map<UID, PropertyMemoryUsage> _properties;
+
+          public:
+            ReportBuilder(const Dataset& dataset, MemoryReport& report) :
+                _dataset(dataset),
+                _report(report)
+            {
+            }
+
+            /**
+             * Measures the property map of the given holder.
+             * The inline size of the holder is counted by its owner.
+             */
+            MemoryUsage properties(const PropertyHolder& holder)
+            {
+                using Entry = std::pmr::unordered_map<UID, std::any>::value_type;
+
+                const auto& map = holder.getProperties();
+                MemoryUsage usage = hashContainer(0, map.bucket_count());
+
+                for (const auto& [uid, value] : map) {
+                    auto [it, inserted] = _properties.try_emplace(uid);
+                    auto& property = it->second;
+                    if (inserted) {
+                        property.property = uid;
+                    }
+
+                    MemoryUsage entry;
+                    entry.payload = sizeof(UID);
+                    entry.overhead = sizeof(Entry) - sizeof(UID) + HASH_NODE_LINKS + ALLOCATION_OVERHEAD;
+                    entry.objects = 1;
+
+                    MemoryUsage owned;
+                    if (measureValue(value, owned)) {
+                        entry.payload += owned.payload;
+                        entry.overhead += owned.overhead;
+                    } else {
+                        ++property.unknownValues;
+                    }
+
+                    property.usage += entry;
+                    entry.objects = 0;
+                    usage += entry;
+                }
+                return usage;
+            }
+
+            void neurons()
+            {
+                size_t amount = _dataset.getNeuronsAmount();
+                auto& usage = _report.neurons;
+                usage += hashContainer(amount, amount);
+                usage.payload += amount * sizeof(std::pair<const UID, Neuron>);
+                usage.objects += amount;
+
+                for (const auto* neuron : _dataset.getNonContextualizedNeurons()) {
+                    usage += properties(*neuron);
+                    usage.overhead += mutexBuffer().overhead;
+                    _report.mutexes += mutexBuffer();
+                    if (neuron->getMorphologyPtr() != nullptr) {
+                        ++_report.morphologyReferences;
+                    }
+                }
+            }
+
+            void morphologies()
+            {
+                std::unordered_set<const Morphology*> visited;
+                for (const auto* neuron : _dataset.getNonContextualizedNeurons()) {
+                    const auto* morphology = neuron->getMorphologyPtr().get();
+                    if (morphology != nullptr && visited.insert(morphology).second) {
+                        measureMorphology(*morphology);
+                    }
+                }
+            }
+
+            void measureMorphology(const Morphology& morphology)
+            {
+                auto& usage = _report.morphologies;
+                usage += heapObject(sizeof(Morphology));
+                // Control block of the shared pointer.
+                usage.overhead += 2 * sizeof(void*) + ALLOCATION_OVERHEAD;
+                usage += properties(morphology);
+                usage.overhead += mutexBuffer().overhead;
+                _report.mutexes += mutexBuffer();
+
+                if (auto soma = morphology.getSoma()) {
+                    const Soma* s = soma.value();
+                    usage += properties(*s);
+                    usage += vectorBuffer(s->getNodes());
+                    auto extra = treeContainer(s->getExtraId());
+                    usage.payload += extra.payload;
+                    usage.overhead += extra.overhead;
+                }
+
+                size_t amount = morphology.getNeuritesAmount();
+                auto& neurites = _report.neurites;
+                neurites += hashContainer(amount, amount);
+                neurites.payload += amount * sizeof(std::pair<const UID, Neurite>);
+                neurites.objects += amount;
+                for (const auto* neurite : morphology.getNeurites()) {
+                    neurites += properties(*neurite);
+                }
+
+                if (auto tree = morphology.getMorphologyTree()) {
+                    auto& trees = _report.morphologyTrees;
+                    size_t sections = tree.value()->getSectionsAmount();
+                    trees.objects += 1;
+                    trees += hashContainer(sections, sections);
+                    trees.payload += sections * sizeof(std::pair<const UID, MorphologyTreeSection>);
+                    for (const auto& section : tree.value()->getSections()) {
+                        MemoryUsage neuritesUsage;
+                        neuritesUsage.payload = section.getNeuritesCount() * sizeof(UID);
+                        neuritesUsage.overhead = section.getNeuritesCount() > 0 ? ALLOCATION_OVERHEAD : 0;
+                        trees += neuritesUsage;
+                        trees += hashContainer(section.getChildSections());
+                    }
+                }
+            }
+
+            void circuit()
+            {
+                const auto& circuit = _dataset.getCircuit();
+                size_t amount = 0;
+                auto& usage = _report.synapses;
+                for (const auto* synapse : circuit.getSynapses()) {
+                    ++amount;
+                    usage += properties(*synapse);
+                }
+                usage += hashContainer(amount, amount);
+                usage.payload += amount * sizeof(std::pair<const UID, Synapse>);
+                usage.objects += amount;
+
+                // Each synapse has an entry in the pre-synaptic table and another in the post-synaptic one.
+                auto& indices = _report.circuitIndices;
+                for (size_t i = 0; i < 2; ++i) {
+                    indices += hashContainer(amount, amount);
+                    indices.payload += amount * sizeof(std::pair<const UID, UID>);
+                }
+                indices.objects += 2 * amount;
+
+                usage.overhead += mutexBuffer().overhead;
+                _report.mutexes += mutexBuffer();
+            }
+
+            void hierarchy(const Node& node)
+            {
+                auto& usage = _report.hierarchy;
+                usage += heapObject(sizeof(Node));
+                usage += stringBuffer(node.getType());
+
+                size_t children = node.getNodesAmount();
+                usage += hashContainer(children, children);
+                usage.payload += children * sizeof(std::pair<const UID, std::unique_ptr<Node>>);
+
+                size_t neurons = node.getNeuronsAmount();
+                usage += hashContainer(neurons, neurons);
+                usage.payload += neurons * sizeof(UID);
+
+                for (const auto* child : node.getNodes()) {
+                    hierarchy(*child);
+                }
+            }
+
+            void activities()
+            {
+                size_t amount = _dataset.getActivitiesAmount();
+                auto& usage = _report.activities;
+                usage += hashContainer(amount, amount);
+                usage.payload += amount * sizeof(std::pair<const UID, Activity>);
+                for (const auto* activity : _dataset.getActivities()) {
+                    usage += properties(*activity);
+                    usage.overhead += mutexBuffer().overhead;
+                    _report.mutexes += mutexBuffer();
+                }
+                usage.objects += amount;
+            }
+
+            void definitions()
+            {
+                const auto& properties = _dataset.getProperties();
+                auto& usage = _report.dataset;
+                usage.payload += sizeof(Dataset);
+                usage.objects = 1;
+                usage.overhead += mutexBuffer().overhead;
+                _report.mutexes += mutexBuffer();
+                // Mutex guarding the hierarchy index.
+                usage.overhead += sizeof(std::mutex) + ALLOCATION_OVERHEAD;
+
+                if (auto arena = _dataset.getArena()) {
+                    _report.arenaBytes = arena.value()->getAllocatedBytes();
+                }
+
+                // Each definition is stored in two maps: by name and by UID.
+                for (auto& [uid, property] : _properties) {
+                    if (auto name = properties.getPropertyName(uid)) {
+                        property.name = name;
+                    }
+                }
+                for (const auto& name : properties.getPropertiesNames() | std::views::values) {
+                    MemoryUsage entry = stringBuffer(name);
+                    usage.payload += 2 * (entry.payload + sizeof(std::string) + sizeof(UID));
+                    usage.overhead += 2 * (entry.overhead + TREE_NODE_LINKS + ALLOCATION_OVERHEAD);
+                }
+            }
+
+            void finish()
+            {
+                auto& list = _report.properties;
+                list.reserve(_properties.size());
+                for (auto& property : _properties | std::views::values) {
+                    list.push_back(std::move(property));
+                }
+                std::ranges::sort(list, [](const PropertyMemoryUsage& a, const PropertyMemoryUsage& b) {
+                    return a.usage.getTotal() > b.usage.getTotal();
+                });
+                _report.allocations = MemoryTracker::getStats();
+            }
+        };
+
+        std::string formatBytes(size_t bytes)
+        {
+            constexpr const char* UNITS[] = {"B", "KiB", "MiB", "GiB", "TiB"};
+            double value = static_cast<double>(bytes);
+            size_t unit = 0;
+            while (value >= 1024.0 && unit + 1 < std::size(UNITS)) {
+                value /= 1024.0;
+                ++unit;
+            }
+            std::ostringstream stream;
+            stream << std::fixed << std::setprecision(unit == 0 ? 0 : 2) << value << " " << UNITS[unit];
+            return stream.str();
+        }
+
+        void printRow(std::ostream& out, const std::string& name, const MemoryUsage& usage)
+        {
+            out << std::left << std::setw(28) << name << std::right << std::setw(12) << usage.objects
+                << std::setw(14) << formatBytes(usage.payload) << std::setw(14) << formatBytes(usage.overhead)
+                << std::setw(14) << formatBytes(usage.getTotal()) << '\n';
+        }
+    } // namespace
+
+    size_t MemoryUsage::getTotal() const
+    {
+        return payload + overhead;
+    }
+
+    MemoryUsage& MemoryUsage::operator+=(const MemoryUsage& other)
+    {
+        payload += other.payload;
+        overhead += other.overhead;
+        objects += other.objects;
+        return *this;
+    }
+
+    MemoryReport MemoryReport::compute(const Dataset& dataset)
+    {
+        MemoryReport report;
+        ReportBuilder builder(dataset, report);
+        builder.neurons();
+        builder.morphologies();
+        builder.circuit();
+        if (auto root = dataset.getHierarchy()) {
+            builder.hierarchy(*root.value());
+        }
+        builder.activities();
+        builder.definitions();
+        builder.finish();
+        return report;
+    }
+
+    MemoryUsage MemoryReport::getTotal() const
+    {
+        MemoryUsage total;
+        for (const auto* usage : {&dataset, &neurons, &morphologies, &neurites, &morphologyTrees, &synapses,
+                                  &circuitIndices, &hierarchy, &activities}) {
+            total += *usage;
+        }
+        return total;
+    }
+
+    void MemoryReport::print(std::ostream& out, size_t maxProperties) const
+    {
+        auto flags = out.flags();
+        out << std::left << std::setw(28) << "Subsystem" << std::right << std::setw(12) << "Objects" << std::setw(14)
+            << "Payload" << std::setw(14) << "Overhead" << std::setw(14) << "Total" << '\n';
+        printRow(out, "Dataset", dataset);
+        printRow(out, "Neurons", neurons);
+        printRow(out, "Morphologies", morphologies);
+        printRow(out, "Neurites", neurites);
+        printRow(out, "Morphology trees", morphologyTrees);
+        printRow(out, "Synapses", synapses);
+        printRow(out, "Circuit indices", circuitIndices);
+        printRow(out, "Hierarchy", hierarchy);
+        printRow(out, "Activities", activities);
+        printRow(out, "Total", getTotal());
+        out << '\n';
+        printRow(out, "Mutexes", mutexes);
+        out << "Morphology references: " << morphologyReferences << '\n';
+        if (arenaBytes > 0) {
+            out << "Arena: " << formatBytes(arenaBytes) << '\n';
+        }
+
+        if (!properties.empty()) {
+            out << '\n' << std::left << std::setw(28) << "Property" << std::right << std::setw(12) << "Values"
+                << std::setw(14) << "Payload" << std::setw(14) << "Overhead" << std::setw(14) << "Total" << '\n';
+            size_t amount = std::min(maxProperties, properties.size());
+            for (size_t i = 0; i < amount; ++i) {
+                const auto& property = properties[i];
+                std::string name = property.name.value_or("#" + std::to_string(property.property));
+                if (property.unknownValues > 0) {
+                    name += " (unknown type)";
+                }
+                printRow(out, name, property.usage);
+            }
+        }
+
+        if (!allocations.empty()) {
+            out << '\n' << std::left << std::setw(28) << "Allocation scope" << std::right << std::setw(12)
+                << "Live" << std::setw(14) << "Live bytes" << std::setw(14) << "Allocations" << std::setw(14)
+                << "Bytes" << '\n';
+            for (const auto& stats : allocations) {
+                out << std::left << std::setw(28) << stats.scope << std::right << std::setw(12)
+                    << stats.liveAllocations << std::setw(14) << formatBytes(stats.liveBytes) << std::setw(14)
+                    << stats.totalAllocations << std::setw(14) << formatBytes(stats.totalBytes) << '\n';
+            }
+        }
+        out.flags(flags);
+    }
+} // namespace mindset
@@ -0,0 +1,246 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <mindset/util/MemoryTracker.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace mindset
+{
+    namespace
+    {
+        struct ScopeCounters
+        {
+            std::atomic<const char*> name{nullptr};
+            std::atomic<int64_t> liveBytes{0};
+            std::atomic<int64_t> liveAllocations{0};
+            std::atomic<uint64_t> totalBytes{0};
+            std::atomic<uint64_t> totalAllocations{0};
+        };
+
+        // These globals must not allocate: they are used by the replaced operator new.
+        std::array<ScopeCounters, MemoryTracker::MAX_SCOPES> scopes;
+        std::atomic_uint32_t registeredScopes{1};
+        thread_local uint32_t currentScope = MemoryTracker::UNTRACKED_SCOPE;
+    } // namespace
+
+#ifdef MINDSET_TRACK_ALLOCATIONS
+    namespace
+    {
+        /**
+         * Stored before each tracked allocation. Its alignment keeps the returned pointer aligned
+         * as if it was returned by std::malloc.
+         */
+        struct alignas(std::max_align_t) AllocationHeader
+        {
+            size_t size;
+            uint32_t scope;
+        };
+
+        void* trackedAllocate(size_t size) noexcept
+        {
+            auto* header = static_cast<AllocationHeader*>(std::malloc(sizeof(AllocationHeader) + size));
+            if (header == nullptr) {
+                return nullptr;
+            }
+            uint32_t scope = currentScope;
+            header->size = size;
+            header->scope = scope;
+
+            auto& counters = scopes[scope];
+            counters.liveBytes.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed);
+            counters.liveAllocations.fetch_add(1, std::memory_order_relaxed);
+            counters.totalBytes.fetch_add(size, std::memory_order_relaxed);
+            counters.totalAllocations.fetch_add(1, std::memory_order_relaxed);
+            return header + 1;
+        }
+
+        void trackedFree(void* pointer) noexcept
+        {
+            if (pointer == nullptr) {
+                return;
+            }
+            auto* header = static_cast<AllocationHeader*>(pointer) - 1;
+            auto& counters = scopes[header->scope];
+            counters.liveBytes.fetch_sub(static_cast<int64_t>(header->size), std::memory_order_relaxed);
+            counters.liveAllocations.fetch_sub(1, std::memory_order_relaxed);
+            std::free(header);
+        }
+
+        void* trackedAllocateOrThrow(size_t size)
+        {
+            void* pointer = trackedAllocate(size == 0 ? 1 : size);
+            while (pointer == nullptr) {
+                std::new_handler handler = std::get_new_handler();
+                if (handler == nullptr) {
+                    throw std::bad_alloc();
+                }
+                handler();
+                pointer = trackedAllocate(size == 0 ? 1 : size);
+            }
+            return pointer;
+        }
+    } // namespace
+#endif
+
+    bool MemoryTracker::isAvailable()
+    {
+#ifdef MINDSET_TRACK_ALLOCATIONS
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    uint32_t MemoryTracker::getScope(const char* name)
+    {
+        uint32_t amount = registeredScopes.load(std::memory_order_acquire);
+        for (uint32_t i = 1; i < amount; ++i) {
+            const char* scopeName = scopes[i].name.load(std::memory_order_acquire);
+            if (scopeName != nullptr && (scopeName == name || std::strcmp(scopeName, name) == 0)) {
+                return i;
+            }
+        }
+
+        uint32_t index = registeredScopes.fetch_add(1, std::memory_order_acq_rel);
+        if (index >= MAX_SCOPES) {
+            registeredScopes.store(MAX_SCOPES, std::memory_order_release);
+            return UNTRACKED_SCOPE;
+        }
+        // Two threads may register the same name concurrently. Both scopes are valid and reported separately.
+        scopes[index].name.store(name, std::memory_order_release);
+        return index;
+    }
+
+    uint32_t MemoryTracker::getCurrentScope()
+    {
+        return currentScope;
+    }
+
+    uint32_t MemoryTracker::setCurrentScope(uint32_t scope)
+    {
+        uint32_t previous = currentScope;
+        currentScope = scope < MAX_SCOPES ? scope : UNTRACKED_SCOPE;
+        return previous;
+    }
+
+    std::vector<AllocationStats> MemoryTracker::getStats()
+    {
+        std::vector<AllocationStats> result;
+        if (!isAvailable()) {
+            return result;
+        }
+
+        uint32_t amount = std::min(registeredScopes.load(std::memory_order_acquire), MAX_SCOPES);
+        for (uint32_t i = 0; i < amount; ++i) {
+            auto& counters = scopes[i];
+            uint64_t totalAllocations = counters.totalAllocations.load(std::memory_order_relaxed);
+            if (totalAllocations == 0) {
+                continue;
+            }
+            const char* name = i == UNTRACKED_SCOPE ? "untracked" : counters.name.load(std::memory_order_acquire);
+
+            AllocationStats stats;
+            stats.scope = name == nullptr ? "unknown" : name;
+            stats.liveBytes = static_cast<size_t>(std::max<int64_t>(0, counters.liveBytes.load()));
+            stats.liveAllocations = static_cast<size_t>(std::max<int64_t>(0, counters.liveAllocations.load()));
+            stats.totalBytes = counters.totalBytes.load(std::memory_order_relaxed);
+            stats.totalAllocations = totalAllocations;
+            result.push_back(std::move(stats));
+        }
+        return result;
+    }
+
+    AllocationScope::AllocationScope(const char* name) :
+        _previous(MemoryTracker::setCurrentScope(MemoryTracker::getScope(name)))
+    {
+    }
+
+    AllocationScope::AllocationScope(uint32_t scope) :
+        _previous(MemoryTracker::setCurrentScope(scope))
+    {
+    }
+
+    AllocationScope::~AllocationScope()
+    {
+        MemoryTracker::setCurrentScope(_previous);
+    }
+} // namespace mindset
+
+#ifdef MINDSET_TRACK_ALLOCATIONS
+
+// Replacements of the global allocation functions.
+// The aligned overloads are not replaced: they keep using the default implementation and are not tracked.
+
+void* operator new(std::size_t size)
+{
+    return mindset::trackedAllocateOrThrow(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return mindset::trackedAllocateOrThrow(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return mindset::trackedAllocate(size == 0 ? 1 : size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return mindset::trackedAllocate(size == 0 ? 1 : size);
+}
+
+void operator delete(void* pointer) noexcept
+{
+    mindset::trackedFree(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    mindset::trackedFree(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    mindset::trackedFree(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept
+{
+    mindset::trackedFree(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept
+{
+    mindset::trackedFree(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept
+{
+    mindset::trackedFree(pointer);
+}
+
+#endif
@@ -0,0 +1,365 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <mindset/util/MorphologyLOD.h>
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+
+#include <mindset/DefaultProperties.h>
+
+namespace
+{
+    using namespace mindset;
+
+    struct Point
+    {
+        rush::Vec3f position;
+        float radius;
+        std::optional<UID> parent;
+        const Neurite* neurite;
+    };
+
+    struct Vertex
+    {
+        UID uid;
+        rush::Vec3f position;
+        float radius;
+        /// The neurite this vertex is or copies its properties from.
+        const Neurite* source;
+    };
+
+    float vertexError(const Vertex& from, const Vertex& to, const Vertex& vertex)
+    {
+        auto segment = to.position - from.position;
+        float squaredLength = segment.squaredLength();
+        float t = 0.0f;
+        if (squaredLength > 0.0f) {
+            t = std::clamp((vertex.position - from.position).dot(segment) / squaredLength, 0.0f, 1.0f);
+        }
+        auto closest = from.position + segment * t;
+        float radius = from.radius + (to.radius - from.radius) * t;
+        return std::max((vertex.position - closest).length(), std::abs(vertex.radius - radius));
+    }
+
+    /**
+     * Marks the vertices to keep. The first and last vertices are always kept.
+     */
+    std::vector<bool> douglasPeucker(const std::vector<Vertex>& vertices, const LODSettings& settings)
+    {
+        std::vector<bool> keep(vertices.size(), settings.tolerance <= 0.0f && settings.radiusFactor <= 0.0f);
+        keep.front() = true;
+        keep.back() = true;
+
+        std::vector<std::pair<size_t, size_t>> stack = {{0, vertices.size() - 1}};
+        while (!stack.empty()) {
+            auto [first, last] = stack.back();
+            stack.pop_back();
+            if (last - first < 2) {
+                continue;
+            }
+
+            // Split at the vertex exceeding its tolerance the most.
+            float maxExcess = 0.0f;
+            size_t split = 0;
+            for (size_t i = first + 1; i < last; ++i) {
+                float tolerance = settings.tolerance + settings.radiusFactor * vertices[i].radius;
+                float excess = vertexError(vertices[first], vertices[last], vertices[i]) - tolerance;
+                if (excess > maxExcess) {
+                    maxExcess = excess;
+                    split = i;
+                }
+            }
+
+            if (split != 0) {
+                keep[split] = true;
+                stack.emplace_back(first, split);
+                stack.emplace_back(split, last);
+            }
+        }
+
+        return keep;
+    }
+
+    /**
+     * Resamples the polyline at uniform arc length, keeping its first and last vertices.
+     * @param sourceToOutput Filled with the index of the first output vertex at or after each input vertex.
+     */
+    std::vector<Vertex> resample(const std::vector<Vertex>& vertices, float length, UID& nextUID,
+                                 std::vector<size_t>& sourceToOutput)
+    {
+        std::vector<float> arc(vertices.size(), 0.0f);
+        for (size_t i = 1; i < vertices.size(); ++i) {
+            arc[i] = arc[i - 1] + (vertices[i].position - vertices[i - 1].position).length();
+        }
+        float total = arc.back();
+
+        std::vector<Vertex> result = {vertices.front()};
+        std::vector<float> resultArc = {0.0f};
+        size_t segment = 1;
+        for (float distance = length; distance < total; distance += length) {
+            while (arc[segment] < distance) {
+                ++segment;
+            }
+            auto& from = vertices[segment - 1];
+            auto& to = vertices[segment];
+            float segmentLength = arc[segment] - arc[segment - 1];
+            float t = segmentLength > 0.0f ? (distance - arc[segment - 1]) / segmentLength : 0.0f;
+            result.push_back({nextUID++, from.position + (to.position - from.position) * t,
+                              from.radius + (to.radius - from.radius) * t, to.source});
+            resultArc.push_back(distance);
+        }
+        result.push_back(vertices.back());
+        resultArc.push_back(total);
+
+        sourceToOutput.resize(vertices.size());
+        size_t output = 0;
+        for (size_t i = 0; i < vertices.size(); ++i) {
+            while (output + 1 < resultArc.size() && resultArc[output] < arc[i]) {
+                ++output;
+            }
+            sourceToOutput[i] = output;
+        }
+        sourceToOutput.back() = result.size() - 1;
+        return result;
+    }
+} // namespace
+
+namespace mindset
+{
+    SimplifiedMorphology simplifyMorphology(const Dataset& dataset, const Morphology& morphology,
+                                            const LODSettings& settings)
+    {
+        auto& properties = dataset.getProperties();
+        auto positionProperty = properties.getPropertyUID(PROPERTY_POSITION);
+        auto radiusProperty = properties.getPropertyUID(PROPERTY_RADIUS);
+        auto parentProperty = properties.getPropertyUID(PROPERTY_PARENT);
+
+        SimplifiedMorphology result;
+        result.morphology = std::make_shared<Morphology>();
+        result.sourceNeurites = morphology.getNeuritesAmount();
+        auto& output = *result.morphology;
+
+        for (auto& [uid, value] : morphology.getProperties()) {
+            output.setProperty(uid, value);
+        }
+
+        UID nextUID = 0;
+        if (auto soma = morphology.getSoma()) {
+            output.setSoma(*soma.value());
+            nextUID = soma.value()->getUID() + 1;
+        }
+
+        std::unordered_map<UID, Point> points;
+        points.reserve(morphology.getNeuritesAmount());
+        for (const Neurite* neurite : morphology.getNeurites()) {
+            nextUID = std::max(nextUID, neurite->getUID() + 1);
+            std::optional<rush::Vec3f> position;
+            if (positionProperty) {
+                position = neurite->getProperty<rush::Vec3f>(positionProperty.value());
+            }
+            if (!position) {
+                output.addNeurite(*neurite);
+                result.remap[neurite->getUID()] = neurite->getUID();
+                continue;
+            }
+            Point point{position.value(), 0.0f, {}, neurite};
+            if (radiusProperty) {
+                point.radius = neurite->getProperty<float>(radiusProperty.value()).value_or(0.0f);
+            }
+            if (parentProperty) {
+                point.parent = neurite->getProperty<UID>(parentProperty.value());
+            }
+            points.emplace(neurite->getUID(), point);
+        }
+
+        std::unordered_map<UID, std::vector<UID>> children;
+        std::vector<UID> sectionStarts;
+        for (auto& [uid, point] : points) {
+            if (point.parent && points.contains(point.parent.value())) {
+                children[point.parent.value()].push_back(uid);
+            } else {
+                sectionStarts.push_back(uid);
+            }
+        }
+        // Deterministic UIDs for the resampled points.
+        std::ranges::sort(sectionStarts);
+
+        auto childrenOf = [&children](UID uid) -> const std::vector<UID>* {
+            auto it = children.find(uid);
+            return it == children.end() ? nullptr : &it->second;
+        };
+
+        while (!sectionStarts.empty()) {
+            UID start = sectionStarts.back();
+            sectionStarts.pop_back();
+            auto& startPoint = points.at(start);
+
+            // The branch point the section hangs from, if any, is the fixed first vertex.
+            std::vector<Vertex> vertices;
+            bool anchored = startPoint.parent && points.contains(startPoint.parent.value());
+            if (anchored) {
+                auto& anchor = points.at(startPoint.parent.value());
+                vertices.push_back({startPoint.parent.value(), anchor.position, anchor.radius, anchor.neurite});
+            }
+
+            UID current = start;
+            while (true) {
+                auto& point = points.at(current);
+                vertices.push_back({current, point.position, point.radius, point.neurite});
+                auto* next = childrenOf(current);
+                if (next == nullptr || next->size() != 1) {
+                    if (next != nullptr) {
+                        std::vector<UID> sorted = *next;
+                        std::ranges::sort(sorted, std::greater<>());
+                        sectionStarts.insert(sectionStarts.end(), sorted.begin(), sorted.end());
+                    }
+                    break;
+                }
+                current = next->front();
+            }
+
+            std::vector<size_t> sourceToOutput(vertices.size());
+            for (size_t i = 0; i < vertices.size(); ++i) {
+                sourceToOutput[i] = i;
+            }
+            if (settings.resampleLength > 0.0f && vertices.size() > 1) {
+                vertices = resample(vertices, settings.resampleLength, nextUID, sourceToOutput);
+            }
+
+            auto keep = douglasPeucker(vertices, settings);
+
+            // Each vertex is covered by the segment ending at the next kept vertex.
+            std::vector<size_t> coveringVertex(vertices.size());
+            size_t nextKept = vertices.size() - 1;
+            for (size_t i = vertices.size(); i > 0; --i) {
+                if (keep[i - 1]) {
+                    nextKept = i - 1;
+                }
+                coveringVertex[i - 1] = nextKept;
+            }
+
+            // The source neurites of the section, in order. The anchor belongs to its own section.
+            size_t firstSource = anchored ? 1 : 0;
+            UID walk = start;
+            for (size_t i = firstSource; i < sourceToOutput.size(); ++i) {
+                result.remap[walk] = vertices[coveringVertex[sourceToOutput[i]]].uid;
+                if (i + 1 < sourceToOutput.size()) {
+                    walk = childrenOf(walk)->front();
+                }
+            }
+
+            std::optional<UID> previous;
+            if (anchored) {
+                previous = vertices.front().uid;
+            }
+            for (size_t i = anchored ? 1 : 0; i < vertices.size(); ++i) {
+                if (!keep[i]) {
+                    continue;
+                }
+                auto& vertex = vertices[i];
+                Neurite neurite(vertex.uid);
+                for (auto& [uid, value] : vertex.source->getProperties()) {
+                    neurite.setProperty(uid, value);
+                }
+                if (vertex.uid != vertex.source->getUID()) {
+                    neurite.setProperty(positionProperty.value(), vertex.position);
+                    if (radiusProperty) {
+                        neurite.setProperty(radiusProperty.value(), vertex.radius);
+                    }
+                }
+                if (previous) {
+                    neurite.setProperty(parentProperty.value(), previous.value());
+                }
+                output.addNeurite(std::move(neurite));
+                previous = vertex.uid;
+            }
+        }
+
+        result.neurites = output.getNeuritesAmount();
+        return result;
+    }
+
+    MorphologyLODCache::MorphologyLODCache(std::vector<LODSettings> levels) :
+        _levels(std::move(levels))
+    {
+    }
+
+    size_t MorphologyLODCache::getLevelsAmount() const
+    {
+        return _levels.size();
+    }
+
+    const LODSettings& MorphologyLODCache::getLevelSettings(size_t level) const
+    {
+        return _levels.at(level);
+    }
+
+    std::shared_ptr<const SimplifiedMorphology> MorphologyLODCache::getLevel(
+        const Dataset& dataset, const std::shared_ptr<Morphology>& morphology, size_t level)
+    {
+        if (morphology == nullptr || level >= _levels.size()) {
+            return nullptr;
+        }
+
+        {
+            std::lock_guard lock(_mutex);
+            auto it = _entries.find(morphology.get());
+            if (it != _entries.end() && it->second.morphology.lock() == morphology &&
+                it->second.version == morphology->getVersion() && it->second.levels[level] != nullptr) {
+                return it->second.levels[level];
+            }
+        }
+
+        // Simplify outside the lock so different morphologies can be processed concurrently.
+        auto simplified =
+            std::make_shared<const SimplifiedMorphology>(simplifyMorphology(dataset, *morphology, _levels[level]));
+
+        std::lock_guard lock(_mutex);
+        auto& entry = _entries[morphology.get()];
+        if (entry.morphology.lock() != morphology || entry.version != morphology->getVersion()) {
+            entry = {morphology, morphology->getVersion(), {}};
+            entry.levels.resize(_levels.size());
+        }
+        entry.levels[level] = simplified;
+        return simplified;
+    }
+
+    size_t MorphologyLODCache::prune()
+    {
+        std::lock_guard lock(_mutex);
+        return std::erase_if(_entries, [](const auto& pair) {
+            auto morphology = pair.second.morphology.lock();
+            return morphology == nullptr || morphology->getVersion() != pair.second.version;
+        });
+    }
+
+    void MorphologyLODCache::clear()
+    {
+        std::lock_guard lock(_mutex);
+        _entries.clear();
+    }
+
+    size_t MorphologyLODCache::size() const
+    {
+        std::lock_guard lock(_mutex);
+        return _entries.size();
+    }
+} // namespace mindset
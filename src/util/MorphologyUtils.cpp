@@ -24,8 +24,9 @@
 #include <mindset/Dataset.h>
 #include <mindset/Morphology.h>
 #include <mindset/UID.h>
-#include <mindset/util/Getters.h>
 #include <mindset/util/MorphologyUtils.h>
+#include <mindset/util/WorldGeometryCache.h>
+#include <mindset/util/Trace.h>
 
 namespace
 {
@@ -46,47 +47,7 @@ namespace mindset
     ClosestNeuriteResult closestNeuriteToPosition(const Dataset& dataset, const Morphology& morphology,
                                                   const rush::Vec3f& point, const NeuronTransform* transform)
     {
-        // This is faster because there's only one point!
-        rush::Vec3f localPoint = point;
-        if (transform != nullptr) {
-            localPoint = transform->positionToLocalCoordinates(point);
-        }
-
-        auto positions = getNeuritesProperties<rush::Vec3f>(dataset, morphology, PROPERTY_POSITION);
-        auto parents = getNeuritesProperties<UID>(dataset, morphology, PROPERTY_PARENT);
-
-        std::optional<UID> result;
-        float resultT = 0;
-        rush::Vec3f resultPosition;
-        float resultDistance = std::numeric_limits<float>::max();
-
-        for (UID uid : morphology.getNeuritesUIDs()) {
-            auto position = positions.find(uid);
-            auto parent = parents.find(uid);
-            if (position == positions.end() || parent == parents.end()) {
-                continue;
-            }
-            auto parentPosition = positions.find(parent->second);
-            if (parentPosition == positions.end()) {
-                continue;
-            }
-
-            auto from = parentPosition->second;
-            auto to = position->second;
-            auto [distance, t] = squaredDistanceToLine(from, to, localPoint);
-            if (distance < resultDistance) {
-                resultDistance = distance;
-                resultT = t;
-                result = uid;
-                resultPosition = from + (to - from) * t;
-            }
-        }
-
-        if (transform != nullptr) {
-            resultPosition = transform->positionToGlobalCoordinates(resultPosition);
-        }
-
-        return {result.has_value(), result.value_or(0), resultDistance, resultT, resultPosition};
+        return closestNeuriteToPosition(dataset, morphology, std::vector{point}, transform).front();
     }
 
     std::optional<Morphology*> getMorphology(Dataset& dataset, UID neuronId)
@@ -180,39 +141,35 @@ namespace mindset
                                                                const std::vector<rush::Vec3f>& points,
                                                                const NeuronTransform* transform)
     {
-        auto positions = getNeuritesProperties<rush::Vec3f>(dataset, morphology, PROPERTY_POSITION);
-        auto parents = getNeuritesProperties<UID>(dataset, morphology, PROPERTY_PARENT);
+        MINDSET_TRACE_SCOPE("closestNeuriteToPosition");
+        auto geometry = MorphologyGeometry::extract(dataset, morphology);
 
-        // This is faster because there's only one point!
         std::vector<rush::Vec3f> localPoints = points;
         if (transform != nullptr) {
-            for (auto& point : localPoints) {
-                point = transform->positionToLocalCoordinates(point);
-            }
+            transform->positionsToLocalCoordinates(localPoints, localPoints);
         }
 
-        std::vector<ClosestNeuriteResult> results(localPoints.size(), {.valid = false});
+        std::vector<ClosestNeuriteResult> results(localPoints.size(),
+                                                  {.valid = false,
+                                                   .uid = 0,
+                                                   .distanceSquared = std::numeric_limits<float>::max(),
+                                                   .t = 0.0f,
+                                                   .position = rush::Vec3f(0.0f)});
 
-        for (UID uid : morphology.getNeuritesUIDs()) {
-            auto position = positions.find(uid);
-            auto parent = parents.find(uid);
-            if (position == positions.end() || parent == parents.end()) {
-                continue;
-            }
-            auto parentPosition = positions.find(parent->second);
-            if (parentPosition == positions.end()) {
+        for (size_t segment = 0; segment < geometry.neurites.size(); ++segment) {
+            if (!geometry.hasParentPoint(segment)) {
                 continue;
             }
 
+            auto from = geometry.positions[geometry.parents[segment]];
+            auto to = geometry.positions[segment];
             for (size_t i = 0; i < localPoints.size(); i++) {
                 auto& result = results[i];
-                auto from = parentPosition->second;
-                auto to = position->second;
-                auto [distance, t] = squaredDistanceToLine(parentPosition->second, position->second, localPoints[i]);
+                auto [distance, t] = squaredDistanceToLine(from, to, localPoints[i]);
                 if (!result.valid || distance < result.distanceSquared) {
                     result.distanceSquared = distance;
                     result.t = t;
-                    result.uid = uid;
+                    result.uid = geometry.neurites[segment];
                     result.valid = true;
                     result.position = from + (to - from) * t;
                 }
@@ -220,12 +177,17 @@ namespace mindset
         }
 
         if (transform != nullptr) {
+            std::vector<rush::Vec3f> positions;
+            positions.reserve(results.size());
             for (auto& result : results) {
-                result.position = transform->positionToGlobalCoordinates(result.position);
+                positions.push_back(result.position);
+            }
+            transform->positionsToGlobalCoordinates(positions, positions);
+            for (size_t i = 0; i < results.size(); ++i) {
+                results[i].position = positions[i];
             }
         }
 
         return results;
     }
-
 } // namespace mindset
\ No newline at end of file
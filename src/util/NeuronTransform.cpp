@@ -19,31 +19,30 @@
 
 #include <mindset/util/NeuronTransform.h>
 
+#include <algorithm>
+
 namespace mindset
 {
-    void NeuronTransform::recalculateIfRequired() const
+    void NeuronTransform::recalculate()
     {
-        if (!_dirty) {
-            return;
-        }
         _quat = rush::Quatf::euler(_rotation);
         _model = rush::Mat4f::model(_scale, _quat, _position);
         _normal = rush::Mat4f::normal(_scale, _quat);
 
-        _dirty = false;
+        _axisX = _quat * rush::Vec3f(1.0f, 0.0f, 0.0f);
+        _axisY = _quat * rush::Vec3f(0.0f, 1.0f, 0.0f);
+        _axisZ = _quat * rush::Vec3f(0.0f, 0.0f, 1.0f);
     }
 
     NeuronTransform::NeuronTransform() :
-        _model(1),
-        _normal(1),
         _position(0),
-        _scale(1),
-        _dirty(false)
+        _rotation(0),
+        _scale(1)
     {
+        recalculate();
     }
 
-    NeuronTransform::NeuronTransform(const rush::Mat4f& model) :
-        _dirty(true)
+    NeuronTransform::NeuronTransform(const rush::Mat4f& model)
     {
         _position = model[3](0, 1, 2);
         _scale.x() = model[0](0, 1, 2).toVec().length();
@@ -56,17 +55,16 @@ namespace mindset
         rot[2] /= _scale.z();
 
         _rotation = rush::Quatf::fromRotationMatrix(rot).euler();
+        recalculate();
     }
 
     const rush::Mat4f& NeuronTransform::getModel() const
     {
-        recalculateIfRequired();
         return _model;
     }
 
     const rush::Mat4f& NeuronTransform::getNormal() const
     {
-        recalculateIfRequired();
         return _normal;
     }
 
@@ -81,7 +79,7 @@ namespace mindset
             return;
         }
         _position = position;
-        _dirty = true;
+        recalculate();
     }
 
     const rush::Vec3f& NeuronTransform::getRotation() const
@@ -95,7 +93,7 @@ namespace mindset
             return;
         }
         _rotation = rotation;
-        _dirty = true;
+        recalculate();
     }
 
     const rush::Vec3f& NeuronTransform::getScale() const
@@ -109,18 +107,16 @@ namespace mindset
             return;
         }
         _scale = scale;
-        _dirty = true;
+        recalculate();
     }
 
     rush::Vec3f NeuronTransform::positionToGlobalCoordinates(rush::Vec3f local) const
     {
-        recalculateIfRequired();
         return _quat * (_scale * local) + _position;
     }
 
     rush::Vec3f NeuronTransform::vectorToGlobalCoordinates(rush::Vec3f local) const
     {
-        recalculateIfRequired();
         return _quat * (_scale * local);
     }
 
@@ -134,4 +130,55 @@ namespace mindset
         return _quat.conjugate() * global / _scale;
     }
 
+    void NeuronTransform::positionsToGlobalCoordinates(std::span<const rush::Vec3f> local,
+                                                       std::span<rush::Vec3f> global) const
+    {
+        // Model matrix coefficients hoisted into scalars so the loop can be auto-vectorized.
+        const float m00 = _axisX.x() * _scale.x(), m01 = _axisX.y() * _scale.x(), m02 = _axisX.z() * _scale.x();
+        const float m10 = _axisY.x() * _scale.y(), m11 = _axisY.y() * _scale.y(), m12 = _axisY.z() * _scale.y();
+        const float m20 = _axisZ.x() * _scale.z(), m21 = _axisZ.y() * _scale.z(), m22 = _axisZ.z() * _scale.z();
+        const float px = _position.x(), py = _position.y(), pz = _position.z();
+
+        size_t amount = std::min(local.size(), global.size());
+        for (size_t i = 0; i < amount; ++i) {
+            float x = local[i].x();
+            float y = local[i].y();
+            float z = local[i].z();
+            global[i] = rush::Vec3f(m00 * x + m10 * y + m20 * z + px, m01 * x + m11 * y + m21 * z + py,
+                                    m02 * x + m12 * y + m22 * z + pz);
+        }
+    }
+
+    std::vector<rush::Vec3f> NeuronTransform::positionsToGlobalCoordinates(std::span<const rush::Vec3f> local) const
+    {
+        std::vector<rush::Vec3f> result(local.size());
+        positionsToGlobalCoordinates(local, result);
+        return result;
+    }
+
+    void NeuronTransform::positionsToLocalCoordinates(std::span<const rush::Vec3f> global,
+                                                      std::span<rush::Vec3f> local) const
+    {
+        // The inverse of the rotation is its transpose: each local component is a dot product with an axis.
+        const float ix = 1.0f / _scale.x(), iy = 1.0f / _scale.y(), iz = 1.0f / _scale.z();
+        const float m00 = _axisX.x() * ix, m01 = _axisX.y() * ix, m02 = _axisX.z() * ix;
+        const float m10 = _axisY.x() * iy, m11 = _axisY.y() * iy, m12 = _axisY.z() * iy;
+        const float m20 = _axisZ.x() * iz, m21 = _axisZ.y() * iz, m22 = _axisZ.z() * iz;
+        const float px = _position.x(), py = _position.y(), pz = _position.z();
+
+        size_t amount = std::min(local.size(), global.size());
+        for (size_t i = 0; i < amount; ++i) {
+            float x = global[i].x() - px;
+            float y = global[i].y() - py;
+            float z = global[i].z() - pz;
+            local[i] = rush::Vec3f(m00 * x + m01 * y + m02 * z, m10 * x + m11 * y + m12 * z,
+                                   m20 * x + m21 * y + m22 * z);
+        }
+    }
+
+    bool NeuronTransform::operator==(const NeuronTransform& other) const
+    {
+        return _position == other._position && _rotation == other._rotation && _scale == other._scale;
+    }
+
 } // namespace mindset
@@ -0,0 +1,216 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <mindset/util/Trace.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <unordered_map>
+
+namespace mindset
+{
+    namespace
+    {
+        void writeJSONString(std::ostream& out, std::string_view string)
+        {
+            out << '"';
+            for (char c : string) {
+                switch (c) {
+                    case '"':
+                        out << "\\\"";
+                        break;
+                    case '\\':
+                        out << "\\\\";
+                        break;
+                    case '\n':
+                        out << "\\n";
+                        break;
+                    case '\t':
+                        out << "\\t";
+                        break;
+                    default:
+                        if (static_cast<unsigned char>(c) < 0x20) {
+                            out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c)
+                                << std::dec << std::setfill(' ');
+                        } else {
+                            out << c;
+                        }
+                }
+            }
+            out << '"';
+        }
+    } // namespace
+
+    std::string_view TraceEvent::getName() const
+    {
+        if (!dynamicName.empty()) {
+            return dynamicName;
+        }
+        return name == nullptr ? std::string_view() : std::string_view(name);
+    }
+
+    Tracer::Tracer() :
+        _enabled(false),
+        _origin(Clock::now())
+    {
+    }
+
+    Tracer::ThreadBuffer& Tracer::getThreadBuffer()
+    {
+        // The buffer is shared with the tracer, so it stays valid even if the thread ends before the trace is written.
+        thread_local std::shared_ptr<ThreadBuffer> buffer;
+        if (buffer == nullptr) {
+            buffer = std::make_shared<ThreadBuffer>();
+            std::lock_guard lock(_mutex);
+            buffer->thread = static_cast<uint32_t>(_buffers.size());
+            _buffers.push_back(buffer);
+        }
+        return *buffer;
+    }
+
+    Tracer& Tracer::getInstance()
+    {
+        static Tracer tracer;
+        return tracer;
+    }
+
+    void Tracer::setEnabled(bool enabled)
+    {
+        _enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    void Tracer::recordScope(const char* name, Clock::time_point start)
+    {
+        auto end = Clock::now();
+        auto& buffer = getThreadBuffer();
+        std::lock_guard lock(buffer.mutex);
+        buffer.events.push_back(TraceEvent{TraceEvent::Type::SCOPE, name, {}, (start - _origin).count(),
+                                           (end - start).count(), 0.0, buffer.thread});
+    }
+
+    void Tracer::recordScope(std::string name, Clock::time_point start)
+    {
+        auto end = Clock::now();
+        auto& buffer = getThreadBuffer();
+        std::lock_guard lock(buffer.mutex);
+        buffer.events.push_back(TraceEvent{TraceEvent::Type::SCOPE, nullptr, std::move(name),
+                                           (start - _origin).count(), (end - start).count(), 0.0, buffer.thread});
+    }
+
+    void Tracer::recordCounter(const char* name, double value)
+    {
+        auto now = Clock::now();
+        auto& buffer = getThreadBuffer();
+        std::lock_guard lock(buffer.mutex);
+        buffer.events.push_back(
+            TraceEvent{TraceEvent::Type::COUNTER, name, {}, (now - _origin).count(), 0, value, buffer.thread});
+    }
+
+    std::vector<TraceEvent> Tracer::getEvents()
+    {
+        std::vector<TraceEvent> events;
+        {
+            std::lock_guard lock(_mutex);
+            for (auto& buffer : _buffers) {
+                std::lock_guard bufferLock(buffer->mutex);
+                events.insert(events.end(), buffer->events.begin(), buffer->events.end());
+            }
+        }
+        std::stable_sort(events.begin(), events.end(),
+                         [](const TraceEvent& a, const TraceEvent& b) { return a.start < b.start; });
+        return events;
+    }
+
+    std::vector<TraceSummary> Tracer::getSummary()
+    {
+        std::vector<TraceSummary> result;
+        std::unordered_map<std::string_view, size_t> indices;
+
+        auto events = getEvents();
+        for (const auto& event : events) {
+            if (event.type != TraceEvent::Type::SCOPE) {
+                continue;
+            }
+            auto [it, inserted] = indices.try_emplace(event.getName(), result.size());
+            if (inserted) {
+                result.push_back(TraceSummary{std::string(event.getName())});
+            }
+            auto& summary = result[it->second];
+            std::chrono::nanoseconds duration(event.duration);
+            ++summary.count;
+            summary.total += duration;
+            summary.max = std::max(summary.max, duration);
+        }
+
+        std::sort(result.begin(), result.end(),
+                  [](const TraceSummary& a, const TraceSummary& b) { return a.total > b.total; });
+        return result;
+    }
+
+    void Tracer::clear()
+    {
+        std::lock_guard lock(_mutex);
+        for (auto& buffer : _buffers) {
+            std::lock_guard bufferLock(buffer->mutex);
+            buffer->events.clear();
+        }
+    }
+
+    void Tracer::writeChromeTrace(std::ostream& out)
+    {
+        auto events = getEvents();
+
+        // Timestamps are written in microseconds, as required by the format.
+        auto flags = out.flags();
+        out << std::fixed << std::setprecision(3);
+        out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        bool first = true;
+        for (const auto& event : events) {
+            if (!first) {
+                out << ',';
+            }
+            first = false;
+
+            out << "\n{\"name\":";
+            writeJSONString(out, event.getName());
+            out << ",\"cat\":\"mindset\",\"pid\":0,\"tid\":" << event.thread;
+            out << ",\"ts\":" << static_cast<double>(event.start) / 1000.0;
+            if (event.type == TraceEvent::Type::SCOPE) {
+                out << ",\"ph\":\"X\",\"dur\":" << static_cast<double>(event.duration) / 1000.0 << '}';
+            } else {
+                out << ",\"ph\":\"C\",\"args\":{\"value\":" << event.value << "}}";
+            }
+        }
+        out << "\n]}\n";
+        out.flags(flags);
+    }
+
+    bool Tracer::writeChromeTrace(const std::filesystem::path& path)
+    {
+        std::ofstream out(path);
+        if (!out) {
+            std::cerr << "Couldn't open trace file " << path << std::endl;
+            return false;
+        }
+        writeChromeTrace(out);
+        return static_cast<bool>(out);
+    }
+} // namespace mindset
@@ -0,0 +1,175 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <mindset/util/WorldGeometryCache.h>
+
+#include <mindset/DefaultProperties.h>
+#include <mindset/util/Trace.h>
+
+namespace mindset
+{
+    MorphologyGeometry MorphologyGeometry::extract(const Dataset& dataset, const Morphology& morphology)
+    {
+        MINDSET_TRACE_SCOPE("MorphologyGeometry::extract");
+        auto& properties = dataset.getProperties();
+        auto positionProperty = properties.getPropertyUID(PROPERTY_POSITION);
+        auto radiusProperty = properties.getPropertyUID(PROPERTY_RADIUS);
+        auto parentProperty = properties.getPropertyUID(PROPERTY_PARENT);
+        auto typeProperty = properties.getPropertyUID(PROPERTY_NEURITE_TYPE);
+
+        MorphologyGeometry result;
+        const Soma* soma = morphology.getSoma().value_or(nullptr);
+        if (soma != nullptr) {
+            result.somaCenter = soma->getCenter();
+            result.somaRadius = soma->getBestMeanRadius();
+        }
+        if (!positionProperty) {
+            return result;
+        }
+
+        size_t amount = morphology.getNeuritesAmount();
+        result.neurites.reserve(amount);
+        result.positions.reserve(amount);
+        result.radii.reserve(amount);
+        result.types.reserve(amount);
+
+        std::vector<std::optional<UID>> parentUIDs;
+        parentUIDs.reserve(amount);
+        std::unordered_map<UID, uint32_t> indices;
+        indices.reserve(amount);
+
+        for (const Neurite* neurite : morphology.getNeurites()) {
+            auto position = neurite->getProperty<rush::Vec3f>(positionProperty.value());
+            if (!position) {
+                continue;
+            }
+            indices[neurite->getUID()] = static_cast<uint32_t>(result.neurites.size());
+            result.neurites.push_back(neurite->getUID());
+            result.positions.push_back(position.value());
+            result.radii.push_back(radiusProperty ? neurite->getProperty<float>(radiusProperty.value()).value_or(0.0f)
+                                                  : 0.0f);
+            result.types.push_back(typeProperty ? neurite->getProperty<NeuriteType>(typeProperty.value())
+                                                      .value_or(NeuriteType::UNDEFINED)
+                                                : NeuriteType::UNDEFINED);
+            parentUIDs.push_back(parentProperty ? neurite->getProperty<UID>(parentProperty.value())
+                                                : std::optional<UID>());
+        }
+
+        result.parents.reserve(result.neurites.size());
+        for (auto& parent : parentUIDs) {
+            if (parent && soma != nullptr && soma->isRepresentedById(parent.value())) {
+                result.parents.push_back(SOMA_PARENT);
+                continue;
+            }
+            auto it = parent ? indices.find(parent.value()) : indices.end();
+            result.parents.push_back(it == indices.end() ? NO_PARENT : it->second);
+        }
+
+        return result;
+    }
+
+    bool MorphologyGeometry::hasParentPoint(size_t point) const
+    {
+        return parents[point] != NO_PARENT && parents[point] != SOMA_PARENT;
+    }
+
+    std::shared_ptr<const MorphologyGeometry> WorldGeometryCache::getLocalGeometry(
+        const Dataset& dataset, const std::shared_ptr<Morphology>& morphology)
+    {
+        if (morphology == nullptr) {
+            return nullptr;
+        }
+
+        {
+            std::lock_guard lock(_mutex);
+            auto it = _local.find(morphology.get());
+            // The weak pointer guards against a new morphology allocated at the address of a destroyed one.
+            if (it != _local.end() && it->second.morphology.lock() == morphology &&
+                it->second.version == morphology->getVersion()) {
+                return it->second.geometry;
+            }
+        }
+
+        // Extract outside the lock so different morphologies can be processed concurrently.
+        auto geometry = std::make_shared<const MorphologyGeometry>(MorphologyGeometry::extract(dataset, *morphology));
+
+        std::lock_guard lock(_mutex);
+        _local[morphology.get()] = {morphology, morphology->getVersion(), geometry};
+        return geometry;
+    }
+
+    std::shared_ptr<const WorldGeometry> WorldGeometryCache::getWorldGeometry(const Dataset& dataset,
+                                                                              const Neuron& neuron)
+    {
+        auto& morphology = neuron.getMorphologyPtr();
+        if (morphology == nullptr) {
+            return nullptr;
+        }
+
+        std::optional<NeuronTransform> transform;
+        if (auto property = dataset.getProperties().getPropertyUID(PROPERTY_TRANSFORM)) {
+            transform = neuron.getProperty<NeuronTransform>(property.value());
+        }
+
+        {
+            std::lock_guard lock(_mutex);
+            auto it = _world.find(neuron.getUID());
+            if (it != _world.end() && it->second.morphology.lock() == morphology &&
+                it->second.version == morphology->getVersion() && it->second.transform == transform) {
+                return it->second.geometry;
+            }
+        }
+
+        auto local = getLocalGeometry(dataset, morphology);
+        auto world = std::make_shared<WorldGeometry>();
+        world->local = local;
+        world->somaCenter = local->somaCenter;
+        if (transform) {
+            world->positions = transform->positionsToGlobalCoordinates(local->positions);
+            if (world->somaCenter) {
+                world->somaCenter = transform->positionToGlobalCoordinates(world->somaCenter.value());
+            }
+        } else {
+            world->positions = local->positions;
+        }
+
+        std::lock_guard lock(_mutex);
+        _world[neuron.getUID()] = {morphology, morphology->getVersion(), std::move(transform), world};
+        return world;
+    }
+
+    void WorldGeometryCache::invalidate(UID neuron)
+    {
+        std::lock_guard lock(_mutex);
+        _world.erase(neuron);
+    }
+
+    void WorldGeometryCache::clear()
+    {
+        std::lock_guard lock(_mutex);
+        _local.clear();
+        _world.clear();
+    }
+
+    size_t WorldGeometryCache::size() const
+    {
+        std::lock_guard lock(_mutex);
+        return _world.size();
+    }
+} // namespace mindset
@@ -0,0 +1,100 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <catch2/catch_all.hpp>
+#include <mindset/mindset.h>
+
+TEST_CASE("Group connectivity")
+{
+    mindset::Dataset dataset;
+    auto layer = dataset.getProperties().defineProperty("layer");
+    auto efficacy = dataset.getProperties().defineProperty(mindset::PROPERTY_SYNAPSE_EFFICACY);
+
+    // Layer 1: neurons 0 and 1. Layer 2: neurons 2, 3 and 4. Neuron 5 has no layer.
+    for (mindset::UID uid = 0; uid < 6; ++uid) {
+        mindset::Neuron neuron(uid);
+        if (uid < 5) {
+            neuron.setProperty(layer, uid < 2 ? 1u : 2u);
+        }
+        dataset.addNeuron(std::move(neuron));
+    }
+
+    std::vector<mindset::Synapse> synapses;
+    auto connect = [&](mindset::UID pre, mindset::UID post, float value) {
+        mindset::Synapse synapse(static_cast<mindset::UID>(synapses.size()), pre, post);
+        synapse.setProperty(efficacy, value);
+        synapses.push_back(std::move(synapse));
+    };
+    connect(0, 2, 1.0f);
+    connect(0, 2, 3.0f); // Same connection.
+    connect(0, 3, 2.0f);
+    connect(1, 0, 4.0f);
+    connect(2, 2, 1.0f); // Autapse: a synapse, but not a connection.
+    connect(3, 4, 1.0f);
+    connect(4, 5, 1.0f); // Neuron 5 is not grouped.
+    dataset.getCircuit().addSynapses(std::move(synapses));
+
+    auto grouping = mindset::NeuronGrouping::byProperty(dataset, "layer");
+    REQUIRE(grouping.getLabels() == std::vector<std::string>{"1", "2"});
+    REQUIRE(grouping.getGroupSizes() == std::vector<size_t>{2, 3});
+
+    mindset::ConnectivitySettings settings;
+    settings.properties = {mindset::PROPERTY_SYNAPSE_EFFICACY};
+    settings.threads = 2;
+    auto connectivity = mindset::GroupConnectivity::compute(dataset, grouping, settings);
+
+    REQUIRE(connectivity.getSynapses(0, 1) == 3);
+    REQUIRE(connectivity.getConnections(0, 1) == 2);
+    REQUIRE(connectivity.getProbability(0, 1) == Catch::Approx(2.0 / 6.0));
+    REQUIRE(connectivity.getSynapses(0, 0) == 1);
+    REQUIRE(connectivity.getProbability(0, 0) == Catch::Approx(0.5));
+    REQUIRE(connectivity.getSynapses(1, 1) == 2);
+    REQUIRE(connectivity.getConnections(1, 1) == 1);
+    REQUIRE(connectivity.getProbability(1, 1) == Catch::Approx(1.0 / 6.0));
+    REQUIRE(connectivity.getSynapses(1, 0) == 0);
+
+    auto property = connectivity.getProperty(mindset::PROPERTY_SYNAPSE_EFFICACY);
+    REQUIRE(property.has_value());
+    REQUIRE(property.value()->getMean(0, 1) == Catch::Approx(2.0));
+    REQUIRE(property.value()->getMean(1, 0) == 0.0);
+}
+
+TEST_CASE("Group connectivity by hierarchy")
+{
+    mindset::DatasetGeneratorSettings settings;
+    settings.neurons = 60;
+    settings.synapses.amount = 4'000;
+
+    mindset::Dataset dataset;
+    mindset::DatasetGenerator(settings).generate(dataset);
+
+    auto grouping = mindset::NeuronGrouping::byHierarchy(dataset, "mindset:column");
+    REQUIRE(grouping.getGroupsAmount() > 0);
+
+    auto single = mindset::GroupConnectivity::compute(dataset, grouping, {.properties = {}, .threads = 1});
+    auto parallel = mindset::GroupConnectivity::compute(dataset, grouping, {.properties = {}, .threads = 4});
+    REQUIRE(single.synapses == parallel.synapses);
+    REQUIRE(single.connections == parallel.connections);
+
+    uint64_t total = 0;
+    for (auto amount : parallel.synapses) {
+        total += amount;
+    }
+    REQUIRE(total == 4'000);
+}
@@ -0,0 +1,269 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <catch2/catch_all.hpp>
+#include <mindset/mindset.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+    /**
+     * Two neurons share a three-point morphology without soma and a third one uses a morphology
+     * with a soma and two points attached to it.
+     */
+    mindset::Dataset createDataset()
+    {
+        mindset::Dataset dataset;
+        auto& properties = dataset.getProperties();
+        auto position = properties.defineProperty(mindset::PROPERTY_POSITION);
+        auto radius = properties.defineProperty(mindset::PROPERTY_RADIUS);
+        auto parent = properties.defineProperty(mindset::PROPERTY_PARENT);
+        auto type = properties.defineProperty(mindset::PROPERTY_NEURITE_TYPE);
+        auto transformProperty = properties.defineProperty(mindset::PROPERTY_TRANSFORM);
+
+        auto shared = std::make_shared<mindset::Morphology>();
+        for (mindset::UID uid = 1; uid <= 3; ++uid) {
+            mindset::Neurite neurite(uid);
+            neurite.setProperty(position, rush::Vec3f(static_cast<float>(uid), 0.0f, 0.0f));
+            neurite.setProperty(radius, 0.5f);
+            neurite.setProperty(parent, uid - 1);
+            neurite.setProperty(type, mindset::NeuriteType::AXON);
+            shared->addNeurite(std::move(neurite));
+        }
+
+        auto withSoma = std::make_shared<mindset::Morphology>();
+        mindset::Soma soma(0);
+        soma.addNode({rush::Vec3f(0.0f, 0.0f, 0.0f), 2.0f});
+        withSoma->setSoma(std::move(soma));
+        for (mindset::UID uid = 1; uid <= 2; ++uid) {
+            mindset::Neurite neurite(uid);
+            neurite.setProperty(position, rush::Vec3f(0.0f, static_cast<float>(uid) * 3.0f, 0.0f));
+            neurite.setProperty(radius, 1.0f);
+            neurite.setProperty(parent, uid - 1);
+            neurite.setProperty(type, mindset::NeuriteType::BASAL_DENDRITE);
+            withSoma->addNeurite(std::move(neurite));
+        }
+
+        for (mindset::UID uid = 0; uid < 3; ++uid) {
+            mindset::NeuronTransform transform;
+            transform.setPosition(rush::Vec3f(static_cast<float>(uid) * 100.0f, 0.0f, 0.0f));
+            mindset::Neuron neuron(uid, uid < 2 ? shared : withSoma);
+            neuron.setProperty(transformProperty, transform);
+            dataset.addNeuron(std::move(neuron));
+        }
+        dataset.addNeuron(mindset::Neuron(3, nullptr));
+
+        return dataset;
+    }
+} // namespace
+
+TEST_CASE("Geometry buffers instancing")
+{
+    auto dataset = createDataset();
+    mindset::GeometryBuffers buffers;
+    buffers.build(dataset);
+
+    REQUIRE(buffers.getMorphologies().size() == 2);
+    REQUIRE(buffers.getInstances().size() == 3);
+    REQUIRE(buffers.getInstances()[0].morphology == buffers.getInstances()[1].morphology);
+    REQUIRE(buffers.getInstances()[2].model[12] == 200.0f);
+
+    // Shared morphology: 3 points, 2 segments. Soma morphology: soma + 2 points, 2 segments.
+    REQUIRE(buffers.getVertices().size() == 6);
+    REQUIRE(buffers.getLineIndices().size() == 8);
+    REQUIRE(buffers.getCapsuleIndices().size() == 24);
+
+    auto& range = buffers.getMorphologies()[buffers.getInstances()[2].morphology];
+    auto& soma = buffers.getVertices()[range.firstVertex];
+    REQUIRE(soma.type == static_cast<uint32_t>(mindset::NeuriteType::SOMA));
+    REQUIRE(soma.radius == 2.0f);
+
+    for (auto& morphology : buffers.getMorphologies()) {
+        for (uint32_t i = 0; i < morphology.lineIndexCount; ++i) {
+            uint32_t index = buffers.getLineIndices()[morphology.firstLineIndex + i];
+            REQUIRE(index >= morphology.firstVertex);
+            REQUIRE(index < morphology.firstVertex + morphology.vertexCount);
+        }
+    }
+    REQUIRE(buffers.getCapsuleIndices()[5] == 3);
+    REQUIRE(buffers.getCapsuleIndices().back() / 4 == buffers.getLineIndices().size() / 2 - 1);
+
+    // Without instancing, each neuron has its own morphology in global coordinates.
+    buffers.build(dataset, {.instancing = false, .includeSoma = false, .threads = 2});
+    REQUIRE(buffers.getMorphologies().size() == 3);
+    REQUIRE(buffers.getVertices().size() == 8);
+    REQUIRE(buffers.getLineIndices().size() == 10);
+    REQUIRE(buffers.getInstances()[1].model[12] == 0.0f);
+    auto& baked = buffers.getVertices()[buffers.getMorphologies()[1].firstVertex];
+    REQUIRE(baked.position[0] >= 100.0f);
+}
+
+TEST_CASE("Geometry buffers file")
+{
+    auto dataset = createDataset();
+    mindset::GeometryBuffers buffers;
+    buffers.build(dataset);
+
+    auto path = std::filesystem::temp_directory_path() / "mindset-geometry-test.bin";
+    auto written = buffers.write(path);
+    REQUIRE(written.isOk());
+    REQUIRE(written.getResult() == std::filesystem::file_size(path));
+
+    auto opened = mindset::MappedGeometryFile::open(path);
+    REQUIRE(opened.isOk());
+    auto& file = *opened.getResult();
+
+    auto same = [](auto a, auto b) {
+        return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size_bytes()) == 0;
+    };
+    REQUIRE(same(file.getVertices(), buffers.getVertices()));
+    REQUIRE(same(file.getLineIndices(), buffers.getLineIndices()));
+    REQUIRE(same(file.getCapsuleIndices(), buffers.getCapsuleIndices()));
+    REQUIRE(same(file.getMorphologies(), buffers.getMorphologies()));
+    REQUIRE(same(file.getInstances(), buffers.getInstances()));
+    REQUIRE(reinterpret_cast<uintptr_t>(file.getVertices().data()) % 64 == 0);
+
+    std::filesystem::remove(path);
+
+    auto missing = mindset::MappedGeometryFile::open(path);
+    REQUIRE_FALSE(missing.isOk());
+}
+
+namespace
+{
+    /**
+     * Four neurons with sparse UIDs, two synapses sharing a connection and a synapse to a missing neuron.
+     */
+    mindset::Dataset createCircuitDataset()
+    {
+        mindset::Dataset dataset;
+        auto efficacy = dataset.getProperties().defineProperty(mindset::PROPERTY_SYNAPSE_EFFICACY);
+        for (mindset::UID uid : {40, 10, 30, 20}) {
+            dataset.addNeuron(mindset::Neuron(uid, nullptr));
+        }
+
+        std::vector<mindset::Synapse> synapses;
+        auto connect = [&](mindset::UID pre, mindset::UID post, float value) {
+            mindset::Synapse synapse(static_cast<mindset::UID>(synapses.size()), pre, post);
+            synapse.setProperty(efficacy, value);
+            synapses.push_back(std::move(synapse));
+        };
+        connect(10, 20, 2.0f);
+        connect(10, 20, 1.0f);
+        connect(10, 40, 3.0f);
+        connect(30, 10, 4.0f);
+        connect(20, 99, 5.0f);
+        dataset.getCircuit().addSynapses(std::move(synapses));
+        return dataset;
+    }
+
+    std::vector<char> readFile(const std::filesystem::path& path)
+    {
+        std::ifstream in(path, std::ios::binary);
+        return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+    }
+
+    template<typename T>
+    std::vector<T> readSection(const std::vector<char>& data, uint64_t offset, size_t amount)
+    {
+        std::vector<T> values(amount);
+        std::memcpy(values.data(), data.data() + offset, amount * sizeof(T));
+        return values;
+    }
+} // namespace
+
+TEST_CASE("Adjacency Matrix Market")
+{
+    auto dataset = createCircuitDataset();
+    auto path = std::filesystem::temp_directory_path() / "mindset-adjacency-test.mtx";
+
+    mindset::AdjacencyExportSettings settings;
+    settings.format = mindset::AdjacencyFormat::MATRIX_MARKET;
+    settings.threads = 2;
+    auto written = mindset::exportAdjacency(dataset, path, settings);
+    REQUIRE(written.isOk());
+    REQUIRE(written.getResult().neurons == 4);
+    REQUIRE(written.getResult().entries == 3);
+
+    auto data = readFile(path);
+    std::string text(data.begin(), data.end());
+    REQUIRE(text.starts_with("%%MatrixMarket matrix coordinate pattern general\n"));
+    REQUIRE(text.ends_with("\n4 4 3\n1 2\n1 4\n3 1\n"));
+
+    settings.weightProperty = mindset::PROPERTY_SYNAPSE_EFFICACY;
+    settings.collapse = false;
+    REQUIRE(mindset::exportAdjacency(dataset, path, settings).isOk());
+    data = readFile(path);
+    text = std::string(data.begin(), data.end());
+    REQUIRE(text.starts_with("%%MatrixMarket matrix coordinate real general\n"));
+    REQUIRE(text.ends_with("\n4 4 4\n1 2 1\n1 2 2\n1 4 3\n3 1 4\n"));
+
+    std::filesystem::remove(path);
+
+    settings.weightProperty = "missing";
+    REQUIRE_FALSE(mindset::exportAdjacency(dataset, path, settings).isOk());
+}
+
+TEST_CASE("Adjacency raw file")
+{
+    auto dataset = createCircuitDataset();
+    auto path = std::filesystem::temp_directory_path() / "mindset-adjacency-test.bin";
+
+    mindset::AdjacencyExportSettings settings;
+    settings.weightProperty = mindset::PROPERTY_SYNAPSE_EFFICACY;
+    settings.threads = 2;
+    auto written = mindset::exportAdjacency(dataset, path, settings);
+    REQUIRE(written.isOk());
+    REQUIRE(written.getResult().bytes == std::filesystem::file_size(path));
+
+    auto data = readFile(path);
+    mindset::AdjacencyFileHeader header;
+    std::memcpy(&header, data.data(), sizeof(header));
+    REQUIRE(std::memcmp(header.magic, mindset::AdjacencyFileHeader::MAGIC, sizeof(header.magic)) == 0);
+    REQUIRE(header.layout == static_cast<uint32_t>(mindset::AdjacencyLayout::CSR));
+    REQUIRE(header.flags == (mindset::ADJACENCY_WEIGHTED | mindset::ADJACENCY_COLLAPSED));
+    REQUIRE(header.rows == 4);
+    REQUIRE(header.entries == 3);
+    REQUIRE(header.columnsOffset % 64 == 0);
+
+    REQUIRE(readSection<mindset::UID>(data, header.uidsOffset, 4) == std::vector<mindset::UID>{10, 20, 30, 40});
+    REQUIRE(readSection<uint64_t>(data, header.rowsOffset, 5) == std::vector<uint64_t>{0, 2, 2, 3, 3});
+    REQUIRE(readSection<uint32_t>(data, header.columnsOffset, 3) == std::vector<uint32_t>{1, 3, 0});
+    REQUIRE(readSection<double>(data, header.weightsOffset, 3) == std::vector<double>{3.0, 3.0, 4.0});
+
+    settings.layout = mindset::AdjacencyLayout::COO;
+    settings.weightProperty.reset();
+    settings.collapse = false;
+    written = mindset::exportAdjacency(dataset, path, settings);
+    REQUIRE(written.isOk());
+    REQUIRE(written.getResult().bytes == std::filesystem::file_size(path));
+
+    data = readFile(path);
+    std::memcpy(&header, data.data(), sizeof(header));
+    REQUIRE(header.flags == 0);
+    REQUIRE(header.entries == 4);
+    REQUIRE(header.weightsOffset == 0);
+    REQUIRE(readSection<uint32_t>(data, header.rowsOffset, 4) == std::vector<uint32_t>{0, 0, 0, 2});
+    REQUIRE(readSection<uint32_t>(data, header.columnsOffset, 4) == std::vector<uint32_t>{1, 1, 3, 0});
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,150 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <catch2/catch_all.hpp>
+#include <mindset/mindset.h>
+
+#include <sstream>
+
+namespace
+{
+    mindset::DatasetGeneratorSettings smallSettings(size_t threads)
+    {
+        mindset::DatasetGeneratorSettings settings;
+        settings.neurons = 50;
+        settings.morphology.amount = 5;
+        settings.morphology.pointsPerTree = 40;
+        settings.placement.columns = 4;
+        settings.placement.layers = 3;
+        settings.synapses.amount = 70'000;
+        settings.activity.voltageTimesteps = 100;
+        settings.threads = threads;
+        return settings;
+    }
+} // namespace
+
+TEST_CASE("Dataset generator")
+{
+    mindset::Dataset dataset;
+    mindset::DatasetGenerator(smallSettings(4)).generate(dataset);
+
+    REQUIRE(dataset.getNeuronsAmount() == 50);
+    auto& circuit = dataset.getCircuit();
+    auto postNeurite = dataset.getProperties().getPropertyUID(mindset::PROPERTY_SYNAPSE_POST_NEURITE).value();
+
+    size_t synapses = 0;
+    for (auto* synapse : circuit.getSynapses()) {
+        ++synapses;
+        REQUIRE(synapse->getPreSynapticNeuron() != synapse->getPostSynapticNeuron());
+        auto neurite = synapse->getProperty<mindset::UID>(postNeurite);
+        REQUIRE(neurite.has_value());
+        auto morphology = mindset::getMorphology(dataset, synapse->getPostSynapticNeuron());
+        REQUIRE(morphology.value()->getNeurite(neurite.value()).has_value());
+    }
+    REQUIRE(synapses == 70'000);
+
+    auto root = dataset.getHierarchy();
+    REQUIRE(root.has_value());
+    REQUIRE(root.value()->getNodesAmount() == 4);
+
+    auto activity = dataset.getActivity(0);
+    REQUIRE(activity.has_value());
+    auto voltageProperty = dataset.getProperties().getPropertyUID(mindset::PROPERTY_ACTIVITY_VOLTAGE).value();
+    auto voltage = activity.value()->getPropertyPtr<mindset::TimeGrid<double>>(voltageProperty);
+    REQUIRE(voltage.has_value());
+    REQUIRE(voltage.value()->getDimensions() == std::pair<size_t, size_t>(50, 100));
+
+    // The result doesn't depend on the amount of threads.
+    mindset::Dataset other;
+    mindset::DatasetGenerator(smallSettings(1)).generate(other);
+    for (mindset::UID uid : {0u, 1234u, 69'999u}) {
+        auto a = circuit.getSynapse(uid).value();
+        auto b = other.getCircuit().getSynapse(uid).value();
+        REQUIRE(a->getPreSynapticNeuron() == b->getPreSynapticNeuron());
+        REQUIRE(a->getPostSynapticNeuron() == b->getPostSynapticNeuron());
+        REQUIRE(a->getProperty<mindset::UID>(postNeurite) == b->getProperty<mindset::UID>(postNeurite));
+    }
+    for (mindset::UID uid = 0; uid < 50; ++uid) {
+        auto a = mindset::getMorphology(dataset, uid).value();
+        auto b = mindset::getMorphology(other, uid).value();
+        REQUIRE(a->getNeuritesAmount() == b->getNeuritesAmount());
+    }
+}
+
+TEST_CASE("Dataset generator appends")
+{
+    auto settings = smallSettings(2);
+    settings.synapses.amount = 1'000;
+    settings.activity.voltageTimesteps = 0;
+
+    mindset::Dataset dataset;
+    mindset::DatasetGenerator(settings).generate(dataset);
+    auto firstMorphology = mindset::getMorphology(dataset, 7).value();
+    auto firstSynapse = dataset.getCircuit().getSynapse(500).value();
+    auto pre = firstSynapse->getPreSynapticNeuron();
+    auto post = firstSynapse->getPostSynapticNeuron();
+
+    settings.seed = 7;
+    mindset::DatasetGenerator(settings).generate(dataset);
+
+    // The second run doesn't replace the neurons and synapses of the first one.
+    REQUIRE(dataset.getNeuronsAmount() == 100);
+    REQUIRE(dataset.getCircuit().getSynapses().size() == 2'000);
+    REQUIRE(mindset::getMorphology(dataset, 7).value() == firstMorphology);
+    auto kept = dataset.getCircuit().getSynapse(500).value();
+    REQUIRE(kept->getPreSynapticNeuron() == pre);
+    REQUIRE(kept->getPostSynapticNeuron() == post);
+
+    for (auto* synapse : dataset.getCircuit().getSynapses()) {
+        bool second = synapse->getUID() >= 1'000;
+        for (mindset::UID neuron : {synapse->getPreSynapticNeuron(), synapse->getPostSynapticNeuron()}) {
+            REQUIRE(dataset.getNeuron(neuron).has_value());
+            REQUIRE((neuron >= 50) == second);
+        }
+    }
+    REQUIRE(dataset.getActivity(0).has_value());
+    REQUIRE(dataset.getActivity(1).has_value());
+}
+
+TEST_CASE("SWC writer round trip")
+{
+    mindset::Dataset dataset;
+    mindset::DatasetGenerator generator(smallSettings(1));
+    auto morphology = generator.generateMorphology(dataset, 3);
+
+    std::stringstream stream;
+    auto written = mindset::writeSWC(dataset, *morphology, stream);
+    REQUIRE(written.isOk());
+    REQUIRE(written.getResult() == morphology->getNeuritesAmount() + 1);
+
+    mindset::Dataset loaded;
+    mindset::SWCLoader loader(mindset::LoaderCreateInfo(), stream);
+    loader.load(loaded);
+    auto result = mindset::getMorphology(loaded, 0);
+    REQUIRE(result.has_value());
+    REQUIRE(result.value()->getNeuritesAmount() == morphology->getNeuritesAmount());
+
+    auto position = dataset.getProperties().getPropertyUID(mindset::PROPERTY_POSITION).value();
+    auto loadedPosition = loaded.getProperties().getPropertyUID(mindset::PROPERTY_POSITION).value();
+    for (auto* neurite : morphology->getNeurites()) {
+        auto other = result.value()->getNeurite(neurite->getUID());
+        REQUIRE(other.has_value());
+        REQUIRE(neurite->getProperty<rush::Vec3f>(position) == other.value()->getProperty<rush::Vec3f>(loadedPosition));
+    }
+}
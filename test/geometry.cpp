@@ -0,0 +1,167 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <catch2/catch_all.hpp>
+#include <mindset/mindset.h>
+
+namespace
+{
+    bool near(const rush::Vec3f& a, const rush::Vec3f& b)
+    {
+        return (a - b).length() < 1e-3f;
+    }
+} // namespace
+
+TEST_CASE("Batched transform")
+{
+    mindset::NeuronTransform transform;
+    transform.setPosition(rush::Vec3f(10.0f, -3.0f, 5.0f));
+    transform.setRotation(rush::Vec3f(0.3f, 1.2f, -0.7f));
+    transform.setScale(rush::Vec3f(2.0f, 0.5f, 1.5f));
+
+    std::vector<rush::Vec3f> local;
+    for (int i = 0; i < 100; ++i) {
+        local.emplace_back(static_cast<float>(i), static_cast<float>(i % 7) - 3.0f, static_cast<float>(i % 13));
+    }
+
+    auto global = transform.positionsToGlobalCoordinates(local);
+    REQUIRE(global.size() == local.size());
+    for (size_t i = 0; i < local.size(); ++i) {
+        REQUIRE(near(global[i], transform.positionToGlobalCoordinates(local[i])));
+    }
+
+    std::vector<rush::Vec3f> back = global;
+    transform.positionsToLocalCoordinates(back, back);
+    for (size_t i = 0; i < local.size(); ++i) {
+        REQUIRE(near(back[i], local[i]));
+        REQUIRE(near(back[i], transform.positionToLocalCoordinates(global[i])));
+    }
+}
+
+TEST_CASE("World geometry cache")
+{
+    mindset::Dataset dataset;
+    auto position = dataset.getProperties().defineProperty(mindset::PROPERTY_POSITION);
+    auto parent = dataset.getProperties().defineProperty(mindset::PROPERTY_PARENT);
+    auto transformProperty = dataset.getProperties().defineProperty(mindset::PROPERTY_TRANSFORM);
+
+    auto morphology = std::make_shared<mindset::Morphology>();
+    for (mindset::UID uid = 1; uid <= 3; ++uid) {
+        mindset::Neurite neurite(uid);
+        neurite.setProperty(position, rush::Vec3f(static_cast<float>(uid), 0.0f, 0.0f));
+        neurite.setProperty(parent, uid - 1);
+        morphology->addNeurite(std::move(neurite));
+    }
+
+    for (mindset::UID uid = 0; uid < 2; ++uid) {
+        mindset::NeuronTransform transform;
+        transform.setPosition(rush::Vec3f(0.0f, static_cast<float>(uid) * 100.0f, 0.0f));
+        mindset::Neuron neuron(uid, morphology);
+        neuron.setProperty(transformProperty, transform);
+        dataset.addNeuron(std::move(neuron));
+    }
+
+    mindset::WorldGeometryCache cache;
+    auto* neuron0 = dataset.getNeuron(0).value();
+    auto* neuron1 = dataset.getNeuron(1).value();
+
+    auto first = cache.getWorldGeometry(dataset, *neuron0);
+    auto second = cache.getWorldGeometry(dataset, *neuron1);
+    REQUIRE(first != nullptr);
+    REQUIRE(first->local == second->local);
+    REQUIRE(first->positions.size() == 3);
+    size_t root = std::ranges::find(second->local->neurites, 1u) - second->local->neurites.begin();
+    REQUIRE(second->local->parents[root] == mindset::MorphologyGeometry::NO_PARENT);
+    REQUIRE(cache.getWorldGeometry(dataset, *neuron0) == first);
+
+    // Changing the transform invalidates the neuron's geometry but not the shared local geometry.
+    mindset::NeuronTransform moved;
+    moved.setPosition(rush::Vec3f(0.0f, 0.0f, 50.0f));
+    neuron0->setProperty(transformProperty, moved);
+    auto third = cache.getWorldGeometry(dataset, *neuron0);
+    REQUIRE(third != first);
+    REQUIRE(third->local == first->local);
+
+    size_t index = std::ranges::find(third->local->neurites, 2u) - third->local->neurites.begin();
+    REQUIRE(near(third->positions[index], rush::Vec3f(2.0f, 0.0f, 50.0f)));
+
+    // Changing the morphology invalidates everything that uses it.
+    morphology->removeNeurite(3);
+    auto fourth = cache.getWorldGeometry(dataset, *neuron1);
+    REQUIRE(fourth->local != first->local);
+    REQUIRE(fourth->positions.size() == 2);
+}
+
+TEST_CASE("Morphology simplification")
+{
+    mindset::Dataset dataset;
+    auto position = dataset.getProperties().defineProperty(mindset::PROPERTY_POSITION);
+    auto radius = dataset.getProperties().defineProperty(mindset::PROPERTY_RADIUS);
+    auto parent = dataset.getProperties().defineProperty(mindset::PROPERTY_PARENT);
+
+    // A soma with a straight neurite of 20 points branching at its end into two straight neurites of 10 points.
+    auto morphology = std::make_shared<mindset::Morphology>();
+    mindset::Soma soma(0);
+    soma.addNode({rush::Vec3f(0.0f, 0.0f, 0.0f), 1.0f});
+    morphology->setSoma(soma);
+
+    auto addNeurite = [&](mindset::UID uid, mindset::UID parentUID, rush::Vec3f point) {
+        mindset::Neurite neurite(uid);
+        neurite.setProperty(position, point);
+        neurite.setProperty(radius, 0.5f);
+        neurite.setProperty(parent, parentUID);
+        morphology->addNeurite(std::move(neurite));
+    };
+
+    for (mindset::UID uid = 1; uid <= 20; ++uid) {
+        addNeurite(uid, uid - 1, rush::Vec3f(static_cast<float>(uid), 0.0f, 0.0f));
+    }
+    for (mindset::UID i = 1; i <= 10; ++i) {
+        float offset = static_cast<float>(i);
+        addNeurite(100 + i, i == 1 ? 20 : 100 + i - 1, rush::Vec3f(20.0f + offset, offset, 0.0f));
+        addNeurite(200 + i, i == 1 ? 20 : 200 + i - 1, rush::Vec3f(20.0f + offset, -offset, 0.0f));
+    }
+
+    auto simplified = mindset::simplifyMorphology(dataset, *morphology, {.tolerance = 0.1f});
+    auto& result = *simplified.morphology;
+
+    // Soma connection, branch point and both terminals.
+    REQUIRE(simplified.sourceNeurites == 40);
+    REQUIRE(result.getNeuritesAmount() == 4);
+    REQUIRE(result.getNeurite(1).has_value());
+    REQUIRE(result.getNeurite(20).has_value());
+    REQUIRE(result.getNeurite(110).value()->getProperty<mindset::UID>(parent) == 20);
+    REQUIRE(result.getNeurite(20).value()->getProperty<mindset::UID>(parent) == 1);
+    REQUIRE(simplified.remap.at(5) == 20);
+    REQUIRE(simplified.remap.at(105) == 110);
+    REQUIRE(simplified.remap.at(1) == 1);
+
+    auto resampled = mindset::simplifyMorphology(dataset, *morphology, {.tolerance = 0.0f, .resampleLength = 5.0f});
+    // The trunk is resampled at 6, 11 and 16. Each branch (length 14.1) at 5 and 10.
+    REQUIRE(resampled.morphology->getNeuritesAmount() == 1 + 3 + 1 + 2 * (2 + 1));
+    REQUIRE(resampled.remap.at(20) == 20);
+    REQUIRE(resampled.remap.at(210) == 210);
+
+    mindset::MorphologyLODCache cache({{.tolerance = 0.1f}, {.tolerance = 100.0f}});
+    auto level = cache.getLevel(dataset, morphology, 1);
+    REQUIRE(level == cache.getLevel(dataset, morphology, 1));
+    REQUIRE(level->morphology->getNeuritesAmount() == 4);
+    morphology->removeNeurite(210);
+    REQUIRE(cache.getLevel(dataset, morphology, 1) != level);
+}
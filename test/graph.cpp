@@ -0,0 +1,158 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <catch2/catch_all.hpp>
+#include <mindset/mindset.h>
+
+#include <queue>
+
+namespace
+{
+    /**
+     * Neurons 0, 1 and 2 form a cycle that leads to 3 and 4. Neuron 5 also connects to 4 and neuron 6 is isolated.
+     * Neuron UIDs are ten times their index.
+     */
+    mindset::Dataset createGraphDataset()
+    {
+        mindset::Dataset dataset;
+        auto delay = dataset.getProperties().defineProperty(mindset::PROPERTY_SYNAPSE_DELAY);
+        for (mindset::UID uid = 0; uid < 7; ++uid) {
+            dataset.addNeuron(mindset::Neuron(uid * 10, nullptr));
+        }
+
+        std::vector<mindset::Synapse> synapses;
+        auto connect = [&](mindset::UID pre, mindset::UID post, float value) {
+            mindset::Synapse synapse(static_cast<mindset::UID>(synapses.size()), pre * 10, post * 10);
+            synapse.setProperty(delay, value);
+            synapses.push_back(std::move(synapse));
+        };
+        connect(0, 1, 1.0f);
+        connect(1, 2, 1.0f);
+        connect(0, 2, 5.0f);
+        connect(0, 2, 3.0f); // Same connection, lighter.
+        connect(2, 0, 1.0f);
+        connect(2, 3, 2.0f);
+        connect(3, 4, 1.0f);
+        connect(5, 4, 1.0f);
+        dataset.getCircuit().addSynapses(std::move(synapses));
+        return dataset;
+    }
+} // namespace
+
+TEST_CASE("Circuit graph structure")
+{
+    auto dataset = createGraphDataset();
+    mindset::CircuitGraph graph(dataset, {.weightProperty = mindset::PROPERTY_SYNAPSE_DELAY, .threads = 2});
+
+    REQUIRE(graph.getNeuronsAmount() == 7);
+    REQUIRE(graph.getEdgesAmount() == 7);
+    REQUIRE(graph.isWeighted());
+    REQUIRE(graph.getIndex(30) == 3);
+    REQUIRE_FALSE(graph.getIndex(35).has_value());
+    REQUIRE(std::ranges::equal(graph.getOutgoing(0), std::vector<uint32_t>{1, 2}));
+    REQUIRE(std::ranges::equal(graph.getOutgoingWeights(0), std::vector<float>{1.0f, 3.0f}));
+    REQUIRE(std::ranges::equal(graph.getIncoming(4), std::vector<uint32_t>{3, 5}));
+    REQUIRE(graph.getIncoming(6).empty());
+}
+
+TEST_CASE("Circuit graph traversals")
+{
+    auto dataset = createGraphDataset();
+    mindset::CircuitGraph graph(dataset, {.weightProperty = mindset::PROPERTY_SYNAPSE_DELAY, .threads = 2});
+    constexpr uint32_t U = mindset::CircuitGraph::UNREACHED;
+
+    std::vector<uint32_t> sources = {0};
+    auto distances = graph.getHopDistances(sources, mindset::TraversalDirection::OUTGOING);
+    REQUIRE(distances == std::vector<uint32_t>{0, 1, 1, 2, 3, U, U});
+
+    std::vector<mindset::UID> from = {0};
+    REQUIRE(graph.getNeighborhood(from, 2, mindset::TraversalDirection::OUTGOING) ==
+            std::vector<mindset::UID>{10, 20, 30});
+    from = {40};
+    REQUIRE(graph.getNeighborhood(from, 1, mindset::TraversalDirection::INCOMING) ==
+            std::vector<mindset::UID>{30, 50});
+    REQUIRE(graph.getNeighborhood(from, 2, mindset::TraversalDirection::BOTH) ==
+            std::vector<mindset::UID>{20, 30, 50});
+    from = {60};
+    REQUIRE(graph.getNeighborhood(from, 3, mindset::TraversalDirection::BOTH).empty());
+
+    auto weighted = graph.getShortestPath(0, 40, mindset::TraversalDirection::OUTGOING);
+    REQUIRE(weighted == std::vector<mindset::UID>{0, 10, 20, 30, 40});
+    auto paths = graph.getShortestPaths(0, mindset::TraversalDirection::OUTGOING);
+    REQUIRE(paths.distances[4] == 5.0);
+    REQUIRE_FALSE(graph.getShortestPath(0, 50, mindset::TraversalDirection::OUTGOING).has_value());
+
+    mindset::CircuitGraph unweighted(dataset);
+    REQUIRE_FALSE(unweighted.isWeighted());
+    REQUIRE(unweighted.getShortestPath(0, 40, mindset::TraversalDirection::OUTGOING) ==
+            std::vector<mindset::UID>{0, 20, 30, 40});
+}
+
+TEST_CASE("Circuit graph components")
+{
+    auto dataset = createGraphDataset();
+    mindset::CircuitGraph graph(dataset);
+
+    auto weak = graph.getWeaklyConnectedComponents();
+    REQUIRE(weak.getComponentsAmount() == 2);
+    REQUIRE(weak.labels == std::vector<uint32_t>{0, 0, 0, 0, 0, 0, 1});
+    REQUIRE(weak.sizes == std::vector<uint32_t>{6, 1});
+
+    auto strong = graph.getStronglyConnectedComponents();
+    REQUIRE(strong.getComponentsAmount() == 5);
+    REQUIRE(strong.labels == std::vector<uint32_t>{0, 0, 0, 1, 2, 3, 4});
+    REQUIRE(strong.sizes == std::vector<uint32_t>{3, 1, 1, 1, 1});
+}
+
+TEST_CASE("Circuit graph parallel traversal")
+{
+    mindset::DatasetGeneratorSettings settings;
+    settings.neurons = 3'000;
+    settings.synapses.amount = 20'000;
+
+    mindset::Dataset dataset;
+    mindset::DatasetGenerator(settings).generate(dataset);
+    mindset::CircuitGraph graph(dataset, {.weightProperty = {}, .threads = 4});
+
+    // A plain top-down breadth-first search as the reference.
+    std::vector<uint32_t> expected(graph.getNeuronsAmount(), mindset::CircuitGraph::UNREACHED);
+    std::queue<uint32_t> queue;
+    expected[0] = 0;
+    queue.push(0);
+    while (!queue.empty()) {
+        uint32_t index = queue.front();
+        queue.pop();
+        for (uint32_t neighbor : graph.getOutgoing(index)) {
+            if (expected[neighbor] == mindset::CircuitGraph::UNREACHED) {
+                expected[neighbor] = expected[index] + 1;
+                queue.push(neighbor);
+            }
+        }
+    }
+
+    std::vector<uint32_t> sources = {0};
+    REQUIRE(graph.getHopDistances(sources, mindset::TraversalDirection::OUTGOING) == expected);
+
+    auto components = graph.getWeaklyConnectedComponents();
+    for (uint32_t index = 0; index < graph.getNeuronsAmount(); ++index) {
+        for (uint32_t neighbor : graph.getOutgoing(index)) {
+            REQUIRE(components.labels[index] == components.labels[neighbor]);
+        }
+    }
+}
@@ -0,0 +1,78 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <catch2/catch_all.hpp>
+#include <mindset/mindset.h>
+
+TEST_CASE("Hierarchy index")
+{
+    mindset::Dataset dataset;
+    auto* root = dataset.createHierarchy(0, "mindset:root");
+
+    auto* column1 = root->getOrCreateNode(1, "mindset:column").getResult();
+    auto* column2 = root->getOrCreateNode(2, "mindset:column").getResult();
+    auto* mini10 = column1->getOrCreateNode(10, "mindset:mini_column").getResult();
+    auto* mini11 = column1->getOrCreateNode(11, "mindset:mini_column").getResult();
+
+    mini10->addNeuron(3);
+    mini10->addNeuron(1);
+    mini11->addNeuron(2);
+    column2->addNeuron(4);
+
+    auto index = dataset.getHierarchyIndex();
+    REQUIRE(index != nullptr);
+    REQUIRE(index->getNodesAmount() == 5);
+
+    // Depth-first order, children sorted by UID.
+    auto nodes = index->getNodes();
+    REQUIRE(nodes[0].uid == 0);
+    REQUIRE(nodes[1].uid == 1);
+    REQUIRE(nodes[2].uid == 10);
+    REQUIRE(nodes[3].uid == 11);
+    REQUIRE(nodes[4].uid == 2);
+    REQUIRE(nodes[2].depth == 2);
+
+    auto column1Index = index->findNode(column1).value();
+    REQUIRE(index->getSubtree(column1Index).size() == 3);
+
+    auto neurons = index->getNeurons(column1Index);
+    REQUIRE(std::vector(neurons.begin(), neurons.end()) == std::vector<mindset::UID>{1, 3, 2});
+    REQUIRE(index->getOwnNeurons(column1Index).empty());
+    REQUIRE(index->getNeurons(0).size() == 4);
+
+    auto node = index->getNodeOfNeuron(2).value();
+    REQUIRE(index->getNode(node).uid == 11);
+    REQUIRE(index->getNode(index->getAncestorOfType(node, "mindset:column").value()).uid == 1);
+    REQUIRE(index->findChild(0, 2).has_value());
+    REQUIRE(!index->getNodeOfNeuron(5).has_value());
+
+    // The index is cached until the hierarchy changes.
+    REQUIRE(dataset.getHierarchyIndex() == index);
+    mini11->addNeuron(5);
+    auto rebuilt = dataset.getHierarchyIndex();
+    REQUIRE(rebuilt != index);
+    REQUIRE(rebuilt->getNodeOfNeuron(5).has_value());
+    REQUIRE(index->getNeurons().size() == 4);
+
+    // Kept snapshots resolve nodes by their UID path, never by address.
+    auto* column3 = root->getOrCreateNode(3, "mindset:column").getResult();
+    REQUIRE(!index->findNode(column3).has_value());
+    REQUIRE(index->findNode(mini11) == rebuilt->findNode(mini11));
+    REQUIRE(index->getNode(index->findNode(mini11).value()).uid == 11);
+}
@@ -0,0 +1,187 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <catch2/catch_all.hpp>
+#include <mindset/mindset.h>
+
+#include <sstream>
+
+namespace
+{
+    /**
+     * Forwards to the default resource, recording the size of every allocation.
+     */
+    class RecordingResource : public std::pmr::memory_resource
+    {
+      public:
+        std::vector<size_t> sizes;
+
+      protected:
+        void* do_allocate(size_t bytes, size_t alignment) override
+        {
+            sizes.push_back(bytes);
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* pointer, size_t bytes, size_t alignment) override
+        {
+            std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+        }
+
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+    };
+} // namespace
+
+TEST_CASE("Memory report")
+{
+    mindset::DatasetGeneratorSettings settings;
+    settings.neurons = 30;
+    settings.morphology.amount = 4;
+    settings.morphology.pointsPerTree = 20;
+    settings.synapses.amount = 2'000;
+    settings.activity.voltageTimesteps = 50;
+
+    mindset::Dataset dataset;
+    mindset::DatasetGenerator(settings).generate(dataset);
+
+    auto report = mindset::MemoryReport::compute(dataset);
+
+    REQUIRE(report.neurons.objects == 30);
+    REQUIRE(report.morphologyReferences == 30);
+    // Shared morphologies are counted once.
+    REQUIRE(report.morphologies.objects == 4);
+    REQUIRE(report.synapses.objects == 2'000);
+    REQUIRE(report.activities.objects == 1);
+    REQUIRE(report.getTotal().getTotal() > report.synapses.getTotal());
+
+    auto voltage = std::ranges::find(report.properties, std::optional<std::string>(mindset::PROPERTY_ACTIVITY_VOLTAGE),
+                                     &mindset::PropertyMemoryUsage::name);
+    REQUIRE(voltage != report.properties.end());
+    REQUIRE(voltage->usage.payload >= 30 * 50 * sizeof(double));
+
+    for (const auto& property : report.properties) {
+        REQUIRE(property.unknownValues == 0);
+    }
+
+    std::stringstream stream;
+    report.print(stream);
+    REQUIRE(stream.str().find("Synapses") != std::string::npos);
+
+    if (mindset::MemoryTracker::isAvailable()) {
+        auto generator = std::ranges::find(report.allocations, "DatasetGenerator", &mindset::AllocationStats::scope);
+        REQUIRE(generator != report.allocations.end());
+        REQUIRE(generator->liveBytes > 0);
+    }
+}
+
+TEST_CASE("Arena dataset")
+{
+    mindset::DatasetGeneratorSettings settings;
+    settings.neurons = 20;
+    settings.synapses.amount = 500;
+
+    mindset::Dataset dataset(mindset::DatasetMemory::ARENA);
+    REQUIRE(dataset.getArena().has_value());
+
+    mindset::DatasetGenerator(settings).generate(dataset);
+    REQUIRE(dataset.getNeuronsAmount() == 20);
+    REQUIRE(dataset.getArena().value()->getAllocatedBytes() > 0);
+    REQUIRE(mindset::MemoryReport::compute(dataset).arenaBytes > 0);
+
+    dataset.clear();
+    REQUIRE(dataset.getNeuronsAmount() == 0);
+    REQUIRE(dataset.getArena().value()->getAllocatedBytes() == 0);
+
+    // The dataset must be reusable after the arena has been released.
+    mindset::DatasetGenerator(settings).generate(dataset);
+    REQUIRE(dataset.getNeuronsAmount() == 20);
+    REQUIRE(std::ranges::distance(dataset.getCircuit().getSynapses()) == 500);
+}
+
+TEST_CASE("Arena concurrent allocations")
+{
+    mindset::Arena arena(4096);
+    constexpr size_t THREADS = 4;
+    constexpr size_t ALLOCATIONS = 10'000;
+
+    // Catch2 assertions are not thread-safe: the workers only record their allocations.
+    std::vector<std::vector<std::pair<uintptr_t, size_t>>> ranges(THREADS);
+    std::vector<size_t> misaligned(THREADS, 0);
+    mindset::parallelFor(
+        THREADS,
+        [&](size_t thread) {
+            for (size_t i = 0; i < ALLOCATIONS; ++i) {
+                size_t bytes = 1 + (i * 7 + thread) % 200;
+                size_t alignment = size_t(1) << (i % 7);
+                auto* pointer = static_cast<std::byte*>(arena.allocate(bytes, alignment));
+                std::fill_n(pointer, bytes, static_cast<std::byte>(thread));
+                ranges[thread].emplace_back(reinterpret_cast<uintptr_t>(pointer), bytes);
+                if (reinterpret_cast<uintptr_t>(pointer) % alignment != 0) {
+                    ++misaligned[thread];
+                }
+            }
+        },
+        THREADS);
+    REQUIRE(std::ranges::count(misaligned, 0) == THREADS);
+
+    std::vector<std::pair<uintptr_t, size_t>> all;
+    for (auto& thread : ranges) {
+        all.insert(all.end(), thread.begin(), thread.end());
+    }
+    std::ranges::sort(all);
+    size_t overlapping = 0;
+    for (size_t i = 1; i < all.size(); ++i) {
+        if (all[i - 1].first + all[i - 1].second > all[i].first) {
+            ++overlapping;
+        }
+    }
+    REQUIRE(overlapping == 0);
+
+    size_t expected = 0;
+    for (auto& [pointer, bytes] : all) {
+        expected += bytes;
+    }
+    REQUIRE(arena.getAllocatedBytes() == expected);
+
+    arena.release();
+    REQUIRE(arena.getAllocatedBytes() == 0);
+    REQUIRE(arena.allocate(16, 16) != nullptr);
+}
+
+TEST_CASE("Arena block growth")
+{
+    RecordingResource upstream;
+    mindset::Arena arena(4096, &upstream);
+
+    // Blocks double while small allocations exhaust them.
+    for (size_t i = 0; i < 4; ++i) {
+        REQUIRE(arena.allocate(4000, 8) != nullptr);
+    }
+    REQUIRE(upstream.sizes.size() >= 2);
+    REQUIRE(upstream.sizes[1] == upstream.sizes[0] * 2);
+
+    // An oversized request gets its own block, but the following blocks don't grow past the limit.
+    REQUIRE(arena.allocate(mindset::Arena::MAX_BLOCK_SIZE * 2, 8) != nullptr);
+    REQUIRE(upstream.sizes.back() > mindset::Arena::MAX_BLOCK_SIZE * 2);
+    REQUIRE(arena.allocate(64, 8) != nullptr);
+    REQUIRE(upstream.sizes.back() == mindset::Arena::MAX_BLOCK_SIZE);
+}
@@ -0,0 +1,123 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <catch2/catch_all.hpp>
+#include <mindset/mindset.h>
+
+#include <map>
+
+TEST_CASE("Motifs by group")
+{
+    mindset::Dataset dataset;
+    auto layer = dataset.getProperties().defineProperty("layer");
+    for (mindset::UID uid = 0; uid < 6; ++uid) {
+        mindset::Neuron neuron(uid, nullptr);
+        neuron.setProperty(layer, uid < 3 ? 1u : 2u);
+        dataset.addNeuron(std::move(neuron));
+    }
+
+    std::vector<mindset::Synapse> synapses;
+    auto connect = [&](mindset::UID pre, mindset::UID post) {
+        synapses.emplace_back(static_cast<mindset::UID>(synapses.size()), pre, post);
+    };
+    // Layer 1 is a cycle, layer 2 a reciprocal pair with an outgoing edge.
+    connect(0, 1);
+    connect(1, 2);
+    connect(2, 0);
+    connect(3, 4);
+    connect(4, 3);
+    connect(4, 5);
+    connect(5, 5); // Autapses are ignored.
+    connect(2, 3); // Between layers.
+    dataset.getCircuit().addSynapses(std::move(synapses));
+
+    mindset::CircuitGraph graph(dataset);
+    auto grouping = mindset::NeuronGrouping::byProperty(dataset, "layer");
+    auto groups = mindset::computeMotifs(graph, grouping, {.census = true, .clustering = true, .threads = 2});
+    REQUIRE(groups.size() == 2);
+
+    REQUIRE(groups[0].neurons == std::vector<uint32_t>{0, 1, 2});
+    REQUIRE(groups[0].connections == 3);
+    REQUIRE(groups[0].reciprocalPairs == 0);
+    REQUIRE(groups[0].census.get("030C") == 1);
+    REQUIRE(groups[0].census.get("003") == 0);
+    REQUIRE(groups[0].clustering == std::vector<double>{0.5, 0.5, 0.5});
+
+    REQUIRE(groups[1].connections == 3);
+    REQUIRE(groups[1].reciprocalPairs == 1);
+    REQUIRE(groups[1].getReciprocity() == Catch::Approx(2.0 / 3.0));
+    REQUIRE(groups[1].census.get("111U") == 1);
+    REQUIRE(groups[1].clustering == std::vector<double>{0.0, 0.0, 0.0});
+
+    auto all = mindset::computeMotifs(graph);
+    REQUIRE(all.connections == 7);
+    uint64_t triads = 0;
+    for (auto amount : all.census.counts) {
+        triads += amount;
+    }
+    REQUIRE(triads == 20);
+    REQUIRE(all.census.get("unknown") == 0);
+}
+
+TEST_CASE("Triad census matches brute force")
+{
+    mindset::DatasetGeneratorSettings settings;
+    settings.neurons = 40;
+    settings.synapses.amount = 400;
+
+    mindset::Dataset dataset;
+    mindset::DatasetGenerator(settings).generate(dataset);
+    mindset::CircuitGraph graph(dataset);
+    auto n = static_cast<uint32_t>(graph.getNeuronsAmount());
+
+    auto connected = [&](uint32_t from, uint32_t to) {
+        return std::ranges::binary_search(graph.getOutgoing(from), to);
+    };
+
+    // Triads are grouped by their amount of mutual, asymmetric and null dyads, the prefix of their names.
+    std::map<std::string, uint64_t> expected;
+    uint64_t reciprocalPairs = 0;
+    for (uint32_t a = 0; a < n; ++a) {
+        for (uint32_t b = a + 1; b < n; ++b) {
+            reciprocalPairs += connected(a, b) && connected(b, a);
+            for (uint32_t c = b + 1; c < n; ++c) {
+                int dyads[3] = {0, 0, 0};
+                for (auto [x, y] : {std::pair{a, b}, std::pair{a, c}, std::pair{b, c}}) {
+                    ++dyads[2 - connected(x, y) - connected(y, x)];
+                }
+                ++expected[std::to_string(dyads[0]) + std::to_string(dyads[1]) + std::to_string(dyads[2])];
+            }
+        }
+    }
+
+    auto single = mindset::computeMotifs(graph, {.census = true, .clustering = true, .threads = 1});
+    auto parallel = mindset::computeMotifs(graph, {.census = true, .clustering = true, .threads = 4});
+    REQUIRE(single.census.counts == parallel.census.counts);
+    REQUIRE(single.clustering == parallel.clustering);
+    REQUIRE(parallel.reciprocalPairs == reciprocalPairs);
+
+    std::map<std::string, uint64_t> counted;
+    for (size_t i = 0; i < mindset::TriadCensus::NAMES.size(); ++i) {
+        auto prefix = std::string(mindset::TriadCensus::NAMES[i].substr(0, 3));
+        counted[prefix] += parallel.census.counts[i];
+    }
+    for (auto& [prefix, amount] : expected) {
+        REQUIRE(counted[prefix] == amount);
+    }
+}
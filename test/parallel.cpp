@@ -0,0 +1,66 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <catch2/catch_all.hpp>
+#include <mindset/mindset.h>
+
+#include <numeric>
+#include <stdexcept>
+
+TEST_CASE("Thread pool")
+{
+    mindset::ThreadPool pool(4);
+    REQUIRE(pool.getThreadsAmount() == 4);
+
+    // The same workers run many consecutive loops.
+    std::vector<uint64_t> values(10'000, 0);
+    std::vector<size_t> threadsUsed(pool.getThreadsAmount(), 0);
+    for (size_t iteration = 0; iteration < 200; ++iteration) {
+        pool.forChunks(values.size(), 64, [&](size_t thread, size_t begin, size_t end) {
+            ++threadsUsed[thread];
+            for (size_t i = begin; i < end; ++i) {
+                values[i] += i;
+            }
+        });
+    }
+    size_t mismatches = 0;
+    for (size_t i = 0; i < values.size(); ++i) {
+        if (values[i] != i * 200) {
+            ++mismatches;
+        }
+    }
+    REQUIRE(mismatches == 0);
+    REQUIRE(std::accumulate(threadsUsed.begin(), threadsUsed.end(), size_t(0)) == 200 * 157);
+
+    // Single-chunk loops run inline.
+    pool.forChunks(10, 64, [&](size_t thread, size_t, size_t) { REQUIRE(thread == 0); });
+
+    // Exceptions are rethrown in the calling thread, and the pool stays usable.
+    REQUIRE_THROWS_AS(pool.forChunks(1'000, 1,
+                                     [](size_t, size_t begin, size_t) {
+                                         if (begin == 500) {
+                                             throw std::runtime_error("failure");
+                                         }
+                                     }),
+                      std::runtime_error);
+
+    std::atomic_size_t processed = 0;
+    pool.forChunks(1'000, 10, [&](size_t, size_t begin, size_t end) { processed += end - begin; });
+    REQUIRE(processed == 1'000);
+}
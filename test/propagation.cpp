@@ -0,0 +1,139 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <catch2/catch_all.hpp>
+#include <mindset/mindset.h>
+
+#include <random>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+    mindset::Dataset createPropagationDataset()
+    {
+        mindset::Dataset dataset;
+        auto delay = dataset.getProperties().defineProperty(mindset::PROPERTY_SYNAPSE_DELAY);
+        auto efficacy = dataset.getProperties().defineProperty(mindset::PROPERTY_SYNAPSE_EFFICACY);
+        for (mindset::UID uid = 1; uid <= 3; ++uid) {
+            dataset.addNeuron(mindset::Neuron(uid));
+        }
+
+        std::vector<mindset::Synapse> synapses;
+        synapses.emplace_back(0, 1, 2);
+        synapses.back().setProperty(delay, 2.0f);
+        synapses.back().setProperty(efficacy, 0.5f);
+        synapses.emplace_back(1, 1, 3);
+        synapses.back().setProperty(delay, 15.0f);
+        synapses.back().setProperty(efficacy, 1.0f);
+        synapses.emplace_back(2, 2, 3); // Uses the default delay.
+        synapses.back().setProperty(efficacy, 2.0f);
+        dataset.getCircuit().addSynapses(std::move(synapses));
+        return dataset;
+    }
+
+    mindset::EventSequence<std::monostate> createSpikes()
+    {
+        mindset::EventSequence<std::monostate> spikes;
+        spikes.addEvent(1, 0ms, std::monostate());
+        spikes.addEvent(1, 5ms, std::monostate());
+        spikes.addEvent(2, 3ms, std::monostate());
+        spikes.addEvent(4, 1ms, std::monostate()); // Not in the dataset.
+        return spikes;
+    }
+} // namespace
+
+TEST_CASE("Spike propagation arrivals")
+{
+    auto dataset = createPropagationDataset();
+    mindset::SpikePropagator propagator(dataset, {.defaultDelay = 1ms, .window = 10ms, .threads = 2});
+    REQUIRE(propagator.getSynapsesAmount() == 3);
+    REQUIRE(propagator.getMaxDelay() == 15ms);
+
+    auto spikes = createSpikes();
+    std::vector<size_t> windows;
+    size_t mismatchedTargets = 0;
+    propagator.propagate(spikes, [&](std::span<const mindset::SpikeArrival> arrivals) {
+        windows.push_back(arrivals.size());
+        for (auto& arrival : arrivals) {
+            if (propagator.getNeurons()[arrival.target] != arrival.neuron) {
+                ++mismatchedTargets;
+            }
+        }
+    });
+    REQUIRE(windows == std::vector<size_t>{3, 1, 1});
+    REQUIRE(mismatchedTargets == 0);
+
+    auto arrivals = propagator.computeArrivals(spikes);
+    std::vector<std::pair<mindset::UID, std::chrono::nanoseconds>> events;
+    for (auto& event : arrivals.getEvents()) {
+        events.emplace_back(event.uid, event.timepoint);
+    }
+    REQUIRE(events == std::vector<std::pair<mindset::UID, std::chrono::nanoseconds>>{
+                          {0, 2ms}, {2, 4ms}, {0, 7ms}, {1, 15ms}, {1, 20ms}});
+}
+
+TEST_CASE("Spike propagation input")
+{
+    auto dataset = createPropagationDataset();
+    mindset::SpikePropagator propagator(dataset, {.defaultDelay = 1ms, .window = 10ms, .threads = 2});
+
+    auto input = propagator.computeInput(createSpikes(), 5ms);
+    REQUIRE(input.getUIDIndices() == std::vector<mindset::UID>{1, 2, 3});
+    REQUIRE(input.getTimestepsAmount() == 5);
+
+    auto timeline = input.getTimeline(3);
+    REQUIRE(std::vector<double>(timeline.begin(), timeline.end()) == std::vector<double>{2.0, 0.0, 0.0, 1.0, 1.0});
+    auto second = input.getTimeline(2);
+    REQUIRE(std::vector<double>(second.begin(), second.end()) == std::vector<double>{0.5, 0.5, 0.0, 0.0, 0.0});
+}
+
+TEST_CASE("Spike propagation parallel")
+{
+    mindset::DatasetGeneratorSettings settings;
+    settings.neurons = 100;
+    settings.synapses.amount = 5'000;
+    settings.activity.spikes = false;
+
+    mindset::Dataset dataset;
+    mindset::DatasetGenerator(settings).generate(dataset);
+
+    std::mt19937 random(5);
+    std::uniform_int_distribution<mindset::UID> neuron(0, 99);
+    std::uniform_int_distribution<int> time(0, 100'000);
+    mindset::EventSequence<std::monostate> spikes;
+    for (size_t i = 0; i < 2'000; ++i) {
+        spikes.addEvent(neuron(random), std::chrono::microseconds(time(random)), std::monostate());
+    }
+
+    auto collect = [&](size_t threads) {
+        mindset::SpikePropagator propagator(dataset, {.defaultDelay = 3ms, .window = 1ms, .threads = threads});
+        std::vector<std::pair<std::chrono::nanoseconds, mindset::UID>> arrivals;
+        propagator.propagate(spikes, [&](std::span<const mindset::SpikeArrival> window) {
+            for (auto& arrival : window) {
+                arrivals.emplace_back(arrival.time, arrival.synapse);
+            }
+        });
+        return arrivals;
+    };
+
+    auto single = collect(1);
+    REQUIRE(std::ranges::is_sorted(single));
+    REQUIRE(single == collect(4));
+}
@@ -0,0 +1,126 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <catch2/catch_all.hpp>
+#include <mindset/mindset.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Property keys")
+{
+    static_assert(mindset::PROPERTY_KEY_RADIUS.getHash() == mindset::hashPropertyName("mindset:radius"));
+    REQUIRE(mindset::PROPERTY_KEY_RADIUS.getName() == mindset::PROPERTY_RADIUS);
+    REQUIRE(mindset::PROPERTY_KEY_TRANSFORM.getName() == mindset::PROPERTY_TRANSFORM);
+    REQUIRE(mindset::PROPERTY_KEY_SYNAPSE_POST_NEURITE.getName() == mindset::PROPERTY_SYNAPSE_POST_NEURITE);
+
+    mindset::Dataset dataset;
+    auto& properties = dataset.getProperties();
+    REQUIRE_FALSE(properties.getPropertyUID(mindset::PROPERTY_KEY_RADIUS).has_value());
+
+    auto radius = properties.defineProperty(mindset::PROPERTY_RADIUS);
+    REQUIRE(properties.getPropertyUID(mindset::PROPERTY_KEY_RADIUS) == radius);
+    REQUIRE(properties.defineProperty(mindset::PROPERTY_KEY_RADIUS) == radius);
+
+    mindset::Neuron neuron(1, nullptr);
+    auto contextualized = neuron | dataset;
+    REQUIRE_FALSE(contextualized.setProperty(mindset::PROPERTY_KEY_LAYER, 4).has_value());
+    REQUIRE(properties.isPropertyDefined(mindset::PROPERTY_LAYER));
+    REQUIRE(contextualized.getLayer() == 4);
+    REQUIRE(contextualized.getProperty(mindset::PROPERTY_KEY_LAYER) == 4);
+    REQUIRE(contextualized.getProperty<mindset::UID>(mindset::PROPERTY_LAYER) == 4);
+
+    // The key's type is checked.
+    REQUIRE_FALSE(contextualized.getLayer<float>().has_value());
+    REQUIRE_FALSE(contextualized.getRadius().has_value());
+
+    // Typed pointers avoid copying the value.
+    REQUIRE_FALSE(contextualized.setProperty(mindset::PROPERTY_KEY_NAME, "neuron").has_value());
+    auto name = contextualized.getPropertyPtr(mindset::PROPERTY_KEY_NAME);
+    REQUIRE(name.has_value());
+    REQUIRE(*name.value() == "neuron");
+
+    // Removed and cleared properties are no longer resolved.
+    properties.removeProperty(mindset::PROPERTY_LAYER);
+    REQUIRE_FALSE(properties.getPropertyUID(mindset::PROPERTY_KEY_LAYER).has_value());
+    properties.clear();
+    REQUIRE_FALSE(properties.getPropertyUID(mindset::PROPERTY_KEY_RADIUS).has_value());
+}
+
+TEST_CASE("Property key hash mismatch")
+{
+    mindset::Properties properties;
+    auto first = properties.defineProperty("first");
+    auto second = properties.defineProperty("second");
+
+    auto hash = mindset::hashPropertyName("first");
+    REQUIRE(properties.getPropertyUIDByHash(hash, "first") == first);
+
+    // A name whose hash is owned by another property is resolved by name, never as the owner.
+    REQUIRE(properties.getPropertyUIDByHash(hash, "second") == second);
+    REQUIRE_FALSE(properties.getPropertyUIDByHash(hash, "third").has_value());
+    REQUIRE_FALSE(properties.getPropertyUIDByHash(mindset::hashPropertyName("third"), "third").has_value());
+}
+
+TEST_CASE("Property key cache")
+{
+    constexpr mindset::PropertyKey<float> key("cached");
+    mindset::Properties properties;
+    REQUIRE_FALSE(properties.getPropertyUID(key).has_value());
+    REQUIRE_FALSE(properties.getPropertyUID(key).has_value());
+
+    // Defining, removing and clearing properties invalidates the resolved keys.
+    auto uid = properties.defineProperty("cached");
+    REQUIRE(properties.getPropertyUID(key) == uid);
+    REQUIRE(properties.getPropertyUID(key) == uid);
+
+    properties.removeProperty("cached");
+    REQUIRE_FALSE(properties.getPropertyUID(key).has_value());
+    properties.defineProperty("cached", 42);
+    REQUIRE(properties.getPropertyUID(key) == 42);
+
+    // Keys sharing the name storage but not its length are different keys.
+    mindset::PropertyKey<float> prefix(key.getName().substr(0, 3));
+    REQUIRE_FALSE(properties.getPropertyUID(prefix).has_value());
+    REQUIRE(properties.getPropertyUID(key) == 42);
+
+    mindset::Properties copy = properties;
+    REQUIRE(copy.getPropertyUID(key) == 42);
+    properties.clear();
+    REQUIRE_FALSE(properties.getPropertyUID(key).has_value());
+    REQUIRE(copy.getPropertyUID(key) == 42);
+
+    // Concurrent lookups fill the cache while others read it.
+    std::atomic_size_t mismatches = 0;
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < 4; ++t) {
+        threads.emplace_back([&] {
+            for (size_t i = 0; i < 10'000; ++i) {
+                if (copy.getPropertyUID(key) != 42 || copy.getPropertyUID(prefix).has_value()) {
+                    ++mismatches;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    REQUIRE(mismatches == 0);
+}
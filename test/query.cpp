@@ -0,0 +1,159 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <catch2/catch_all.hpp>
+#include <mindset/mindset.h>
+
+namespace
+{
+    void createNeurons(mindset::Dataset& dataset)
+    {
+        auto layer = dataset.getProperties().defineProperty("layer");
+        auto depth = dataset.getProperties().defineProperty("depth");
+        auto name = dataset.getProperties().defineProperty("name");
+
+        for (mindset::UID uid = 0; uid < 1000; ++uid) {
+            mindset::Neuron neuron(uid);
+            neuron.setProperty(layer, static_cast<int>(uid % 6));
+            neuron.setProperty(depth, static_cast<double>(uid) * 0.5);
+            if (uid % 100 == 0) {
+                neuron.setProperty(name, std::string("hundred"));
+            }
+            dataset.addNeuron(std::move(neuron));
+        }
+    }
+
+    mindset::UIDSet expected(auto filter)
+    {
+        std::vector<mindset::UID> uids;
+        for (mindset::UID uid = 0; uid < 1000; ++uid) {
+            if (filter(uid)) {
+                uids.push_back(uid);
+            }
+        }
+        return mindset::UIDSet(std::move(uids));
+    }
+} // namespace
+
+TEST_CASE("UID set operations")
+{
+    mindset::UIDSet a{5, 1, 3, 3};
+    mindset::UIDSet b{3, 4, 5};
+
+    REQUIRE(a.size() == 3);
+    REQUIRE(a.intersect(b) == mindset::UIDSet{3, 5});
+    REQUIRE(a.unite(b) == mindset::UIDSet{1, 3, 4, 5});
+    REQUIRE(a.subtract(b) == mindset::UIDSet{1});
+}
+
+TEST_CASE("Query neurons")
+{
+    using mindset::Predicate;
+
+    mindset::Dataset dataset;
+    createNeurons(dataset);
+
+    mindset::QueryEngine engine(dataset);
+
+    auto layered = Predicate::in("layer", {int64_t(2), int64_t(4)}) && Predicate::range("depth", 100.0, 300.0);
+    auto layeredExpected = expected([](mindset::UID uid) {
+        return (uid % 6 == 2 || uid % 6 == 4) && uid >= 200 && uid <= 600;
+    });
+
+    auto named = Predicate::equals("name", std::string("hundred")) && !Predicate::equals("layer", int64_t(0));
+    auto namedExpected = expected([](mindset::UID uid) { return uid % 100 == 0 && uid % 6 != 0; });
+
+    // Without indexes, queries are answered by scanning.
+    REQUIRE(engine.queryNeurons(layered) == layeredExpected);
+    REQUIRE(engine.queryNeurons(named) == namedExpected);
+
+    engine.addNeuronIndex("layer", mindset::IndexType::CATEGORICAL);
+    engine.addNeuronIndex("depth", mindset::IndexType::RANGE);
+    engine.rebuildIndexes();
+    REQUIRE(engine.areNeuronIndexesUpToDate());
+
+    REQUIRE(engine.queryNeurons(layered) == layeredExpected);
+    REQUIRE(engine.queryNeurons(named) == namedExpected);
+    REQUIRE(engine.queryNeurons(Predicate::equals("unknown", int64_t(1))).empty());
+    REQUIRE(engine.queryNeurons(Predicate::always()).size() == 1000);
+
+    auto custom = Predicate::custom([](mindset::UID uid, const mindset::PropertyHolder&) { return uid < 10; });
+    REQUIRE(engine.queryNeurons(custom && Predicate::equals("layer", int64_t(1))) == mindset::UIDSet{1, 7});
+
+    // Stale indexes are ignored.
+    dataset.addNeuron(mindset::Neuron(5000));
+    REQUIRE_FALSE(engine.areNeuronIndexesUpToDate());
+    REQUIRE(engine.queryNeurons(Predicate::always()).size() == 1001);
+}
+
+TEST_CASE("Categorical index matches scans")
+{
+    using mindset::Predicate;
+
+    mindset::Dataset dataset;
+    auto value = dataset.getProperties().defineProperty("value");
+    for (mindset::UID uid = 0; uid < 100; ++uid) {
+        mindset::Neuron neuron(uid);
+        switch (uid % 5) {
+            case 0:
+                neuron.setProperty(value, static_cast<int>(uid % 3));
+                break;
+            case 1:
+                neuron.setProperty(value, 2.0f);
+                break;
+            case 2:
+                neuron.setProperty(value, 2.5f);
+                break;
+            case 3:
+                neuron.setProperty(value, 1.0);
+                break;
+            default:
+                break;
+        }
+        dataset.addNeuron(std::move(neuron));
+    }
+
+    std::vector<Predicate> predicates = {
+        Predicate::equals("value", int64_t(2)),
+        Predicate::equals("value", 2.0),
+        Predicate::equals("value", 2.5),
+        Predicate::equals("value", int64_t(1)),
+        Predicate::in("value", {int64_t(1), 2.0}),
+    };
+
+    mindset::QueryEngine scanning(dataset);
+    mindset::QueryEngine indexed(dataset);
+    indexed.addNeuronIndex("value", mindset::IndexType::CATEGORICAL);
+    indexed.rebuildIndexes();
+    REQUIRE(indexed.areNeuronIndexesUpToDate());
+
+    for (auto& predicate : predicates) {
+        REQUIRE_FALSE(scanning.queryNeurons(predicate).empty());
+        REQUIRE(indexed.queryNeurons(predicate) == scanning.queryNeurons(predicate));
+    }
+
+    // Values too large to be compared exactly disable the index instead of being dropped from it.
+    dataset.getNeuron(4).value()->setProperty(value, 9007199254740992.0);
+    mindset::QueryEngine large(dataset);
+    large.addNeuronIndex("value", mindset::IndexType::CATEGORICAL);
+    large.rebuildIndexes();
+    auto huge = Predicate::equals("value", int64_t(9007199254740993));
+    REQUIRE(large.queryNeurons(huge) == scanning.queryNeurons(huge));
+    REQUIRE(scanning.queryNeurons(huge) == mindset::UIDSet{4});
+}
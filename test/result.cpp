@@ -0,0 +1,152 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <catch2/catch_all.hpp>
+#include <mindset/util/Result.h>
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+TEST_CASE("Result")
+{
+    using IntResult = mindset::Result<int, std::string>;
+
+    IntResult ok = 21;
+    IntResult error = std::string("error");
+    REQUIRE(ok.isOk());
+    REQUIRE_FALSE(error.isOk());
+    REQUIRE(error.getError() == "error");
+
+    auto doubled = ok.map([](int value) { return value * 2.0; });
+    REQUIRE(doubled.isOk());
+    REQUIRE(doubled.getResult() == 42.0);
+    REQUIRE_FALSE(error.map([](int value) { return value * 2.0; }).isOk());
+
+    auto length = error.mapError([](const std::string& value) { return value.size(); });
+    REQUIRE(length.getError() == 5);
+
+    auto chained = ok.andThen([](int value) -> IntResult {
+        if (value > 10) {
+            return std::string("too big");
+        }
+        return value;
+    });
+    REQUIRE(chained.getError() == "too big");
+
+    bool called = false;
+    REQUIRE(ok.orElseGet([&] {
+        called = true;
+        return 0;
+    }) == 21);
+    REQUIRE_FALSE(called);
+    REQUIRE(error.orElseGet([] { return 7; }) == 7);
+
+    // Move-only values can be moved in and out.
+    using PointerResult = mindset::Result<std::unique_ptr<int>, std::string>;
+    PointerResult pointer = std::make_unique<int>(3);
+    PointerResult moved = std::move(pointer);
+    REQUIRE(*moved.getResult() == 3);
+    auto value = std::move(moved).map([](std::unique_ptr<int> p) { return *p + 1; });
+    REQUIRE(value.getResult() == 4);
+
+    IntResult copy = error;
+    copy = ok;
+    REQUIRE(copy.getResult() == 21);
+
+    // The value is stored inline and properly aligned.
+    struct alignas(32) Aligned
+    {
+        float values[8];
+    };
+    mindset::Result<Aligned, int> aligned = Aligned{};
+    REQUIRE(alignof(decltype(aligned)) == 32);
+    REQUIRE(reinterpret_cast<uintptr_t>(&aligned.getResult()) % 32 == 0);
+}
+
+namespace
+{
+    struct ThrowingCopy
+    {
+        static inline int alive = 0;
+        bool throwOnCopy = false;
+
+        explicit ThrowingCopy(bool throwOnCopy) :
+            throwOnCopy(throwOnCopy)
+        {
+            ++alive;
+        }
+
+        ThrowingCopy(const ThrowingCopy& other) :
+            throwOnCopy(other.throwOnCopy)
+        {
+            if (throwOnCopy) {
+                throw std::runtime_error("copy");
+            }
+            ++alive;
+        }
+
+        ThrowingCopy(ThrowingCopy&& other) noexcept :
+            throwOnCopy(other.throwOnCopy)
+        {
+            ++alive;
+        }
+
+        ThrowingCopy& operator=(const ThrowingCopy&) = delete;
+
+        ~ThrowingCopy()
+        {
+            --alive;
+        }
+    };
+} // namespace
+
+TEST_CASE("Result assignment exception safety")
+{
+    using ThrowingResult = mindset::Result<ThrowingCopy, std::string>;
+    {
+        ThrowingResult error = std::string("error");
+        ThrowingResult throwing = ThrowingCopy(true);
+        REQUIRE_THROWS(error = throwing);
+        REQUIRE_FALSE(error.isOk());
+        REQUIRE(error.getError() == "error");
+
+        ThrowingResult ok = ThrowingCopy(false);
+        REQUIRE_THROWS(ok = throwing);
+        REQUIRE(ok.isOk());
+        REQUIRE_FALSE(ok.getResult().throwOnCopy);
+
+        ok = error;
+        REQUIRE(ok.getError() == "error");
+        error = std::move(throwing);
+        REQUIRE(error.isOk());
+    }
+    // Every value was destroyed exactly once.
+    REQUIRE(ThrowingCopy::alive == 0);
+
+    // Values of the same alternative are assigned in place.
+    mindset::Result<std::string, int> text = std::string("first");
+    text.getResult().reserve(64);
+    const char* buffer = text.getResult().data();
+    mindset::Result<std::string, int> other = std::string("second");
+    text = other;
+    REQUIRE(text.getResult() == "second");
+    REQUIRE(text.getResult().data() == buffer);
+}
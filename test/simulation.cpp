@@ -0,0 +1,167 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <catch2/catch_all.hpp>
+#include <mindset/mindset.h>
+
+#include <cmath>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+    std::vector<std::chrono::nanoseconds> getSpikeTimes(const mindset::EventSequence<std::monostate>& spikes,
+                                                        mindset::UID neuron)
+    {
+        std::vector<std::chrono::nanoseconds> times;
+        for (auto& event : spikes.getEvents()) {
+            if (event.uid == neuron) {
+                times.push_back(event.timepoint);
+            }
+        }
+        return times;
+    }
+
+    std::vector<std::pair<std::chrono::nanoseconds, mindset::UID>> getSpikes(const mindset::LIFSimulator& simulator)
+    {
+        auto sequence = simulator.getSpikes();
+        std::vector<std::pair<std::chrono::nanoseconds, mindset::UID>> spikes;
+        for (auto& event : sequence.getEvents()) {
+            spikes.emplace_back(event.timepoint, event.uid);
+        }
+        return spikes;
+    }
+} // namespace
+
+TEST_CASE("LIF constant input")
+{
+    mindset::Dataset dataset;
+    dataset.addNeuron(mindset::Neuron(1));
+
+    mindset::LIFSimulationSettings settings;
+    settings.neuron.externalInput = 20.0;
+    settings.voltageDelta = 1ms;
+    mindset::LIFSimulator simulator(dataset, settings);
+    simulator.run(50ms);
+    REQUIRE(simulator.getTime() == 50ms);
+
+    // The membrane reaches the threshold at tau * ln(input / (input - (threshold - rest))).
+    auto expected = std::chrono::duration<double, std::milli>(10.0 * std::log(20.0 / 5.0));
+    auto times = getSpikeTimes(simulator.getSpikes(), 1);
+    REQUIRE(times.size() == 3);
+    REQUIRE(std::chrono::duration<double, std::milli>(times[0]).count() ==
+            Catch::Approx(expected.count()).margin(0.1));
+    REQUIRE(std::chrono::duration<double, std::milli>(times[1] - times[0]).count() ==
+            Catch::Approx(expected.count() + 2.0).margin(0.2));
+
+    auto voltages = simulator.getVoltageGrid();
+    REQUIRE(voltages.getDelta() == 1ms);
+    REQUIRE(voltages.getTimestepsAmount() == 50);
+    auto timeline = voltages.getTimeline(1);
+    REQUIRE(timeline[0] == Catch::Approx(-70.0));
+    REQUIRE(timeline[5] == Catch::Approx(-70.0 + 20.0 * (1.0 - std::exp(-0.5))).margin(1e-6));
+}
+
+TEST_CASE("LIF synaptic delay")
+{
+    mindset::Dataset dataset;
+    auto delay = dataset.getProperties().defineProperty(mindset::PROPERTY_SYNAPSE_DELAY);
+    auto efficacy = dataset.getProperties().defineProperty(mindset::PROPERTY_SYNAPSE_EFFICACY);
+    for (mindset::UID uid = 1; uid <= 3; ++uid) {
+        dataset.addNeuron(mindset::Neuron(uid));
+    }
+
+    std::vector<mindset::Synapse> synapses;
+    synapses.emplace_back(0, 1, 2);
+    synapses.back().setProperty(delay, 5.0f);
+    synapses.back().setProperty(efficacy, 100.0f);
+    synapses.emplace_back(1, 1, 4); // Not in the dataset.
+    dataset.getCircuit().addSynapses(std::move(synapses));
+
+    mindset::LIFSimulationSettings settings;
+    settings.neuron.externalInput = 20.0;
+    settings.threads = 2;
+    mindset::LIFSimulator simulator(dataset, settings);
+    REQUIRE(simulator.getSynapsesAmount() == 1);
+    simulator.run(40ms);
+
+    auto spikes = simulator.getSpikes();
+    auto source = getSpikeTimes(spikes, 1);
+    auto target = getSpikeTimes(spikes, 2);
+    auto control = getSpikeTimes(spikes, 3);
+    REQUIRE(source == control);
+    REQUIRE(source.size() >= 2);
+    REQUIRE(target.size() > source.size());
+
+    // Every neuron fires together first. The target fires again right after the input arrives,
+    // long before the unconnected neurons.
+    REQUIRE(target[0] == source[0]);
+    REQUIRE(target[1] > source[0] + 5ms);
+    REQUIRE(target[1] < source[0] + 7ms);
+    REQUIRE(target[1] < source[1]);
+}
+
+TEST_CASE("LIF parallel simulation")
+{
+    mindset::DatasetGeneratorSettings generatorSettings;
+    generatorSettings.neurons = 500;
+    generatorSettings.synapses.amount = 20'000;
+    generatorSettings.activity.spikes = false;
+
+    mindset::Dataset dataset;
+    mindset::DatasetGenerator(generatorSettings).generate(dataset);
+
+    auto simulate = [&](size_t threads) {
+        mindset::LIFSimulationSettings settings;
+        settings.defaultWeight = 2.0f;
+        settings.backgroundRate = 2'000.0;
+        settings.backgroundWeight = 3.0f;
+        settings.seed = 7;
+        settings.voltageDelta = 5ms;
+        settings.threads = threads;
+        auto simulator = std::make_unique<mindset::LIFSimulator>(dataset, settings);
+        simulator->run(25ms);
+        simulator->run(25ms);
+        return simulator;
+    };
+
+    auto single = simulate(1);
+    auto parallel = simulate(4);
+    REQUIRE(single->getNeuronsAmount() == 500);
+    REQUIRE(single->getSpikesAmount() > 0);
+    REQUIRE(getSpikes(*single) == getSpikes(*parallel));
+    REQUIRE(std::ranges::equal(single->getVoltages(), parallel->getVoltages()));
+
+    auto uid = parallel->writeActivity(dataset);
+    auto activity = dataset.getActivity(uid);
+    REQUIRE(activity.has_value());
+
+    auto spikesProperty = dataset.getProperties().getPropertyUID(mindset::PROPERTY_ACTIVITY_SPIKES);
+    auto voltageProperty = dataset.getProperties().getPropertyUID(mindset::PROPERTY_ACTIVITY_VOLTAGE);
+    REQUIRE(spikesProperty.has_value());
+    REQUIRE(voltageProperty.has_value());
+
+    auto spikes = activity.value()->getPropertyPtr<mindset::EventSequence<std::monostate>>(spikesProperty.value());
+    REQUIRE(spikes.has_value());
+    REQUIRE(spikes.value()->getEvents().size() == parallel->getSpikesAmount());
+
+    auto voltages = activity.value()->getPropertyPtr<mindset::TimeGrid<double>>(voltageProperty.value());
+    REQUIRE(voltages.has_value());
+    REQUIRE(voltages.value()->getTimestepsAmount() == 10);
+}
@@ -0,0 +1,243 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+
+#include <catch2/catch_all.hpp>
+#include <mindset/mindset.h>
+
+namespace
+{
+    std::vector<mindset::UID> bruteForceSphere(const std::map<mindset::UID, rush::Vec3f>& positions,
+                                               const rush::Vec3f& center, float radius)
+    {
+        std::vector<mindset::UID> result;
+        for (auto& [uid, position] : positions) {
+            if ((position - center).squaredLength() <= radius * radius) {
+                result.push_back(uid);
+            }
+        }
+        return result;
+    }
+} // namespace
+
+TEST_CASE("Neuron spatial index")
+{
+    mindset::Dataset dataset;
+    auto transformProperty = dataset.getProperties().defineProperty(mindset::PROPERTY_TRANSFORM);
+
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> distribution(0.0f, 1000.0f);
+    std::map<mindset::UID, rush::Vec3f> positions;
+
+    auto addNeuron = [&](mindset::UID uid) {
+        rush::Vec3f position(distribution(random), distribution(random), distribution(random));
+        mindset::NeuronTransform transform;
+        transform.setPosition(position);
+        mindset::Neuron neuron(uid);
+        neuron.setProperty(transformProperty, transform);
+        dataset.addNeuron(std::move(neuron));
+        positions[uid] = position;
+    };
+
+    for (mindset::UID uid = 0; uid < 500; ++uid) {
+        addNeuron(uid);
+    }
+
+    mindset::NeuronSpatialIndex index(dataset);
+    REQUIRE(index.size() == 500);
+
+    rush::Vec3f center(500.0f, 500.0f, 500.0f);
+    REQUIRE(index.querySphere(center, 200.0f) == bruteForceSphere(positions, center, 200.0f));
+
+    // Incremental updates through the dataset events.
+    for (mindset::UID uid = 500; uid < 520; ++uid) {
+        addNeuron(uid);
+    }
+    for (mindset::UID uid = 0; uid < 10; ++uid) {
+        dataset.removeNeuron(uid);
+        positions.erase(uid);
+    }
+    REQUIRE(index.size() == 510);
+    REQUIRE(index.querySphere(center, 300.0f) == bruteForceSphere(positions, center, 300.0f));
+
+    auto box = mindset::AABB{rush::Vec3f(0.0f, 0.0f, 0.0f), rush::Vec3f(250.0f, 500.0f, 1000.0f)};
+    size_t expected = std::ranges::count_if(positions, [&](const auto& pair) { return box.contains(pair.second); });
+    REQUIRE(index.queryBox(box).size() == expected);
+
+    auto nearest = index.queryNearest(center, 5);
+    REQUIRE(nearest.size() == 5);
+    std::vector<float> distances;
+    for (auto& position : positions | std::views::values) {
+        distances.push_back((position - center).length());
+    }
+    std::ranges::sort(distances);
+    for (size_t i = 0; i < 5; ++i) {
+        REQUIRE(std::abs(nearest[i].second - distances[i]) < 0.01f);
+    }
+
+    // Moving a neuron requires a refresh.
+    auto* moved = dataset.getNeuron(100).value();
+    mindset::NeuronTransform transform;
+    transform.setPosition(center);
+    moved->setProperty(transformProperty, transform);
+    REQUIRE(index.refresh() == 1);
+    REQUIRE(index.queryNearest(center, 1).front().first == 100);
+
+    dataset.clear();
+    REQUIRE(index.size() == 0);
+    REQUIRE(index.querySphere(center, 1000.0f).empty());
+}
+
+TEST_CASE("Synapse spatial index")
+{
+    mindset::Dataset dataset;
+    auto positionProperty = dataset.getProperties().defineProperty(mindset::PROPERTY_POSITION);
+    auto& circuit = dataset.getCircuit();
+
+    std::mt19937 random(7);
+    std::uniform_real_distribution<float> distribution(-100.0f, 100.0f);
+    std::map<mindset::UID, rush::Vec3f> positions;
+
+    auto addSynapse = [&](mindset::UID uid) {
+        rush::Vec3f position(distribution(random), distribution(random), distribution(random));
+        mindset::Synapse synapse(uid, 0, 1);
+        synapse.setProperty(positionProperty, position);
+        circuit.addSynapse(std::move(synapse));
+        positions[uid] = position;
+    };
+
+    for (mindset::UID uid = 0; uid < 2000; ++uid) {
+        addSynapse(uid);
+    }
+
+    mindset::SynapseSpatialIndex index(dataset, 10.0f);
+    REQUIRE(index.size() == 2000);
+
+    addSynapse(5000);
+    circuit.removeSynapse(3);
+    positions.erase(3);
+    REQUIRE(index.size() == 2000);
+
+    rush::Vec3f center(10.0f, -5.0f, 20.0f);
+    REQUIRE(index.querySphere(center, 45.0f) == bruteForceSphere(positions, center, 45.0f));
+
+    mindset::AABB box{rush::Vec3f(-30.0f, -100.0f, 0.0f), rush::Vec3f(25.0f, 100.0f, 15.0f)};
+    std::vector<mindset::UID> inBox;
+    for (auto& [uid, position] : positions) {
+        if (box.contains(position)) {
+            inBox.push_back(uid);
+        }
+    }
+    REQUIRE(index.queryBox(box) == inBox);
+
+    // An orthographic projection whose clip volume is the box.
+    rush::Mat4f projection(1.0f);
+    for (size_t i = 0; i < 3; ++i) {
+        projection[i][i] = 2.0f / (box.max[i] - box.min[i]);
+        projection[3][i] = -(box.max[i] + box.min[i]) / (box.max[i] - box.min[i]);
+    }
+    auto frustum = mindset::Frustum::fromMatrix(projection);
+    REQUIRE(index.queryFrustum(frustum) == inBox);
+
+    size_t total = 0;
+    for (auto& [voxel, count] : index.getVoxelCounts()) {
+        REQUIRE(count == index.getVoxelCount(voxel));
+        total += count;
+    }
+    REQUIRE(total == 2000);
+}
+
+TEST_CASE("Synapse spatial index limits")
+{
+    mindset::Dataset dataset;
+    auto positionProperty = dataset.getProperties().defineProperty(mindset::PROPERTY_POSITION);
+
+    for (float size : {0.0f, -1.0f, std::numeric_limits<float>::infinity(), std::nanf("")}) {
+        REQUIRE_THROWS_AS(mindset::SynapseSpatialIndex(dataset, size), std::invalid_argument);
+    }
+
+    // Positions beyond the grid are clamped into the last voxel, which the queries must still visit.
+    float far = std::ldexp(1.0f, 41);
+    mindset::Synapse synapse(0, 0, 1);
+    synapse.setProperty(positionProperty, rush::Vec3f(far, 0.5f, 0.5f));
+    dataset.getCircuit().addSynapse(std::move(synapse));
+
+    mindset::SynapseSpatialIndex index(dataset, 1024.0f);
+    REQUIRE(index.getVoxel(rush::Vec3f(far, 0.0f, 0.0f)).x() == std::numeric_limits<int32_t>::max());
+    // The box covers a single voxel, so the query walks the voxel range instead of the occupied voxels.
+    mindset::AABB box{rush::Vec3f(far, 0.0f, 0.0f), rush::Vec3f(far + 512.0f, 1.0f, 1.0f)};
+    REQUIRE(index.queryBox(box) == std::vector<mindset::UID>{0});
+}
+
+TEST_CASE("Touch detection")
+{
+    mindset::Dataset dataset;
+    auto& properties = dataset.getProperties();
+    auto position = properties.defineProperty(mindset::PROPERTY_POSITION);
+    auto radius = properties.defineProperty(mindset::PROPERTY_RADIUS);
+    auto parent = properties.defineProperty(mindset::PROPERTY_PARENT);
+    auto type = properties.defineProperty(mindset::PROPERTY_NEURITE_TYPE);
+    auto transformProperty = properties.defineProperty(mindset::PROPERTY_TRANSFORM);
+
+    // A straight neurite of two segments starting at a soma.
+    auto createNeuron = [&](mindset::UID uid, rush::Vec3f origin, rush::Vec3f direction,
+                            mindset::NeuriteType neuriteType, rush::Vec3f globalPosition) {
+        auto morphology = std::make_shared<mindset::Morphology>();
+        mindset::Soma soma(0);
+        soma.addNode({origin, 1.0f});
+        morphology->setSoma(soma);
+        for (mindset::UID i = 1; i <= 2; ++i) {
+            mindset::Neurite neurite(i);
+            neurite.setProperty(position, origin + direction * static_cast<float>(i));
+            neurite.setProperty(radius, 0.5f);
+            neurite.setProperty(parent, i - 1);
+            neurite.setProperty(type, neuriteType);
+            morphology->addNeurite(std::move(neurite));
+        }
+        mindset::NeuronTransform transform;
+        transform.setPosition(globalPosition);
+        mindset::Neuron neuron(uid, morphology);
+        neuron.setProperty(transformProperty, transform);
+        dataset.addNeuron(std::move(neuron));
+    };
+
+    createNeuron(1, rush::Vec3f(0.0f, 0.0f, 0.0f), rush::Vec3f(10.0f, 0.0f, 0.0f), mindset::NeuriteType::AXON,
+                 rush::Vec3f(0.0f, 0.0f, 0.0f));
+    createNeuron(2, rush::Vec3f(0.0f, -20.0f, 0.0f), rush::Vec3f(0.0f, 15.0f, 0.0f),
+                 mindset::NeuriteType::BASAL_DENDRITE, rush::Vec3f(15.0f, 0.0f, 0.5f));
+
+    for (float cellSize : {0.0f, 1.0f}) {
+        mindset::TouchDetector detector({.threshold = 0.5f, .cellSize = cellSize});
+        auto touches = detector.detect(dataset);
+        REQUIRE(touches.size() == 1);
+        REQUIRE(touches[0].preNeuron == 1);
+        REQUIRE(touches[0].postNeuron == 2);
+        REQUIRE(touches[0].preNeurite == 2);
+        REQUIRE(touches[0].postNeurite == 2);
+        REQUIRE(std::abs(touches[0].distance + 0.5f) < 1e-4f);
+    }
+
+    auto touches = mindset::TouchDetector().detect(dataset);
+    REQUIRE(mindset::TouchDetector::addSynapses(dataset, touches, 0) == 1);
+    REQUIRE(dataset.getCircuit().getSynapse(0).has_value());
+}
@@ -21,6 +21,10 @@
 #include <mindset/mindset.h>
 #include <mindset/Contextualized.h>
 
+#include <fstream>
+#include <mutex>
+#include <thread>
+
 TEST_CASE("Test")
 {
     mindset::Dataset dataset;
@@ -42,6 +46,167 @@ TEST_CASE("Test")
     }
 }
 
+TEST_CASE("Async load")
+{
+    mindset::Dataset dataset;
+    mindset::SWCLoader loader(mindset::LoaderCreateInfo(), std::filesystem::current_path() / "data/test.swc");
+    auto status = loader.loadAsync(dataset).get();
+
+    REQUIRE(status.status == mindset::LoaderStatusType::DONE);
+    REQUIRE(dataset.getNeurons().size() == 1);
+
+    REQUIRE(!status.stageTimings.empty());
+    auto parsing = std::ranges::find(status.stageTimings, "Parsing SWC file", &mindset::LoaderStageTiming::task);
+    REQUIRE(parsing != status.stageTimings.end());
+    REQUIRE(parsing->items > 0);
+    REQUIRE(parsing->seconds >= 0.0);
+}
+
+TEST_CASE("Chrome trace")
+{
+    auto& tracer = mindset::Tracer::getInstance();
+    tracer.clear();
+    tracer.setEnabled(true);
+    {
+        mindset::TraceScope scope("Test scope");
+    }
+    tracer.recordCounter("Test counter", 3.0);
+    tracer.setEnabled(false);
+
+    auto summary = tracer.getSummary();
+    REQUIRE(std::ranges::find(summary, "Test scope", &mindset::TraceSummary::name) != summary.end());
+
+    std::stringstream stream;
+    tracer.writeChromeTrace(stream);
+    auto json = stream.str();
+    REQUIRE(json.find("\"name\":\"Test scope\"") != std::string::npos);
+    REQUIRE(json.find("\"ph\":\"C\"") != std::string::npos);
+    tracer.clear();
+}
+
+TEST_CASE("Cancelled load")
+{
+    mindset::Dataset dataset;
+    mindset::SWCLoader loader(mindset::LoaderCreateInfo(), std::filesystem::current_path() / "data/test.swc");
+
+    std::stop_source source;
+    source.request_stop();
+    auto status = loader.loadAsync(dataset, source.get_token()).get();
+
+    REQUIRE(status.status == mindset::LoaderStatusType::CANCELLED);
+    REQUIRE(dataset.getNeurons().empty());
+}
+
+namespace
+{
+    /**
+     * Loader that keeps reporting progress after finishing, like a late parallel worker would.
+     */
+    class LateProgressLoader : public mindset::Loader
+    {
+      public:
+        LateProgressLoader() :
+            Loader(mindset::LoaderCreateInfo())
+        {
+        }
+
+        void load(mindset::Dataset&) const override
+        {
+            mindset::LoaderProgress progress(*this, 1);
+            progress.startStage(0, "Working", 2);
+            progress.addProgress(1);
+            progress.reportDone();
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(150));
+            progress.addProgress(1);
+            progress.startStage(0, "Late stage");
+            progress.reportError("Late error");
+        }
+    };
+} // namespace
+
+TEST_CASE("Final loader status")
+{
+    mindset::Dataset dataset;
+    LateProgressLoader loader;
+    auto status = loader.loadAsync(dataset).get();
+
+    REQUIRE(status.status == mindset::LoaderStatusType::DONE);
+    REQUIRE(status.stagesCompleted == 1);
+}
+
+TEST_CASE("Batch load")
+{
+    mindset::Dataset dataset;
+    mindset::SWCBatchLoader loader(mindset::LoaderCreateInfo(), std::filesystem::current_path() / "data/*.swc");
+    REQUIRE(loader.getPaths().size() == 1);
+
+    loader.load(dataset);
+
+    REQUIRE(dataset.getNeurons().size() == 1);
+    REQUIRE(dataset.getNeuron(0).has_value());
+    REQUIRE(dataset.getNeuron(0).value()->getMorphology().has_value());
+}
+
+TEST_CASE("Batch load UID mapping")
+{
+    REQUIRE(mindset::SWCBatchLoader::uidFromFilename("dir/42.swc") == 42);
+    REQUIRE(!mindset::SWCBatchLoader::uidFromFilename("dir/test.swc").has_value());
+    REQUIRE(mindset::SWCBatchLoader::matchesGlob("neuron_12.swc", "neuron_*.swc"));
+    REQUIRE(mindset::SWCBatchLoader::matchesGlob("a.swc", "?.swc"));
+    REQUIRE(!mindset::SWCBatchLoader::matchesGlob("neuron_12.asc", "*.swc"));
+}
+
+TEST_CASE("XML scene load")
+{
+    mindset::LoaderRegistry registry;
+    auto factory = registry.get(mindset::XML_LOADER_ID);
+    REQUIRE(factory.has_value());
+    REQUIRE(factory->getId() == mindset::XML_LOADER_ID);
+    REQUIRE(factory->getDisplayName() == mindset::XML_LOADER_NAME);
+    REQUIRE(factory->supportsFile("scene.xml"));
+    REQUIRE(factory->getEnvironmentEntries().contains(mindset::XML_LOADER_ENTRY_THREADS));
+
+    std::vector<std::string> swc;
+    std::ifstream file(std::filesystem::current_path() / "data/test.swc");
+    for (std::string line; std::getline(file, line);) {
+        swc.push_back(line);
+    }
+
+    std::stringstream xml;
+    xml << "<scene><morphology><columns><column id=\"0\"><minicolumn id=\"0\">";
+    for (size_t i = 0; i < 4; ++i) {
+        xml << "<neuron gid=\"" << i << "\" layer=\"1\"/>";
+    }
+    xml << "</minicolumn></column></columns><neuronmorphologies>"
+           "<neuronmorphology neurons=\"0,2\" swc=\"a.swc\"/>"
+           "<neuronmorphology neurons=\"1,3\" swc=\"b.swc\"/>"
+           "</neuronmorphologies></morphology></scene>";
+
+    std::vector<std::filesystem::path> requested;
+    std::mutex mutex;
+    auto provider = [&](const std::filesystem::path& path) -> std::optional<std::vector<std::string>> {
+        std::lock_guard lock(mutex);
+        requested.push_back(path);
+        return swc;
+    };
+
+    mindset::Environment environment = {{mindset::XML_LOADER_ENTRY_THREADS, std::any(static_cast<size_t>(2))}};
+    auto loader = factory->create(provider, environment, xml);
+    REQUIRE(loader.isOk());
+
+    mindset::Dataset dataset;
+    auto status = loader.getResult()->loadAsync(dataset).get();
+    REQUIRE(status.status == mindset::LoaderStatusType::DONE);
+    REQUIRE(requested.size() == 2);
+    REQUIRE(dataset.getNeurons().size() == 4);
+    for (mindset::UID uid = 0; uid < 4; ++uid) {
+        auto neuron = dataset.getNeuron(uid);
+        REQUIRE(neuron.has_value());
+        REQUIRE(neuron.value()->getMorphology().has_value());
+    }
+}
+
 std::vector<rush::Vec3f> walkSynapse(mindset::Dataset& dataset, mindset::Neuron& pre, mindset::Neuron& post,
                                      mindset::UID preNeurite, mindset::UID postNeurite)
 {
@@ -0,0 +1,78 @@
+// Copyright (c) 2025. VG-Lab/URJC.
+//
+// Authors: Gael Rial Costas <gael.rial.costas@urjc.es>
+//
+// This file is part of Mindset <https://gitlab.gmrv.es/g.rial/mindset>
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 3.0 as published
+// by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+// details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+#include <catch2/catch_all.hpp>
+#include <mindset/mindset.h>
+
+TEST_CASE("Dataset view")
+{
+    mindset::DatasetGeneratorSettings settings;
+    settings.neurons = 50;
+    settings.synapses.amount = 3'000;
+
+    mindset::Dataset dataset;
+    mindset::DatasetGenerator(settings).generate(dataset);
+
+    std::vector<mindset::UID> selected;
+    for (mindset::UID uid = 0; uid < 20; ++uid) {
+        selected.push_back(uid);
+    }
+    selected.push_back(1'000); // Not present: ignored.
+    mindset::DatasetView view(dataset, mindset::UIDSet(selected));
+
+    REQUIRE(view.getNeuronsAmount() == 20);
+    REQUIRE(view.contains(5));
+    REQUIRE_FALSE(view.contains(1'000));
+    REQUIRE(view.getNeuron(5).has_value());
+    REQUIRE_FALSE(view.getNeuron(30).has_value());
+    REQUIRE(std::ranges::distance(view.getNeurons()) == 20);
+
+    size_t induced = 0;
+    size_t outgoing = 0;
+    size_t incoming = 0;
+    for (auto synapse : dataset.getCircuit().getSynapses()) {
+        bool pre = synapse->getPreSynapticNeuron() < 20;
+        bool post = synapse->getPostSynapticNeuron() < 20;
+        induced += pre && post;
+        outgoing += pre;
+        incoming += post;
+    }
+    REQUIRE(induced > 0);
+
+    REQUIRE(static_cast<size_t>(std::ranges::distance(view.getSynapses())) == induced);
+    REQUIRE(static_cast<size_t>(std::ranges::distance(view.getOutgoingSynapses())) == outgoing);
+    REQUIRE(static_cast<size_t>(std::ranges::distance(view.getIncomingSynapses())) == incoming);
+    for (auto synapse : view.getSynapses()) {
+        REQUIRE(view.contains(synapse->getPreSynapticNeuron()));
+        REQUIRE(view.contains(synapse->getPostSynapticNeuron()));
+    }
+
+    // The view shares the properties of the dataset.
+    auto transforms = mindset::getNeuronsProperties<mindset::NeuronTransform>(view, mindset::PROPERTY_TRANSFORM);
+    REQUIRE(transforms.size() == 20);
+    for (auto neuron : view.getNeurons()) {
+        REQUIRE(neuron.getTransform().has_value());
+    }
+
+    auto subview = view.subview(mindset::UIDSet{1, 2, 40});
+    REQUIRE(subview.getNeuronsUIDs() == mindset::UIDSet{1, 2});
+
+    const auto& constView = view;
+    REQUIRE(std::ranges::distance(constView.getSynapses()) == std::ranges::distance(view.getSynapses()));
+}